@@ -16,7 +16,10 @@ class FileRegionReplacer:
         if start_index == -1 or end_index == -1:
             raise ValueError(f"Region tags for '{region_name}' not found in the file.")
 
-        self.content = "".join([self.content[0:start_index], start_tag, '\n', region_content, '\n', self.content[end_index:]])
+        if region_content:
+            self.content = "".join([self.content[0:start_index], start_tag, '\n', region_content, '\n', self.content[end_index:]])
+        else:
+            self.content = "".join([self.content[0:start_index], start_tag, self.content[end_index:]])
 
     def save(self, output_path=None):
         target_path = output_path if output_path else self.file_path
@@ -77,6 +77,14 @@ def gen_low_level_opcode_structs(low_level_opcodes):
     return "\n".join(lines)
 
 
+def gen_low_level_opcode_names(low_level_opcodes):
+    lines = []
+    padding = "    "
+    for opcode in low_level_opcodes:
+        lines.append(f"{padding}\"{opcode.name}\",")
+    return "\n".join(lines)
+
+
 def gen_low_level_opcode_size(low_level_opcodes):
     lines = []
     padding = "    "
@@ -129,6 +137,65 @@ def gen_low_level_opcode_write_to_data(low_level_opcodes):
     return "\n".join(lines)
 
 
+def get_param_getter_expr(param):
+    if param.arg_kind == "stack":
+        return f"inst.get_var_{param.arg}_eval_stack_idx()"
+    return f"inst.get_{param.arg}()"
+
+def get_param_fit_check_func(type_name):
+    match type_name:
+        case "u8":
+            return "fit_u8"
+        case "i8":
+            return "fit_i8"
+        case _:
+            raise NotImplementedError(f"Short param type {type_name!r} is not supported")
+
+def wrap_condition(head, checks, tail, column_limit=160):
+    # join checks with && and wrap them the way clang-format does, aligned after the opening parenthesis
+    lines = []
+    cur = head
+    for i, check in enumerate(checks):
+        part = check + (" &&" if i + 1 < len(checks) else tail)
+        if cur != head and len(cur) + 1 + len(part) > column_limit:
+            lines.append(cur)
+            cur = " " * len(head) + part
+        else:
+            cur = cur + part if cur == head else f"{cur} {part}"
+    lines.append(cur)
+    return lines
+
+def gen_low_level_short_instruction_select(low_level_opcodes):
+    opcode_dict = {opcode.name: opcode for opcode in low_level_opcodes}
+    lines = []
+    padding = "    "
+    for short_op in low_level_opcodes:
+        if short_op.prefix != 0 or short_op.fused_pair is not None:
+            continue
+        long_op = opcode_dict.get(short_op.name[:-5])
+        if long_op is None:
+            # InitLocalsNShort/RetNopShort are emitted directly by the transformer
+            continue
+        long_params = {param.name: param for param in long_op.params}
+        checks = []
+        for param in short_op.params:
+            if param.name.startswith("__padding_"):
+                continue
+            if long_params[param.name].type == param.type:
+                continue
+            checks.append(f"{get_param_fit_check_func(param.type)}({get_param_getter_expr(param)})")
+        lines.append(f"{padding}case OpCodeEnum::{long_op.name}:")
+        if not checks:
+            lines.append(f"{padding}    return OpCodeEnum::{short_op.name};")
+            continue
+        lines.extend(wrap_condition(f"{padding}    if (", checks, ")"))
+        lines.append(f"{padding}    {{")
+        lines.append(f"{padding}        return OpCodeEnum::{short_op.name};")
+        lines.append(f"{padding}    }}")
+        lines.append(f"{padding}    return OpCodeEnum::Illegal;")
+    return "\n".join(lines)
+
+
 def gen_computed_goto_labels_region(grouped):
     lines = []
     for prefix in range(0, 6):
@@ -138,7 +205,7 @@ def gen_computed_goto_labels_region(grouped):
             lines.append(f"        &&LABEL{prefix}_{opcode.name},")
         if prefix == 0:
             for unused_code in range(len(opcodes), 0xFB):
-                lines.append(f"        &&LABEL0___UnusedF9,") # all unused map to same label
+                lines.append(f"        &&LABEL0___UnusedFA,") # all unused map to the label of the last one
             for prefix_id in range(1, 6):
                 lines.append(f"        &&LABEL0_Prefix{prefix_id},")
         lines.append(f"    }};")
@@ -238,49 +305,148 @@ def generate_special_short_instruction_case(short_name):
         case _:
             return None
 
+def derive_short_instruction_case(op, prefix_blocks):
+    long_name = op.name[:-5]
+    for prefix in range(1, 6):
+        for is_lite in (False, True):
+            block = prefix_blocks.get((long_name, prefix, is_lite))
+            if not block:
+                continue
+            lite = '_LITE' if is_lite else ''
+            block_new = block
+            block_new = re.sub(f'LEANCLR_CASE_BEGIN{lite}{prefix}\\((\\w+)\\)', lambda m: f'LEANCLR_CASE_BEGIN{lite}0({m.group(1)}Short)', block_new)
+            block_new = block_new.replace(f'LEANCLR_CASE_END{lite}{prefix}()', f'LEANCLR_CASE_END{lite}0()')
+            block_new = re.sub(f'\\bll::{long_name}\\b', f'll::{op.name}', block_new)
+            block_new = '\n'.join([line[8:] if line.startswith('        ') else line for line in block_new.splitlines()])
+            return block_new
+    return generate_special_short_instruction_case(op.name)
+
 def gen_short_instruction_cases(low_level_opcodes, interpreter_cpp_path):
     prefix_blocks = extract_case_blocks_from_interpreter(interpreter_cpp_path)
     blocks = []
     for op in low_level_opcodes:
-        if op.prefix != 0:
+        if op.prefix != 0 or op.fused_pair is not None:
             continue
         #print(f"Processing short instruction: {op.name}")
         assert(op.name.endswith('Short'))
-        long_name = op.name[:-5]
-        found = False
-        for prefix in range(1, 6):
-            key = (long_name, prefix, False)
-            block = prefix_blocks.get(key)
-            if block:
-                block_new = block
-                block_new = re.sub(f'LEANCLR_CASE_BEGIN{prefix}\\((\\w+)\\)', lambda m: f'LEANCLR_CASE_BEGIN0({m.group(1)}Short)', block_new)
-                block_new = block_new.replace(f'LEANCLR_CASE_END{prefix}()', 'LEANCLR_CASE_END0()')
-                block_new = '\n'.join([line[8:] if line.startswith('        ') else line for line in block_new.splitlines()])
-                blocks.append(block_new)
-                found = True
-                break
-            key_lite = (long_name, prefix, True)
-            block = prefix_blocks.get(key_lite)
-            if block:
-                block_new = block
-                block_new = re.sub(f'LEANCLR_CASE_BEGIN_LITE{prefix}\\((\\w+)\\)', lambda m: f'LEANCLR_CASE_BEGIN_LITE0({m.group(1)}Short)', block_new)
-                block_new = block_new.replace(f'LEANCLR_CASE_END_LITE{prefix}()', 'LEANCLR_CASE_END_LITE0()')
-                block_new = '\n'.join([line[8:] if line.startswith('        ') else line for line in block_new.splitlines()])
-                blocks.append(block_new)
-                found = True
-                break
-        if not found:
-            block_new = generate_special_short_instruction_case(op.name)
-            if block_new:
-                blocks.append(block_new)
-                found = True
-        if not found:
+        block_new = derive_short_instruction_case(op, prefix_blocks)
+        if not block_new:
             raise RuntimeError(f"Warning: No matching prefixN case found for short instruction {op.name}")
+        blocks.append(block_new)
     # split every line to new lines
     lines = [line for block in blocks for line in block.splitlines() if line.strip() != '']
     #lines = [line for line in lines if line.strip() != '']
     return '\n'.join(lines)
 
+# --- superinstructions: fuse hot adjacent opcode pairs recorded by the interpreter profiler ---
+class HandlerBody:
+    def __init__(self, is_lite, lines):
+        self.is_lite = is_lite
+        # lines of the handler body between the outer braces, dedented
+        self.lines = lines
+
+def parse_handler_body(block):
+    lines = [line for line in block.splitlines() if line.strip() != '']
+    is_lite = '_LITE' in lines[0]
+    assert lines[1].strip() == '{' and lines[-2].strip() == '}'
+    body = lines[2:-2]
+    indent = min((len(line) - len(line.lstrip()) for line in body), default=0)
+    return HandlerBody(is_lite, [line[indent:] for line in body])
+
+def collect_handler_bodies(low_level_opcodes, interpreter_cpp_path):
+    prefix_blocks = extract_case_blocks_from_interpreter(interpreter_cpp_path)
+    bodies = {}
+    for op in low_level_opcodes:
+        if op.prefix == 0:
+            block = derive_short_instruction_case(op, prefix_blocks)
+        else:
+            block = prefix_blocks.get((op.name, op.prefix, False)) or prefix_blocks.get((op.name, op.prefix, True))
+        if block:
+            bodies[op.name] = parse_handler_body(block)
+    return bodies
+
+# The first instruction of a pair falls through into the second one, so it must be a plain (non-lite) handler
+# that never redirects ip itself.
+NON_FUSIBLE_FIRST_PATTERNS = [re.compile(r'\bip\s*[+-]?='), re.compile(r'\bgoto\b'), re.compile(r'ENTER_\w*FRAME'), re.compile(r'LEAVE_FRAME')]
+
+def can_fuse_first(body):
+    if body is None or body.is_lite:
+        return False
+    return not any(pattern.search(line) for line in body.lines for pattern in NON_FUSIBLE_FIRST_PATTERNS)
+
+def load_opcode_pair_profile(profile_path):
+    pairs = []
+    with open(profile_path, encoding='utf-8') as f:
+        for line in f:
+            line = line.strip()
+            if not line or line.startswith('#'):
+                continue
+            first, second, count = line.split()
+            pairs.append((first, second, int(count)))
+    pairs.sort(key=lambda p: p[2], reverse=True)
+    return pairs
+
+def select_superinstructions(low_level_opcodes, bodies, low_level_opcode_spec_file):
+    config = opcode_spec_parser.parse_superinstruction_config(low_level_opcode_spec_file)
+    if config is None:
+        return []
+    opcode_dict = {op.name: op for op in low_level_opcodes}
+    superinstructions = []
+    for first_name, second_name, count in load_opcode_pair_profile(config.profile_path):
+        if len(superinstructions) >= config.max_count or count < config.min_count:
+            break
+        first = opcode_dict.get(first_name)
+        second = opcode_dict.get(second_name)
+        # pairs involving opcodes that no longer exist (or superinstructions from an older profile) are ignored
+        if first is None or second is None or first.fused_pair is not None or second.fused_pair is not None:
+            continue
+        if not can_fuse_first(bodies.get(first.name)) or bodies.get(second.name) is None:
+            continue
+        # the one-byte page is full, and a prefixed form of a one-byte opcode would grow it past the short branch offsets
+        # already chosen
+        if first.prefix == 0 or not opcode_spec_parser.has_free_opcode_code(first.prefix):
+            continue
+        superinstructions.append(opcode_spec_parser.create_superinstruction(first, second))
+    return superinstructions
+
+def gen_super_instruction_cases(prefix, superinstructions, bodies):
+    base_padding = " " * (12 if prefix == 0 else 20)
+    lines = []
+    for op in superinstructions:
+        if op.prefix != prefix:
+            continue
+        first, second = op.fused_pair
+        lines.append(f"{base_padding}LEANCLR_CASE_BEGIN_LITE{prefix}({op.name})")
+        lines.append(f"{base_padding}{{")
+        for inst in (first, second):
+            body = bodies[inst.name]
+            lines.append(f"{base_padding}    {{")
+            if not body.is_lite:
+                lines.append(f"{base_padding}        const auto ir = (ll::{inst.name}*)(ip + THREADED_CODE_HEADER_SIZE);")
+            lines.extend(f"{base_padding}        {line}" for line in body.lines)
+            if not body.is_lite:
+                lines.append(f"{base_padding}        ip = reinterpret_cast<const uint8_t*>(ir + 1);")
+            lines.append(f"{base_padding}    }}")
+        lines.append(f"{base_padding}}}")
+        lines.append(f"{base_padding}LEANCLR_CASE_END_LITE{prefix}()")
+    return "\n".join(lines)
+
+def gen_low_level_super_instruction_select(superinstructions):
+    by_first = {}
+    for op in superinstructions:
+        by_first.setdefault(op.fused_pair[0].name, []).append(op)
+    lines = []
+    padding = "    "
+    for first_name, ops in by_first.items():
+        lines.append(f"{padding}case OpCodeEnum::{first_name}:")
+        for op in ops:
+            lines.append(f"{padding}    if (second == OpCodeEnum::{op.fused_pair[1].name})")
+            lines.append(f"{padding}    {{")
+            lines.append(f"{padding}        return OpCodeEnum::{op.name};")
+            lines.append(f"{padding}    }}")
+        lines.append(f"{padding}    break;")
+    return "\n".join(lines)
+
 if __name__ == "__main__":
     import sys
     if len(sys.argv) != 6:
@@ -293,6 +459,10 @@ if __name__ == "__main__":
     output_file_cpp = sys.argv[4]
     interpreter_cpp_path = sys.argv[5]
     low_level_opcodes = parse_low_level_opcodes(low_level_opcode_xml_file, high_level_opcode_xml_file)
+    handler_bodies = collect_handler_bodies(low_level_opcodes, interpreter_cpp_path)
+    superinstructions = select_superinstructions(low_level_opcodes, handler_bodies, low_level_opcode_xml_file)
+    low_level_opcodes = low_level_opcodes + superinstructions
+    print(f"Selected {len(superinstructions)} superinstructions")
 
     frr_h = file_region_replacer.FileRegionReplacer(output_file_h)
     frr_h.replace_region("LOW_LEVEL_OPCODE_ENUM", gen_low_level_opcode_enum(low_level_opcodes))
@@ -304,8 +474,11 @@ if __name__ == "__main__":
     print(f"Updated low-level opcode definitions in {output_file_h}")
 
     frr_cpp = file_region_replacer.FileRegionReplacer(output_file_cpp)
+    frr_cpp.replace_region("LOW_LEVEL_OPCODE_NAMES", gen_low_level_opcode_names(low_level_opcodes))
     frr_cpp.replace_region("LOW_LEVEL_INSTRUCTION_SIZES", gen_low_level_opcode_size(low_level_opcodes))
     frr_cpp.replace_region("LOW_LEVEL_INSTRUCTION_WRITE_TO_DATA", gen_low_level_opcode_write_to_data(low_level_opcodes))
+    frr_cpp.replace_region("LOW_LEVEL_SHORT_INSTRUCTION_SELECT", gen_low_level_short_instruction_select(low_level_opcodes))
+    frr_cpp.replace_region("LOW_LEVEL_SUPER_INSTRUCTION_SELECT", gen_low_level_super_instruction_select(superinstructions))
     frr_cpp.save()
     print(f"Updated low-level opcode definitions in {output_file_cpp}")
 
@@ -316,7 +489,9 @@ if __name__ == "__main__":
     # 替换 SHORT_INSTRUCTION_CASES 区域
     short_cases = gen_short_instruction_cases(low_level_opcodes, interpreter_cpp_path)
     frr_interp.replace_region("SHORT_INSTRUCTION_CASES", short_cases)
+    for prefix in range(0, 5):
+        frr_interp.replace_region(f"SUPER_INSTRUCTION_CASES{prefix}", gen_super_instruction_cases(prefix, superinstructions, handler_bodies))
     frr_interp.save()
     print(f"Updated COMPUTED_GOTO_LABELS in {interpreter_cpp_path}")
 
-    print(f"Updated SHORT_INSTRUCTION_CASES in {interpreter_cpp_path}")
+    print(f"Updated SHORT_INSTRUCTION_CASES and SUPER_INSTRUCTION_CASES in {interpreter_cpp_path}")
@@ -122,6 +122,8 @@ class LowLevelOpcode:
         self.params = params
         self.variant = variant
         self.addr_mode = addr_mode
+        # (first, second) for superinstructions, None for ordinary opcodes
+        self.fused_pair = None
 
     def set_code(self, code):
         self.code = code
@@ -169,17 +171,32 @@ def parse_low_level_opcode_params(opcode_elem, params):
         params.append(param)
 
 PREFIX_START_CODE = 251
+# the last one-byte code below the prefixes stays unused: __UnusedFA is the handler every undefined one-byte code dispatches to
+UNUSED_PREFIX0_CODE = PREFIX_START_CODE - 1
 
 next_code_by_prefix = [0] * 6
 
 def allocate_opcode_code(prefix):
     global next_code_by_prefix
     code = next_code_by_prefix[prefix]
-    if code >= 256 or (prefix == 0 and code >= PREFIX_START_CODE):
+    if code >= 256 or (prefix == 0 and code >= UNUSED_PREFIX0_CODE):
         raise ValueError(f"Opcode code overflow for prefix {prefix}")
     next_code_by_prefix[prefix] = code + 1
     return code
 
+def has_free_opcode_code(prefix):
+    code = next_code_by_prefix[prefix]
+    return code < 256 and not (prefix == 0 and code >= UNUSED_PREFIX0_CODE)
+
+def create_superinstruction(first, second):
+    # A superinstruction keeps the layout of its first instruction; the second one stays in place
+    # right after it and is executed inline by the fused handler.
+    opcode = LowLevelOpcode(first.name + second.name, first.hlopcode, first.prefix,
+                            [OpcodeParam(p.name, p.type, p.arg, p.arg_kind, p.addr_mode) for p in first.params], first.variant, first.addr_mode)
+    opcode.fused_pair = (first, second)
+    opcode.set_code(allocate_opcode_code(opcode.prefix))
+    return opcode
+
 def compile_low_level_opcodes(low_level_opcodes):
     for opcode in low_level_opcodes:
         opcode.set_code(allocate_opcode_code(opcode.prefix))
@@ -240,3 +257,18 @@ def parse_low_level_opcode_file(file_path, hlopcode_dic):
     tree = ET.parse(file_path)
     root = tree.getroot()
     return parse_low_level_opcodes(root, hlopcode_dic)
+
+class SuperinstructionConfig:
+    def __init__(self, profile_path, max_count, min_count):
+        self.profile_path = profile_path
+        self.max_count = max_count
+        self.min_count = min_count
+
+def parse_superinstruction_config(file_path):
+    import os
+    root = ET.parse(file_path).getroot()
+    elem = root.find('superinstructions')
+    if elem is None:
+        return None
+    profile_path = os.path.join(os.path.dirname(os.path.abspath(file_path)), elem.get('profile'))
+    return SuperinstructionConfig(profile_path, int(elem.get('max_count', '0')), int(elem.get('min_count', '1')))
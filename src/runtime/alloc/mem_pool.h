@@ -39,7 +39,9 @@ class MemPool
     {
         const std::size_t aligned_capacity = std::max(align_up(capacity, page_size_), region_size_);
 
-        auto* data = static_cast<std::uint8_t*>(alloc::GeneralAllocation::malloc_zeroed(aligned_capacity));
+        // region memory is left uninitialized and zeroed per allocation, so a pool that is reset never re-zeroes whole regions
+        // and untouched tails of regions are never written
+        auto* data = static_cast<std::uint8_t*>(alloc::GeneralAllocation::malloc(aligned_capacity));
         if (!data)
         {
             return nullptr;
@@ -71,6 +73,25 @@ class MemPool
         return true;
     }
 
+    void free_regions()
+    {
+        Region* reg = region_;
+        while (reg)
+        {
+            Region* next = reg->next;
+#ifndef NDEBUG
+            std::memset(reg->data, 0xDD, reg->size);
+#endif
+            alloc::GeneralAllocation::free(reg->data);
+#ifndef NDEBUG
+            std::memset(reg, 0xDD, sizeof(Region));
+#endif
+            alloc::GeneralAllocation::free(reg);
+            reg = next;
+        }
+        region_ = nullptr;
+    }
+
   public:
     MemPool() : region_(nullptr), page_size_(DEFAULT_PAGE_SIZE), region_size_(DEFAULT_REGION_SIZE)
     {
@@ -95,23 +116,52 @@ class MemPool
 
     ~MemPool()
     {
-        Region* reg = region_;
-        while (reg)
+        free_regions();
+    }
+
+    // Bytes handed out since construction or the last reset, including alignment padding.
+    std::size_t get_used_size() const
+    {
+        std::size_t used = 0;
+        for (const Region* reg = region_; reg; reg = reg->next)
+        {
+            used += reg->cur;
+        }
+        return used;
+    }
+
+    // Bytes of all regions, which is the memory the pool holds whether handed out or not.
+    std::size_t get_reserved_size() const
+    {
+        std::size_t reserved = 0;
+        for (const Region* reg = region_; reg; reg = reg->next)
+        {
+            reserved += reg->size;
+        }
+        return reserved;
+    }
+
+    // Releases all allocations at once but keeps the memory for the next ones. Allocations that spilled into several
+    // regions are merged into a single region large enough for all of them, so a pool reused for similar work stops growing.
+    void reset()
+    {
+        if (region_ && region_->next)
+        {
+            const std::size_t used = get_used_size();
+            free_regions();
+            add_region(used);
+        }
+        else if (region_)
         {
-            Region* next = reg->next;
-#ifndef NDEBUG
-            std::memset(reg->data, 0xDD, reg->size);
-#endif
-            alloc::GeneralAllocation::free(reg->data);
 #ifndef NDEBUG
-            std::memset(reg, 0xDD, sizeof(Region));
+            std::memset(region_->data, 0xDD, region_->cur);
 #endif
-            alloc::GeneralAllocation::free(reg);
-            reg = next;
+            region_->cur = 0;
         }
     }
 
-    std::uint8_t* malloc_zeroed(std::size_t size, std::size_t alignment = ALIGNMENT)
+    // Uninitialized memory, for data that is fully written before it is read.
+    std::uint8_t* malloc(std::size_t size, std::size_t alignment = ALIGNMENT)
     {
         assert(alignment && (alignment & (alignment - 1)) == 0 && "Alignment must be a power of two");
         assert(size % alignment == 0 && "Size must be multiple of alignment");
@@ -135,6 +185,16 @@ class MemPool
         return ptr;
     }
 
+    std::uint8_t* malloc_zeroed(std::size_t size, std::size_t alignment = ALIGNMENT)
+    {
+        std::uint8_t* ptr = malloc(size, alignment);
+        if (ptr)
+        {
+            std::memset(ptr, 0, size);
+        }
+        return ptr;
+    }
+
     std::uint8_t* calloc(std::size_t count, std::size_t size, size_t alignment = ALIGNMENT)
     {
         assert(alignment && (alignment & (alignment - 1)) == 0 && "Alignment must be a power of two");
@@ -156,6 +216,13 @@ class MemPool
         return reinterpret_cast<T*>(calloc(count, sizeof(T), alignof(T)));
     }
 
+    template <typename T>
+    T* malloc_any_uninitialized(std::size_t count)
+    {
+        assert(count <= SIZE_MAX / sizeof(T) && "Size overflow in malloc_any_uninitialized");
+        return reinterpret_cast<T*>(malloc(count * sizeof(T), alignof(T)));
+    }
+
     template <typename T, typename... Args>
     T* new_any(Args&&... args)
     {
@@ -17,6 +17,17 @@
 #define LEANCLR_USE_COMPUTED_GOTO_DISPATCHER 0
 #endif
 
+// Direct-threaded code: every LL instruction is preceded by the 32-bit offset of its handler from a base label of the
+// dispatcher, so dispatching is a single indirect jump without loading opcode bytes or label tables.
+// Costs 4 bytes per instruction and requires the computed goto dispatcher.
+#ifndef LEANCLR_USE_DIRECT_THREADED_DISPATCHER
+#define LEANCLR_USE_DIRECT_THREADED_DISPATCHER 0
+#endif
+#if !LEANCLR_USE_COMPUTED_GOTO_DISPATCHER
+#undef LEANCLR_USE_DIRECT_THREADED_DISPATCHER
+#define LEANCLR_USE_DIRECT_THREADED_DISPATCHER 0
+#endif
+
 #if !NDEBUG
 #define LEANCLR_ENABLE_TEST_PINVOKES 1
 #define LEANCLR_ENABLE_TEST_INTRINSICS 1
@@ -29,4 +40,39 @@
 #endif
 #endif
 
+// Record the dynamic LL opcode pair histogram used to select superinstructions.
+#ifndef LEANCLR_ENABLE_OPCODE_PAIR_PROFILE
+#define LEANCLR_ENABLE_OPCODE_PAIR_PROFILE 0
+#endif
+
+// Methods are first transformed without optimizations and re-transformed with them once they are invoked
+// LEANCLR_TIER_UP_INVOCATION_THRESHOLD times or run LEANCLR_TIER_UP_BACK_EDGE_THRESHOLD backward branches.
+#ifndef LEANCLR_ENABLE_TIERED_EXECUTION
+#define LEANCLR_ENABLE_TIERED_EXECUTION 1
+#endif
+
+// Tests.Optimizations.TierUp of CoreTests mirrors the invocation threshold.
+#ifndef LEANCLR_TIER_UP_INVOCATION_THRESHOLD
+#define LEANCLR_TIER_UP_INVOCATION_THRESHOLD 16
+#endif
+
+#ifndef LEANCLR_TIER_UP_BACK_EDGE_THRESHOLD
+#define LEANCLR_TIER_UP_BACK_EDGE_THRESHOLD 1024
+#endif
+
+// Optimized methods inline direct calls to straight-line callees of at most LEANCLR_INLINE_MAX_IL_SIZE IL bytes.
+#ifndef LEANCLR_ENABLE_INLINING
+#define LEANCLR_ENABLE_INLINING 1
+#endif
+
+#ifndef LEANCLR_INLINE_MAX_IL_SIZE
+#define LEANCLR_INLINE_MAX_IL_SIZE 32
+#endif
+
+// Objects carry only their class pointer. The single-threaded runtime keeps no lock or hash code state in objects, so the
+// sync block slot of the full header would stay unused.
+#ifndef LEANCLR_COMPACT_OBJECT_HEADER
+#define LEANCLR_COMPACT_OBJECT_HEADER 1
+#endif
+
 #define LEANCLR_NO_EXCEPTION noexcept
@@ -1,42 +1,484 @@
+#include <algorithm>
+
 #include "garbage_collector.h"
-#include "alloc/general_allocation.h"
+#include "object_heap.h"
 #include "metadata/rt_metadata.h"
+#include "metadata/module_def.h"
+#include "interp/interpreter.h"
+#include "interp/machine_state.h"
+#include "utils/rt_vector.h"
+#include "vm/appdomain.h"
+#include "vm/class.h"
+#include "vm/environment.h"
+#include "vm/gchandle.h"
+#include "vm/reflection.h"
+#include "vm/rt_array.h"
 #include "vm/rt_managed_types.h"
+#include "vm/rt_string.h"
+#include "vm/rt_thread.h"
+#include "vm/settings.h"
+#include "platform/rt_time.h"
 
 namespace leanclr::gc
 {
+
+struct FixedRegion
+{
+    const void* data;
+    size_t size;
+};
+
+constexpr size_t STORE_BUFFER_CAPACITY = 4096;
+// objects traced between two looks at the clock while marking incrementally
+constexpr size_t MARK_STEP_CHECK_INTERVAL = 256;
+
+static utils::Vector<FixedRegion> s_fixed_regions;
+static utils::Vector<vm::RtObject*> s_mark_stack;
+// old objects that had references stored into them since the last collection
+static utils::Vector<vm::RtObject*> s_remembered_objects;
+static void* s_store_buffer[STORE_BUFFER_CAPACITY];
+void** GarbageCollector::s_store_buffer_cursor = s_store_buffer;
+void** GarbageCollector::s_store_buffer_end = s_store_buffer + STORE_BUFFER_CAPACITY;
+static bool s_collections_enabled = false;
+// minor collections are enabled, so the stores into old objects are remembered
+static bool s_generational = false;
+// -1 while no collection is requested
+static int32_t s_requested_generation = -1;
+static bool s_collecting = false;
+// an incremental full collection marked its roots and traces the heap in steps
+static bool s_marking = false;
+static int32_t s_collection_counts[GarbageCollector::MAX_GENERATION + 1] = {};
+static size_t s_allocated_bytes_since_collection = 0;
+// SIZE_MAX while allocation never requests collections
+static size_t s_next_collection_trigger = SIZE_MAX;
+// the heap size that turns the next collection into a full one
+static size_t s_full_collection_heap_size = SIZE_MAX;
+static size_t s_total_allocated_bytes = 0;
+
+static void update_collection_trigger()
+{
+    const size_t threshold = vm::Settings::get_gc_collection_threshold();
+    // a heap that survived large keeps the full collections proportional to the work they do
+    const size_t full_trigger = threshold != 0 ? std::max(threshold, ObjectHeap::get_size()) : SIZE_MAX;
+    s_next_collection_trigger = s_generational && threshold != 0 ? vm::Settings::get_gc_nursery_size() : full_trigger;
+}
+
+static void update_full_collection_heap_size()
+{
+    const size_t threshold = vm::Settings::get_gc_collection_threshold();
+    const size_t heap_size = ObjectHeap::get_size();
+    s_full_collection_heap_size = threshold != 0 ? heap_size + std::max(threshold, heap_size) : SIZE_MAX;
+}
+
+static vm::RtObject* allocate(metadata::RtClass* klass, size_t size)
+{
+    assert(size >= sizeof(vm::RtObject));
+    vm::RtObject* obj = ObjectHeap::allocate(size);
+    obj->klass = klass;
+    s_total_allocated_bytes += size;
+    s_allocated_bytes_since_collection += size;
+    if (s_allocated_bytes_since_collection >= s_next_collection_trigger && s_requested_generation < 0)
+    {
+        s_requested_generation = 0;
+    }
+    return obj;
+}
+
 void GarbageCollector::initialize()
 {
-    // Initialization logic for the garbage collector goes here
+    s_collections_enabled = false;
+    ObjectHeap::initialize();
+}
+
+void GarbageCollector::enable_collections()
+{
+    s_collections_enabled = true;
+    s_generational = vm::Settings::get_gc_nursery_size() != 0;
+    update_collection_trigger();
+    update_full_collection_heap_size();
 }
 
 void* GarbageCollector::allocate_fixed(size_t size)
 {
-    // TODO: Implement fixed-size allocation logic
-    return alloc::GeneralAllocation::malloc_zeroed(size);
+    void* data = ObjectHeap::allocate_fixed(size);
+    s_fixed_regions.push_back({data, size});
+    return data;
 }
 
 vm::RtObject** GarbageCollector::allocate_fixed_reference_array(size_t length)
 {
-    return alloc::GeneralAllocation::calloc_any<vm::RtObject*>(length);
+    vm::RtObject** data = static_cast<vm::RtObject**>(ObjectHeap::allocate_fixed(length * sizeof(vm::RtObject*)));
+    s_fixed_regions.push_back({data, length * sizeof(vm::RtObject*)});
+    return data;
 }
 
 vm::RtObject* GarbageCollector::allocate_object(metadata::RtClass* klass, size_t size)
 {
-    // TODO: Implement object allocation logic
-    assert(size >= sizeof(vm::RtObject));
-    auto obj = (vm::RtObject*)alloc::GeneralAllocation::malloc_zeroed(size);
-    obj->klass = klass;
-    return obj;
+    return allocate(klass, size);
 }
 
 vm::RtObject* GarbageCollector::allocate_object_not_contains_references(metadata::RtClass* klass, size_t size)
 {
-    return allocate_object(klass, size);
+    return allocate(klass, size);
 }
 
 vm::RtObject* GarbageCollector::allocate_array(metadata::RtClass* arrClass, size_t totalBytes)
 {
-    return allocate_object(arrClass, totalBytes);
+    return allocate(arrClass, totalBytes);
+}
+
+void GarbageCollector::request_collection(int32_t generation)
+{
+    s_requested_generation = std::max(s_requested_generation, std::min(generation, MAX_GENERATION));
+}
+
+bool GarbageCollector::is_collection_requested()
+{
+    return s_requested_generation >= 0 && s_collections_enabled && !s_collecting;
+}
+
+// Moves the old objects that the logged stores wrote into to the remembered set. Stores into young objects, the eval stack,
+// static data and native memory need no remembering. While marking incrementally, the marked objects that were written into
+// may have been traced already and are made grey again instead.
+static void remember_logged_stores(void** end)
+{
+    if (!s_marking && !s_generational)
+    {
+        return;
+    }
+    for (void** location = s_store_buffer; location < end; ++location)
+    {
+        vm::RtObject* obj = ObjectHeap::find_marked_object_containing(reinterpret_cast<uintptr_t>(*location));
+        if (!obj)
+        {
+            continue;
+        }
+        if (s_marking)
+        {
+            s_mark_stack.push_back(obj);
+        }
+        else if (ObjectHeap::try_remember(obj))
+        {
+            s_remembered_objects.push_back(obj);
+        }
+    }
+}
+
+void GarbageCollector::flush_store_buffer()
+{
+    remember_logged_stores(s_store_buffer_cursor);
+    s_store_buffer_cursor = s_store_buffer;
+}
+
+void GarbageCollector::mark_object(vm::RtObject* obj)
+{
+    if (obj == nullptr)
+    {
+        return;
+    }
+    if (ObjectHeap::try_mark(obj))
+    {
+        s_mark_stack.push_back(obj);
+    }
+}
+
+bool GarbageCollector::is_marked(const vm::RtObject* obj)
+{
+    return ObjectHeap::is_marked(obj);
+}
+
+void GarbageCollector::mark_range_conservatively(const void* begin, const void* end)
+{
+    const uintptr_t* word = static_cast<const uintptr_t*>(begin);
+    const uintptr_t* const word_end = static_cast<const uintptr_t*>(end);
+    for (; word < word_end; ++word)
+    {
+        mark_object(ObjectHeap::find_object_containing(*word));
+    }
+}
+
+static void mark_references(const uint8_t* data, const uint8_t* reference_bitmap, size_t size)
+{
+    vm::RtObject* const* slots = reinterpret_cast<vm::RtObject* const*>(data);
+    const size_t slot_count = (size + PTR_SIZE - 1) / PTR_SIZE;
+    for (size_t i = 0; i < slot_count; ++i)
+    {
+        if (reference_bitmap[i / 8] & (1u << (i % 8)))
+        {
+            GarbageCollector::mark_object(slots[i]);
+        }
+    }
+}
+
+static void mark_array_elements(vm::RtArray* arr)
+{
+    metadata::RtClass* ele_class = arr->klass->element_class;
+    const int32_t length = vm::Array::get_array_length(arr);
+    if (vm::Class::is_reference_type(ele_class))
+    {
+        vm::RtObject* const* elements = vm::Array::get_array_data_start_as<vm::RtObject*>(arr);
+        for (int32_t i = 0; i < length; ++i)
+        {
+            GarbageCollector::mark_object(elements[i]);
+        }
+        return;
+    }
+    if (!ele_class->reference_bitmap)
+    {
+        return;
+    }
+    const size_t ele_size = vm::Array::get_array_element_size(arr);
+    const uint8_t* element = static_cast<const uint8_t*>(vm::Array::get_array_data_start_as_ptr_void(arr));
+    for (int32_t i = 0; i < length; ++i, element += ele_size)
+    {
+        mark_references(element, ele_class->reference_bitmap, ele_class->instance_size_without_header);
+    }
+}
+
+static void trace_object(vm::RtObject* obj)
+{
+    metadata::RtClass* klass = obj->klass;
+    if (!vm::Class::get_has_references(klass))
+    {
+        return;
+    }
+    if (vm::Class::is_array_or_szarray(klass))
+    {
+        mark_array_elements(static_cast<vm::RtArray*>(obj));
+        return;
+    }
+    if (klass->reference_bitmap)
+    {
+        mark_references(reinterpret_cast<const uint8_t*>(obj) + vm::RT_OBJECT_HEADER_SIZE, klass->reference_bitmap, klass->instance_size_without_header);
+    }
+}
+
+static void mark_user_strings()
+{
+    utils::Span<metadata::RtModuleDef*> modules = metadata::RtModuleDef::get_registered_modules();
+    for (size_t i = 0; i < modules.size(); ++i)
+    {
+        for (const auto& pair : modules[i]->get_user_strings())
+        {
+            GarbageCollector::mark_object(pair.second);
+        }
+    }
+}
+
+static void mark_roots()
+{
+    interp::MachineState::get_global_machine_state().mark_roots();
+    interp::Interpreter::mark_roots();
+    // class static data has no reference bitmap, so it is scanned conservatively like the eval stack
+    for (const FixedRegion& region : s_fixed_regions)
+    {
+        GarbageCollector::mark_range_conservatively(region.data, static_cast<const uint8_t*>(region.data) + region.size);
+    }
+    vm::GCHandle::mark_roots();
+    vm::String::mark_roots();
+    mark_user_strings();
+    vm::Reflection::mark_roots();
+    vm::AppDomain::mark_roots();
+    vm::Thread::mark_roots();
+    vm::Environment::mark_roots();
+}
+
+static void drain_mark_stack()
+{
+    while (!s_mark_stack.empty())
+    {
+        vm::RtObject* obj = s_mark_stack.back();
+        s_mark_stack.pop_back();
+        trace_object(obj);
+    }
+}
+
+// Returns false if the deadline passed before the mark stack ran empty.
+static bool drain_mark_stack_until(int64_t deadline_nanos)
+{
+    size_t traced_count = 0;
+    while (!s_mark_stack.empty())
+    {
+        if (++traced_count % MARK_STEP_CHECK_INTERVAL == 0 && os::Time::get_current_time_nanos() >= deadline_nanos)
+        {
+            return false;
+        }
+        vm::RtObject* obj = s_mark_stack.back();
+        s_mark_stack.pop_back();
+        trace_object(obj);
+    }
+    return true;
+}
+
+static void forget_remembered_objects()
+{
+    for (vm::RtObject* obj : s_remembered_objects)
+    {
+        ObjectHeap::forget(obj);
+    }
+    s_remembered_objects.clear();
+}
+
+// Marks the young objects reachable from the roots and the remembered objects, the old ones are marked already.
+static void collect_young()
+{
+    ObjectHeap::prepare_for_marking();
+    for (vm::RtObject* obj : s_remembered_objects)
+    {
+        ObjectHeap::forget(obj);
+        trace_object(obj);
+    }
+    s_remembered_objects.clear();
+
+    mark_roots();
+    drain_mark_stack();
+    vm::GCHandle::clear_collected_weak_targets();
+    ObjectHeap::sweep_young();
+}
+
+static void collect_full()
+{
+    forget_remembered_objects();
+    ObjectHeap::clear_marks();
+    ObjectHeap::prepare_for_marking();
+
+    mark_roots();
+    drain_mark_stack();
+    vm::GCHandle::clear_collected_weak_targets();
+    ObjectHeap::sweep();
+    update_full_collection_heap_size();
+}
+
+// The mutator keeps running until the marking finishes, allocating up to another collection threshold of bytes.
+static void start_incremental_collection()
+{
+    forget_remembered_objects();
+    ObjectHeap::clear_marks();
+    ObjectHeap::prepare_for_incremental_marking();
+    mark_roots();
+    s_marking = true;
+
+    const size_t threshold = vm::Settings::get_gc_collection_threshold();
+    s_allocated_bytes_since_collection = 0;
+    s_next_collection_trigger = threshold != 0 ? threshold : SIZE_MAX;
+    s_requested_generation = -1;
+}
+
+static void finish_incremental_collection()
+{
+    ObjectHeap::prepare_for_marking();
+    mark_roots();
+    drain_mark_stack();
+    s_marking = false;
+    vm::GCHandle::clear_collected_weak_targets();
+    ObjectHeap::sweep();
+    update_full_collection_heap_size();
+}
+
+// The generations the pending collection covers. It is a full one once the heap outgrew the last full collection.
+static int32_t select_generation()
+{
+    if (!s_generational || s_requested_generation < 0 || ObjectHeap::get_size() >= s_full_collection_heap_size)
+    {
+        return GarbageCollector::MAX_GENERATION;
+    }
+    return s_requested_generation;
+}
+
+void GarbageCollector::collect()
+{
+    if (s_collecting)
+    {
+        return;
+    }
+    s_collecting = true;
+    flush_store_buffer();
+    int32_t generation = MAX_GENERATION;
+    if (s_marking)
+    {
+        finish_incremental_collection();
+    }
+    else
+    {
+        generation = select_generation();
+        if (generation == 0)
+        {
+            collect_young();
+        }
+        else if (s_requested_generation == 0 && vm::Settings::get_gc_incremental_marking())
+        {
+            // allocation asked for it, so the host finishes it in steps
+            start_incremental_collection();
+            s_collecting = false;
+            return;
+        }
+        else
+        {
+            collect_full();
+        }
+    }
+
+    for (int32_t i = 0; i <= generation; ++i)
+    {
+        ++s_collection_counts[i];
+    }
+    s_allocated_bytes_since_collection = 0;
+    update_collection_trigger();
+    s_requested_generation = -1;
+    s_collecting = false;
+}
+
+bool GarbageCollector::step(int64_t budget_us)
+{
+    // native frames of nested executions may hold references outside the roots; the outermost one is at a safepoint in its
+    // internal calls, as it is for GC.Collect
+    if (!s_collections_enabled || s_collecting || interp::MachineState::get_global_machine_state().get_execution_depth() > 1)
+    {
+        return s_marking;
+    }
+    const int64_t deadline_nanos = os::Time::get_current_time_nanos() + budget_us * 1000;
+    if (!s_marking)
+    {
+        if (s_requested_generation < 0 && ObjectHeap::get_size() < s_full_collection_heap_size)
+        {
+            return false;
+        }
+        if (select_generation() == 0)
+        {
+            collect();
+            return false;
+        }
+        flush_store_buffer();
+        start_incremental_collection();
+    }
+
+    flush_store_buffer();
+    if (!drain_mark_stack_until(deadline_nanos))
+    {
+        return true;
+    }
+    collect();
+    return false;
+}
+
+int32_t GarbageCollector::get_generation(const vm::RtObject* obj)
+{
+    // between collections only the old objects are marked
+    return ObjectHeap::is_marked(obj) ? MAX_GENERATION : 0;
+}
+
+int32_t GarbageCollector::get_collection_count(int32_t generation)
+{
+    return generation >= 0 && generation <= MAX_GENERATION ? s_collection_counts[generation] : 0;
+}
+
+size_t GarbageCollector::get_heap_size()
+{
+    return ObjectHeap::get_size();
+}
+
+size_t GarbageCollector::get_total_allocated_bytes()
+{
+    return s_total_allocated_bytes;
 }
 } // namespace leanclr::gc
@@ -15,10 +15,33 @@ struct RtObject;
 namespace leanclr::gc
 {
 
+// Non-moving, generational mark-sweep collector, precise in the heap and conservative at the roots. Objects are traced through
+// the reference bitmaps of their classes. The roots are the eval stack of the machine state, fixed allocations (class static
+// data and reference arrays of the runtime), GC handles, interned and user strings and the object caches of the runtime; the
+// eval stack and class static data carry no reference maps, so every word in them that points into an object keeps that object
+// alive.
+//
+// Generation 0 holds the objects allocated since the last collection and generation 1 the ones that survived a collection,
+// which are promoted in place. A minor collection marks from the roots and from the remembered old objects, those that had a
+// reference stored into them since, and sweeps the young objects only. Stores of references into heap objects must therefore
+// go through the write barriers, which log the written locations in a store buffer.
+//
+// Collections are cooperative and only run at safepoints, where no native frame holds object references outside the roots:
+// allocation merely requests a collection once enough bytes were allocated, and the machine state runs it on the next method
+// entry of the outermost interpreter execution, or at GC.Collect.
+//
+// A full collection may also mark incrementally, in time-budgeted steps the host runs outside managed code or from an internal
+// call of the outermost execution. Objects allocated meanwhile stay white, and the write barrier keeps the tri-colour invariant
+// by turning the marked objects that references are stored into grey again, so they are traced once more. Roots have no barrier
+// and are marked again when the marking ends.
 class GarbageCollector
 {
   public:
+    static constexpr int32_t MAX_GENERATION = 1;
+
     static void initialize();
+    // Allow the collections requested by allocation, once the runtime no longer holds objects in native frames during startup.
+    static void enable_collections();
 
     static void* allocate_fixed(size_t size);
     static vm::RtObject** allocate_fixed_reference_array(size_t length);
@@ -27,8 +50,55 @@ class GarbageCollector
     static vm::RtObject* allocate_array(metadata::RtClass* arrClass, size_t totalBytes);
     static void write_barrier(vm::RtObject** obj_ref_location, vm::RtObject* new_obj)
     {
-        // TODO: implement write barrier
         *obj_ref_location = new_obj;
+        if (new_obj != nullptr)
+        {
+            remember_store(obj_ref_location);
+        }
+    }
+    // Call after copying data that may hold references to [dst, dst + size), which must lie within a single object.
+    static void write_barrier_range(void* dst, size_t size)
+    {
+        if (size != 0)
+        {
+            remember_store(dst);
+        }
+    }
+
+    // Ask for a collection of the generations up to `generation` at the next safepoint.
+    static void request_collection(int32_t generation);
+    static bool is_collection_requested();
+    // Run the requested collection at once, a full one if none is pending, or finish the incremental collection in progress.
+    // Callers must be at a safepoint.
+    static void collect();
+    // Advance the incremental collection in progress, or start one if a full collection is due, for about budget_us
+    // microseconds. A due minor collection runs at once instead. Returns whether an incremental collection is left unfinished.
+    static bool step(int64_t budget_us);
+
+    // Used by the root markers of the runtime while a collection marks.
+    static void mark_object(vm::RtObject* obj);
+    // Mark the objects that pointer-aligned words of [begin, end) point into, for roots whose slot types are unknown.
+    static void mark_range_conservatively(const void* begin, const void* end);
+    static bool is_marked(const vm::RtObject* obj);
+
+    static int32_t get_generation(const vm::RtObject* obj);
+    static int32_t get_collection_count(int32_t generation);
+    // Bytes of the objects allocated and not yet collected.
+    static size_t get_heap_size();
+    static size_t get_total_allocated_bytes();
+
+  private:
+    static void remember_store(void* location)
+    {
+        if (s_store_buffer_cursor == s_store_buffer_end)
+        {
+            flush_store_buffer();
+        }
+        *s_store_buffer_cursor++ = location;
     }
+    static void flush_store_buffer();
+
+    static void** s_store_buffer_cursor;
+    static void** s_store_buffer_end;
 };
 } // namespace leanclr::gc
@@ -0,0 +1,556 @@
+#include <algorithm>
+#include <cstring>
+
+#include "object_heap.h"
+#include "alloc/general_allocation.h"
+#include "utils/mem_op.h"
+#include "utils/rt_vector.h"
+#include "vm/rt_managed_types.h"
+
+namespace leanclr::gc
+{
+
+constexpr size_t CELL_GRANULE = 8;
+constexpr size_t MAX_CELLS_PER_PAGE = ObjectHeap::HEAP_PAGE_SIZE / CELL_GRANULE;
+// one spare page per chunk absorbs the alignment of the others
+constexpr size_t HEAP_PAGES_PER_CHUNK = 16;
+constexpr size_t FIXED_BLOCK_SIZE = 64 * 1024;
+constexpr size_t MAX_SHARED_FIXED_SIZE = FIXED_BLOCK_SIZE / 4;
+
+// Granule steps up to 128 bytes, then four classes per doubling, which wastes at most 12.5% of a cell.
+static constexpr uint32_t SIZE_CLASS_CELL_SIZES[] = {
+    8,   16,  24,  32,  40,  48,  56,  64,  72,  80,  88,  96,   104,  112,  120,  128,  144,  160,  176,  192,  208,  224,  240,  256,
+    288, 320, 352, 384, 416, 448, 480, 512, 576, 640, 704, 768, 832, 896, 960, 1024, 1152, 1280, 1408, 1536, 1664, 1792, 1920, 2048,
+};
+constexpr size_t SIZE_CLASS_COUNT = sizeof(SIZE_CLASS_CELL_SIZES) / sizeof(SIZE_CLASS_CELL_SIZES[0]);
+static_assert(SIZE_CLASS_CELL_SIZES[SIZE_CLASS_COUNT - 1] == ObjectHeap::MAX_SMALL_OBJECT_SIZE, "the largest size class must hold every small object");
+
+// A free cell keeps the class word of an object null, so allocated cells are told from free ones by their class.
+struct FreeCell
+{
+    void* klass;
+    FreeCell* next;
+};
+
+struct HeapPage
+{
+    // next page of the size class that has free cells
+    HeapPage* next;
+    uint8_t* bump;
+    uint8_t* end;
+    FreeCell* free_list;
+    uint32_t cell_size;
+    uint16_t size_class;
+    // allocated from since the last collection, so holding young objects
+    bool young;
+    uint8_t mark_bits[MAX_CELLS_PER_PAGE / 8];
+    uint8_t remembered_bits[MAX_CELLS_PER_PAGE / 8];
+};
+
+constexpr size_t HEAP_PAGE_HEADER_SIZE = (sizeof(HeapPage) + 15) & ~static_cast<size_t>(15);
+
+struct SizeClass
+{
+    HeapPage* current;
+    HeapPage* available;
+};
+
+struct HeapChunk
+{
+    uint8_t* pages_begin;
+    uint8_t* pages_end;
+};
+
+struct alignas(16) LargeObjectHeader
+{
+    size_t size;
+    uint32_t marked;
+    uint32_t remembered;
+};
+
+static uint8_t s_size_to_class[ObjectHeap::MAX_SMALL_OBJECT_SIZE / CELL_GRANULE + 1];
+static SizeClass s_size_classes[SIZE_CLASS_COUNT];
+// pages serving a size class
+static utils::Vector<HeapPage*> s_pages;
+// pages a sweep found empty, with zeroed cells, ready to serve any size class
+static HeapPage* s_empty_pages = nullptr;
+// sorted by address
+static utils::Vector<HeapChunk> s_chunks;
+static uint8_t* s_unused_pages_begin = nullptr;
+static uint8_t* s_unused_pages_end = nullptr;
+// pages allocated from since the last collection
+static utils::Vector<HeapPage*> s_young_pages;
+// the large objects that survived a collection, sorted by address
+static utils::Vector<LargeObjectHeader*> s_large_objects;
+static utils::Vector<LargeObjectHeader*> s_young_large_objects;
+static uint8_t* s_fixed_block_cursor = nullptr;
+static uint8_t* s_fixed_block_end = nullptr;
+static size_t s_size = 0;
+
+static uint8_t* get_cells(HeapPage* page)
+{
+    return reinterpret_cast<uint8_t*>(page) + HEAP_PAGE_HEADER_SIZE;
+}
+
+void ObjectHeap::initialize()
+{
+    size_t size_class = 0;
+    for (size_t granules = 0; granules < sizeof(s_size_to_class); ++granules)
+    {
+        // a cell must hold the free list link, which a header-only object of the compact header does not
+        while (SIZE_CLASS_CELL_SIZES[size_class] < std::max(granules * CELL_GRANULE, sizeof(FreeCell)))
+        {
+            ++size_class;
+        }
+        s_size_to_class[granules] = static_cast<uint8_t>(size_class);
+    }
+}
+
+static bool compare_chunk_address(const HeapChunk& a, const HeapChunk& b)
+{
+    return a.pages_begin < b.pages_begin;
+}
+
+static HeapPage* carve_page()
+{
+    if (s_unused_pages_begin == s_unused_pages_end)
+    {
+        const size_t page_size = ObjectHeap::HEAP_PAGE_SIZE;
+        uint8_t* raw = static_cast<uint8_t*>(alloc::GeneralAllocation::calloc((HEAP_PAGES_PER_CHUNK + 1) * page_size, 1));
+        uint8_t* pages_begin = reinterpret_cast<uint8_t*>(utils::MemOp::align_up(reinterpret_cast<size_t>(raw), page_size));
+        s_unused_pages_begin = pages_begin;
+        s_unused_pages_end = pages_begin + HEAP_PAGES_PER_CHUNK * page_size;
+        s_chunks.push_back({s_unused_pages_begin, s_unused_pages_end});
+        std::sort(s_chunks.begin(), s_chunks.end(), compare_chunk_address);
+    }
+    HeapPage* page = reinterpret_cast<HeapPage*>(s_unused_pages_begin);
+    s_unused_pages_begin += ObjectHeap::HEAP_PAGE_SIZE;
+    return page;
+}
+
+static HeapPage* new_page(uint32_t size_class)
+{
+    HeapPage* page = s_empty_pages;
+    if (page)
+    {
+        s_empty_pages = page->next;
+    }
+    else
+    {
+        page = carve_page();
+    }
+    const uint32_t cell_size = SIZE_CLASS_CELL_SIZES[size_class];
+    uint8_t* cells = get_cells(page);
+    const size_t cell_count = (ObjectHeap::HEAP_PAGE_SIZE - HEAP_PAGE_HEADER_SIZE) / cell_size;
+    page->next = nullptr;
+    page->bump = cells;
+    page->end = cells + cell_count * cell_size;
+    page->free_list = nullptr;
+    page->cell_size = cell_size;
+    page->size_class = static_cast<uint16_t>(size_class);
+    s_pages.push_back(page);
+    return page;
+}
+
+static vm::RtObject* allocate_large(size_t size)
+{
+    LargeObjectHeader* header = static_cast<LargeObjectHeader*>(alloc::GeneralAllocation::calloc(sizeof(LargeObjectHeader) + size, 1));
+    header->size = size;
+    s_young_large_objects.push_back(header);
+    s_size += size;
+    return reinterpret_cast<vm::RtObject*>(header + 1);
+}
+
+vm::RtObject* ObjectHeap::allocate(size_t size)
+{
+    if (size > MAX_SMALL_OBJECT_SIZE)
+    {
+        return allocate_large(size);
+    }
+    const uint32_t size_class = s_size_to_class[(size + CELL_GRANULE - 1) / CELL_GRANULE];
+    SizeClass& sc = s_size_classes[size_class];
+    while (true)
+    {
+        HeapPage* page = sc.current;
+        if (page)
+        {
+            FreeCell* cell = page->free_list;
+            if (cell)
+            {
+                page->free_list = cell->next;
+                cell->next = nullptr;
+                s_size += page->cell_size;
+                return reinterpret_cast<vm::RtObject*>(cell);
+            }
+            uint8_t* bump = page->bump;
+            if (bump != page->end)
+            {
+                page->bump = bump + page->cell_size;
+                s_size += page->cell_size;
+                return reinterpret_cast<vm::RtObject*>(bump);
+            }
+        }
+        // the exhausted page is left alone until the next sweep finds free cells in it
+        if (sc.available)
+        {
+            page = sc.available;
+            sc.available = page->next;
+        }
+        else
+        {
+            page = new_page(size_class);
+        }
+        if (!page->young)
+        {
+            page->young = true;
+            s_young_pages.push_back(page);
+        }
+        sc.current = page;
+    }
+}
+
+void* ObjectHeap::allocate_fixed(size_t size)
+{
+    size = utils::MemOp::align_up(size, CELL_GRANULE);
+    if (size > MAX_SHARED_FIXED_SIZE)
+    {
+        return alloc::GeneralAllocation::malloc_zeroed(size);
+    }
+    if (static_cast<size_t>(s_fixed_block_end - s_fixed_block_cursor) < size)
+    {
+        s_fixed_block_cursor = static_cast<uint8_t*>(alloc::GeneralAllocation::malloc_zeroed(FIXED_BLOCK_SIZE));
+        s_fixed_block_end = s_fixed_block_cursor + FIXED_BLOCK_SIZE;
+    }
+    void* data = s_fixed_block_cursor;
+    s_fixed_block_cursor += size;
+    return data;
+}
+
+// The page of a small object, or null for addresses outside the chunks.
+static HeapPage* find_page(uintptr_t address)
+{
+    const uint8_t* ptr = reinterpret_cast<const uint8_t*>(address);
+    size_t low = 0;
+    size_t high = s_chunks.size();
+    while (low < high)
+    {
+        const size_t mid = (low + high) / 2;
+        if (ptr < s_chunks[mid].pages_begin)
+        {
+            high = mid;
+        }
+        else if (ptr >= s_chunks[mid].pages_end)
+        {
+            low = mid + 1;
+        }
+        else
+        {
+            return reinterpret_cast<HeapPage*>(address & ~static_cast<uintptr_t>(ObjectHeap::HEAP_PAGE_SIZE - 1));
+        }
+    }
+    return nullptr;
+}
+
+static size_t get_cell_index(HeapPage* page, uintptr_t address)
+{
+    return (address - reinterpret_cast<uintptr_t>(get_cells(page))) / page->cell_size;
+}
+
+static bool test_and_set_bit(uint8_t* bits, size_t index)
+{
+    const uint8_t bit = static_cast<uint8_t>(1u << (index % 8));
+    if (bits[index / 8] & bit)
+    {
+        return false;
+    }
+    bits[index / 8] |= bit;
+    return true;
+}
+
+static LargeObjectHeader* get_large_object_header(const vm::RtObject* obj)
+{
+    return reinterpret_cast<LargeObjectHeader*>(const_cast<vm::RtObject*>(obj)) - 1;
+}
+
+static bool compare_large_object_address(const LargeObjectHeader* a, const LargeObjectHeader* b)
+{
+    return a < b;
+}
+
+void ObjectHeap::prepare_for_marking()
+{
+    std::sort(s_young_large_objects.begin(), s_young_large_objects.end(), compare_large_object_address);
+}
+
+void ObjectHeap::clear_marks()
+{
+    for (size_t i = 0; i < s_pages.size(); ++i)
+    {
+        std::memset(s_pages[i]->mark_bits, 0, sizeof(s_pages[i]->mark_bits));
+    }
+    for (size_t i = 0; i < s_large_objects.size(); ++i)
+    {
+        s_large_objects[i]->marked = 0;
+    }
+}
+
+bool ObjectHeap::try_mark(vm::RtObject* obj)
+{
+    const uintptr_t address = reinterpret_cast<uintptr_t>(obj);
+    HeapPage* page = find_page(address);
+    if (page)
+    {
+        return test_and_set_bit(page->mark_bits, get_cell_index(page, address));
+    }
+    LargeObjectHeader* header = get_large_object_header(obj);
+    if (header->marked)
+    {
+        return false;
+    }
+    header->marked = 1;
+    return true;
+}
+
+bool ObjectHeap::is_marked(const vm::RtObject* obj)
+{
+    const uintptr_t address = reinterpret_cast<uintptr_t>(obj);
+    HeapPage* page = find_page(address);
+    if (page)
+    {
+        const size_t index = get_cell_index(page, address);
+        return (page->mark_bits[index / 8] & (1u << (index % 8))) != 0;
+    }
+    return get_large_object_header(obj)->marked != 0;
+}
+
+bool ObjectHeap::try_remember(vm::RtObject* obj)
+{
+    const uintptr_t address = reinterpret_cast<uintptr_t>(obj);
+    HeapPage* page = find_page(address);
+    if (page)
+    {
+        return test_and_set_bit(page->remembered_bits, get_cell_index(page, address));
+    }
+    LargeObjectHeader* header = get_large_object_header(obj);
+    if (header->remembered)
+    {
+        return false;
+    }
+    header->remembered = 1;
+    return true;
+}
+
+void ObjectHeap::forget(vm::RtObject* obj)
+{
+    const uintptr_t address = reinterpret_cast<uintptr_t>(obj);
+    HeapPage* page = find_page(address);
+    if (page)
+    {
+        const size_t index = get_cell_index(page, address);
+        page->remembered_bits[index / 8] &= static_cast<uint8_t>(~(1u << (index % 8)));
+        return;
+    }
+    get_large_object_header(obj)->remembered = 0;
+}
+
+// The allocated cell of a small object page containing address, or null.
+static vm::RtObject* find_cell_containing(HeapPage* page, uintptr_t address)
+{
+    // pages never handed out are still zero
+    const uintptr_t cells = reinterpret_cast<uintptr_t>(get_cells(page));
+    if (page->cell_size == 0 || address < cells || address >= reinterpret_cast<uintptr_t>(page->bump))
+    {
+        return nullptr;
+    }
+    vm::RtObject* obj = reinterpret_cast<vm::RtObject*>(cells + (address - cells) / page->cell_size * page->cell_size);
+    return obj->klass ? obj : nullptr;
+}
+
+// Searches large objects sorted by address.
+static vm::RtObject* find_large_object_containing(const utils::Vector<LargeObjectHeader*>& large_objects, uintptr_t address)
+{
+    LargeObjectHeader* const* begin = large_objects.data();
+    LargeObjectHeader* const* end = begin + large_objects.size();
+    LargeObjectHeader* const* it = std::upper_bound(begin, end, reinterpret_cast<LargeObjectHeader*>(address), compare_large_object_address);
+    if (it == begin)
+    {
+        return nullptr;
+    }
+    LargeObjectHeader* header = *(it - 1);
+    const uintptr_t obj_begin = reinterpret_cast<uintptr_t>(header + 1);
+    if (address < obj_begin || address >= obj_begin + header->size)
+    {
+        return nullptr;
+    }
+    return reinterpret_cast<vm::RtObject*>(header + 1);
+}
+
+vm::RtObject* ObjectHeap::find_object_containing(uintptr_t address)
+{
+    HeapPage* page = find_page(address);
+    if (page)
+    {
+        return find_cell_containing(page, address);
+    }
+    vm::RtObject* obj = find_large_object_containing(s_large_objects, address);
+    return obj ? obj : find_large_object_containing(s_young_large_objects, address);
+}
+
+vm::RtObject* ObjectHeap::find_marked_object_containing(uintptr_t address)
+{
+    HeapPage* page = find_page(address);
+    vm::RtObject* obj = page ? find_cell_containing(page, address) : find_large_object_containing(s_large_objects, address);
+    return obj && is_marked(obj) ? obj : nullptr;
+}
+
+// Returns the number of live cells. Freed cells are zeroed here so that allocation does not have to, the marks of the live
+// ones are kept.
+static size_t sweep_page(HeapPage* page)
+{
+    uint8_t* cells = get_cells(page);
+    const uint32_t cell_size = page->cell_size;
+    FreeCell* free_list = nullptr;
+    FreeCell** free_tail = &free_list;
+    size_t live_count = 0;
+    size_t index = 0;
+    for (uint8_t* cell = cells; cell < page->bump; cell += cell_size, ++index)
+    {
+        FreeCell* free_cell = reinterpret_cast<FreeCell*>(cell);
+        if (free_cell->klass != nullptr)
+        {
+            if (page->mark_bits[index / 8] & (1u << (index % 8)))
+            {
+                ++live_count;
+                continue;
+            }
+            std::memset(cell, 0, cell_size);
+            s_size -= cell_size;
+        }
+        *free_tail = free_cell;
+        free_tail = &free_cell->next;
+    }
+    *free_tail = nullptr;
+
+    if (live_count == 0)
+    {
+        // an empty page goes back to zero cells and may serve another size class
+        while (free_list)
+        {
+            FreeCell* next = free_list->next;
+            free_list->next = nullptr;
+            free_list = next;
+        }
+        page->bump = cells;
+    }
+    page->free_list = free_list;
+    return live_count;
+}
+
+// Frees the unmarked large objects and returns the number of live ones, which are moved to the front.
+static size_t sweep_large_objects(utils::Vector<LargeObjectHeader*>& large_objects)
+{
+    size_t live_count = 0;
+    for (size_t i = 0; i < large_objects.size(); ++i)
+    {
+        LargeObjectHeader* header = large_objects[i];
+        if (header->marked)
+        {
+            large_objects[live_count++] = header;
+        }
+        else
+        {
+            s_size -= header->size;
+            alloc::GeneralAllocation::free(header);
+        }
+    }
+    large_objects.resize(live_count);
+    return live_count;
+}
+
+static void promote_young_large_objects()
+{
+    const size_t old_count = s_large_objects.size();
+    for (size_t i = 0; i < s_young_large_objects.size(); ++i)
+    {
+        s_large_objects.push_back(s_young_large_objects[i]);
+    }
+    s_young_large_objects.clear();
+    // both runs are sorted already
+    std::inplace_merge(s_large_objects.begin(), s_large_objects.begin() + old_count, s_large_objects.end(), compare_large_object_address);
+}
+
+void ObjectHeap::prepare_for_incremental_marking()
+{
+    prepare_for_marking();
+    promote_young_large_objects();
+}
+
+static void reset_allocation_pages()
+{
+    for (size_t i = 0; i < SIZE_CLASS_COUNT; ++i)
+    {
+        s_size_classes[i].current = nullptr;
+    }
+    for (size_t i = 0; i < s_young_pages.size(); ++i)
+    {
+        s_young_pages[i]->young = false;
+    }
+    s_young_pages.clear();
+}
+
+static void make_page_available(HeapPage* page)
+{
+    if (page->free_list || page->bump != page->end)
+    {
+        SizeClass& sc = s_size_classes[page->size_class];
+        page->next = sc.available;
+        sc.available = page;
+    }
+}
+
+void ObjectHeap::sweep()
+{
+    reset_allocation_pages();
+    for (size_t i = 0; i < SIZE_CLASS_COUNT; ++i)
+    {
+        s_size_classes[i].available = nullptr;
+    }
+    size_t kept_count = 0;
+    for (size_t i = 0; i < s_pages.size(); ++i)
+    {
+        HeapPage* page = s_pages[i];
+        if (sweep_page(page) == 0)
+        {
+            page->next = s_empty_pages;
+            s_empty_pages = page;
+            continue;
+        }
+        s_pages[kept_count++] = page;
+        make_page_available(page);
+    }
+    s_pages.resize(kept_count);
+    sweep_large_objects(s_large_objects);
+    sweep_large_objects(s_young_large_objects);
+    promote_young_large_objects();
+}
+
+void ObjectHeap::sweep_young()
+{
+    // the other pages hold old objects only, which keep their marks, and are on the available lists already if they have
+    // free cells; an emptied young page stays with its size class
+    for (size_t i = 0; i < s_young_pages.size(); ++i)
+    {
+        HeapPage* page = s_young_pages[i];
+        sweep_page(page);
+        make_page_available(page);
+    }
+    reset_allocation_pages();
+    sweep_large_objects(s_young_large_objects);
+    promote_young_large_objects();
+}
+
+size_t ObjectHeap::get_size()
+{
+    return s_size;
+}
+} // namespace leanclr::gc
@@ -0,0 +1,61 @@
+#pragma once
+
+#include "rt_base.h"
+
+namespace leanclr::vm
+{
+struct RtObject;
+}
+
+namespace leanclr::gc
+{
+
+// Segregated-fit heap of the collector.
+//
+// Objects up to MAX_SMALL_OBJECT_SIZE bytes live in cells of HEAP_PAGE_SIZE aligned pages that each serve one size class.
+// A page hands out cells from its free list first and bumps through its never used cells after that. Pages and the cells freed
+// by sweeps are zeroed ahead of time, so allocation does no zeroing. Cells carry no header: a free cell has a null class word
+// and the mark bits of a page live in the page header. Larger objects are allocated one by one in the large object space.
+//
+// Marks are sticky: a sweep keeps the marks of the objects it leaves alive, so between collections a marked object is an old
+// one and an unmarked one was allocated since the last collection. The young objects are the nursery that minor collections
+// mark and sweep alone; the pages holding them are the ones allocated from since the last collection.
+class ObjectHeap
+{
+  public:
+    static constexpr size_t HEAP_PAGE_SIZE = 32 * 1024;
+    static constexpr size_t MAX_SMALL_OBJECT_SIZE = 2048;
+
+    static void initialize();
+
+    // Zeroed memory for an object of `size` bytes. The caller sets its class at once, a null class marks free cells.
+    static vm::RtObject* allocate(size_t size);
+    // Zeroed memory that is never freed, bump allocated from blocks shared by small requests.
+    static void* allocate_fixed(size_t size);
+
+    // Order the large object space for find_object_containing(). Called before a collection marks.
+    static void prepare_for_marking();
+    // Also move the large objects allocated so far to the old ones, where find_marked_object_containing() finds them while the
+    // mutator keeps allocating during an incremental collection.
+    static void prepare_for_incremental_marking();
+    // Forget all marks before a full collection, which makes every object young again.
+    static void clear_marks();
+    // Mark obj, returning false if it was marked already.
+    static bool try_mark(vm::RtObject* obj);
+    static bool is_marked(const vm::RtObject* obj);
+    // The allocated object whose memory contains address, or null.
+    static vm::RtObject* find_object_containing(uintptr_t address);
+    // The marked object whose memory contains address, or null. Between collections these are the old objects.
+    static vm::RtObject* find_marked_object_containing(uintptr_t address);
+    // Flag an old object for the remembered set, returning false if it was flagged already.
+    static bool try_remember(vm::RtObject* obj);
+    static void forget(vm::RtObject* obj);
+    // Free the unmarked objects of the whole heap.
+    static void sweep();
+    // Free the unmarked objects allocated since the last collection.
+    static void sweep_young();
+
+    // Bytes of the cells and large objects holding objects.
+    static size_t get_size();
+};
+} // namespace leanclr::gc
@@ -4,6 +4,7 @@
 #include "vm/object.h"
 #include "vm/class.h"
 #include "vm/array_class.h"
+#include "gc/garbage_collector.h"
 #include <cstring>
 
 namespace leanclr::icalls
@@ -143,12 +144,17 @@ RtResultVoid SystemArray::set_value_impl(vm::RtArray* arr, vm::RtObject* value,
             RET_ERR(RtErr::NullReference);
 
         void* ele_ptr = vm::Array::get_array_element_address_as_ptr_void(arr, global_index);
-        return vm::Object::unbox_any(value, ele_klass, ele_ptr, false);
+        RET_ERR_ON_FAIL(vm::Object::unbox_any(value, ele_klass, ele_ptr, false));
+        if (vm::Class::get_has_references(ele_klass))
+        {
+            gc::GarbageCollector::write_barrier_range(ele_ptr, vm::Array::get_array_element_size(arr));
+        }
+        RET_VOID_OK();
     }
     else
     {
         // Set reference type directly
-        vm::Array::set_array_data_at<vm::RtObject*>(arr, global_index, value);
+        gc::GarbageCollector::write_barrier(vm::Array::get_array_element_address<vm::RtObject*>(arr, global_index), value);
         RET_VOID_OK();
     }
 }
@@ -202,6 +208,10 @@ RtResult<bool> SystemArray::fast_copy(vm::RtArray* src, int32_t src_index, vm::R
             std::memcpy(static_cast<uint8_t*>(dst_data_ptr) + dst_index * ele_size, static_cast<const uint8_t*>(src_data_ptr) + src_index * ele_size,
                         length * ele_size);
         }
+        if (vm::Class::get_has_references(dst_klass))
+        {
+            gc::GarbageCollector::write_barrier_range(static_cast<uint8_t*>(dst_data_ptr) + dst_index * ele_size, length * ele_size);
+        }
         RET_OK(true);
     }
 
@@ -225,6 +235,10 @@ RtResult<bool> SystemArray::fast_copy(vm::RtArray* src, int32_t src_index, vm::R
 
         std::memcpy(static_cast<uint8_t*>(dst_data_ptr) + dst_index * src_ele_size, static_cast<const uint8_t*>(src_data_ptr) + src_index * src_ele_size,
                     length * src_ele_size);
+        if (vm::Class::get_has_references(dst_klass))
+        {
+            gc::GarbageCollector::write_barrier_range(static_cast<uint8_t*>(dst_data_ptr) + dst_index * src_ele_size, length * src_ele_size);
+        }
     }
     else
     {
@@ -234,6 +248,7 @@ RtResult<bool> SystemArray::fast_copy(vm::RtArray* src, int32_t src_index, vm::R
 
         std::memcpy(static_cast<vm::RtObject**>(dst_data_ptr) + dst_index, static_cast<vm::RtObject* const*>(src_data_ptr) + src_index,
                     length * sizeof(vm::RtObject*));
+        gc::GarbageCollector::write_barrier_range(static_cast<vm::RtObject**>(dst_data_ptr) + dst_index, length * sizeof(vm::RtObject*));
     }
 
     RET_OK(true);
@@ -1,4 +1,5 @@
 #include "system_runtime_runtimeimports.h"
+#include "gc/garbage_collector.h"
 #include <cstring>
 
 namespace leanclr::icalls
@@ -41,8 +42,8 @@ static RtResultVoid memmove_invoker(RtManagedMethodPointer method_pointer, const
 // @icall: System.Runtime.RuntimeImports::Memmove_wbarrier
 RtResultVoid SystemRuntimeRuntimeImports::memmove_wbarrier(uint8_t* dest, const uint8_t* src, uintptr_t size)
 {
-    // FIXME: implement write barrier
     std::memmove(dest, src, size);
+    gc::GarbageCollector::write_barrier_range(dest, size);
     RET_VOID_OK();
 }
 
@@ -1,5 +1,6 @@
 #include "system_threading_interlocked.h"
 #include "interp/eval_stack_op.h"
+#include "gc/garbage_collector.h"
 #include <cstdint>
 #include <cstring>
 
@@ -121,7 +122,7 @@ RtResultVoid SystemThreadingInterlocked::compare_exchange_object2(RtObject** loc
     RtObject* old = *location;
     if (old == *comparand)
     {
-        *location = *value;
+        gc::GarbageCollector::write_barrier(location, *value);
     }
     *result = old;
     RET_VOID_OK();
@@ -136,7 +137,7 @@ RtResult<RtObject*> SystemThreadingInterlocked::compare_exchange_object(RtObject
     RtObject* old = *location;
     if (old == comparand)
     {
-        *location = value;
+        gc::GarbageCollector::write_barrier(location, value);
     }
     RET_OK(old);
 }
@@ -240,7 +241,7 @@ RtResultVoid SystemThreadingInterlocked::exchange_object(RtObject** location, Rt
         RET_ERR(RtErr::NullReference);
     }
     RtObject* old = *location;
-    *location = *value;
+    gc::GarbageCollector::write_barrier(location, *value);
     *result = old;
     RET_VOID_OK();
 }
@@ -6,6 +6,7 @@
 #include "vm/rt_string.h"
 #include "vm/appdomain.h"
 #include "utils/string_util.h"
+#include "gc/garbage_collector.h"
 
 #include <cstring>
 
@@ -301,7 +302,7 @@ RtResultVoid SystemThreadingThread::volatile_write_uintptr(uintptr_t* loc, uintp
 
 RtResultVoid SystemThreadingThread::volatile_write_object(vm::RtObject** loc, vm::RtObject* val)
 {
-    *loc = val;
+    gc::GarbageCollector::write_barrier(loc, val);
     RET_VOID_OK();
 }
 
@@ -3,7 +3,7 @@
 namespace leanclr::interp
 {
 BasicBlockSplitter::BasicBlockSplitter(const metadata::RtMethodBody* method_body, alloc::MemPool* pool)
-    : _method_body(method_body), _split_offsets(), _valid_il_offsets(nullptr), _valid_il_offsets_count(0)
+    : _method_body(method_body), _split_offsets(), _backward_branch_target_offsets(), _valid_il_offsets(nullptr), _valid_il_offsets_count(0)
 {
     assert(pool != nullptr);
     const size_t code_size = method_body ? static_cast<size_t>(method_body->code_size) : 0;
@@ -28,6 +28,11 @@ const utils::HashSet<size_t>& BasicBlockSplitter::get_split_offsets() const
     return _split_offsets;
 }
 
+const utils::HashSet<size_t>& BasicBlockSplitter::get_backward_branch_target_offsets() const
+{
+    return _backward_branch_target_offsets;
+}
+
 void BasicBlockSplitter::mark_valid_il_offset(size_t offset)
 {
     const size_t index = offset >> 5;
@@ -96,6 +101,10 @@ RtResultVoid BasicBlockSplitter::split_codes()
             {
                 _split_offsets.insert(next_offset);
                 _split_offsets.insert(next_offset + target_offset);
+                if (next_offset + target_offset <= offset)
+                {
+                    _backward_branch_target_offsets.insert(next_offset + target_offset);
+                }
             }
             break;
         }
@@ -113,6 +122,10 @@ RtResultVoid BasicBlockSplitter::split_codes()
                 if (case_offset != 0)
                 {
                     _split_offsets.insert(next_offset + case_offset);
+                    if (next_offset + case_offset <= offset)
+                    {
+                        _backward_branch_target_offsets.insert(next_offset + case_offset);
+                    }
                     split_any = true;
                 }
             }
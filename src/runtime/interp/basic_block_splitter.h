@@ -16,6 +16,8 @@ class BasicBlockSplitter
     RtResultVoid split();
 
     const utils::HashSet<size_t>& get_split_offsets() const;
+    // Offsets of the blocks that a branch at or after them jumps to, so they are reached after being transformed.
+    const utils::HashSet<size_t>& get_backward_branch_target_offsets() const;
 
   private:
     void mark_valid_il_offset(size_t offset);
@@ -27,6 +29,7 @@ class BasicBlockSplitter
 
     const metadata::RtMethodBody* _method_body;
     utils::HashSet<size_t> _split_offsets;
+    utils::HashSet<size_t> _backward_branch_target_offsets;
     uint32_t* _valid_il_offsets;
     size_t _valid_il_offsets_count;
 };
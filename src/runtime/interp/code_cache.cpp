@@ -0,0 +1,147 @@
+#include "code_cache.h"
+#include "machine_state.h"
+#include "alloc/mem_pool.h"
+#include "metadata/module_def.h"
+#include "utils/hashset.h"
+#include "utils/rt_vector.h"
+#include "vm/settings.h"
+
+namespace leanclr::interp
+{
+
+// most methods need a few hundred bytes of IR, larger ones get one more region of exactly their size
+constexpr size_t METHOD_CODE_POOL_INITIAL_SIZE = 512;
+constexpr size_t METHOD_CODE_POOL_PAGE_SIZE = 64;
+
+struct CodeCacheEntry
+{
+    const metadata::RtMethodInfo* method;
+    RtInterpMethodInfo* imi;
+    size_t size;
+};
+
+// An entry whose imi is no longer the interp_data of its method was replaced by tier-up and is freed as soon as no frame
+// runs it, regardless of the clock.
+static utils::Vector<CodeCacheEntry> s_entries;
+static size_t s_clock_hand = 0;
+static size_t s_resident_bytes = 0;
+static size_t s_resident_method_count = 0;
+static size_t s_eviction_count = 0;
+
+static bool is_replaced(const CodeCacheEntry& entry)
+{
+    return entry.method->interp_data != entry.imi;
+}
+
+static void free_entry(size_t index)
+{
+    CodeCacheEntry& entry = s_entries[index];
+    if (!is_replaced(entry))
+    {
+        const_cast<metadata::RtMethodInfo*>(entry.method)->interp_data = nullptr;
+        --s_resident_method_count;
+        ++s_eviction_count;
+    }
+    s_resident_bytes -= entry.size;
+    // the method info lives in the pool it points to
+    alloc::GeneralAllocation::delete_any(entry.imi->code_pool);
+    entry = s_entries[s_entries.size() - 1];
+    s_entries.pop_back();
+}
+
+static void evict_until_within_budget(size_t budget, const RtInterpMethodInfo* installing_imi)
+{
+    utils::HashSet<const RtInterpMethodInfo*> running_imis;
+    utils::Span<const InterpFrame> frames = MachineState::get_global_machine_state().get_active_frames();
+    for (size_t i = 0; i < frames.size(); ++i)
+    {
+        running_imis.insert(frames[i].imi);
+    }
+
+    // two rounds clear every recently used flag once, so the sweep ends even when nothing can be evicted
+    size_t steps_left = s_entries.size() * 2;
+    while (s_resident_bytes > budget && steps_left > 0 && !s_entries.empty())
+    {
+        --steps_left;
+        if (s_clock_hand >= s_entries.size())
+        {
+            s_clock_hand = 0;
+        }
+        CodeCacheEntry& entry = s_entries[s_clock_hand];
+        if (entry.imi == installing_imi || running_imis.find(entry.imi) != running_imis.end())
+        {
+            ++s_clock_hand;
+            continue;
+        }
+        if (entry.imi->recently_used && !is_replaced(entry))
+        {
+            entry.imi->recently_used = false;
+            ++s_clock_hand;
+            continue;
+        }
+        // the last entry moves into the freed slot, which the hand visits next
+        free_entry(s_clock_hand);
+    }
+}
+
+void CodeCache::install(const metadata::RtMethodInfo* method, const RtInterpMethodInfo* imi)
+{
+    metadata::RtMethodInfo* mut_method = const_cast<metadata::RtMethodInfo*>(method);
+    const RtInterpMethodInfo* old_imi = method->interp_data;
+    mut_method->interp_data = imi;
+    if (old_imi && old_imi->code_pool)
+    {
+        --s_resident_method_count;
+    }
+    if (!imi->code_pool)
+    {
+        return;
+    }
+
+    RtInterpMethodInfo* mut_imi = const_cast<RtInterpMethodInfo*>(imi);
+    mut_imi->recently_used = true;
+    const size_t size = imi->code_pool->get_reserved_size();
+    s_entries.push_back({method, mut_imi, size});
+    s_resident_bytes += size;
+    ++s_resident_method_count;
+
+    const size_t budget = vm::Settings::get_ir_code_cache_budget();
+    if (budget != 0 && s_resident_bytes > budget)
+    {
+        evict_until_within_budget(budget, imi);
+    }
+}
+
+void CodeCache::get_stats(CodeCacheStats& stats)
+{
+    stats.budget = vm::Settings::get_ir_code_cache_budget();
+    stats.resident_bytes = s_resident_bytes;
+    stats.resident_method_count = s_resident_method_count;
+    stats.eviction_count = s_eviction_count;
+}
+
+MethodCodePool::MethodCodePool(metadata::RtModuleDef* mod)
+{
+    _dedicated = vm::Settings::get_ir_code_cache_budget() != 0;
+    _pool = _dedicated ? alloc::GeneralAllocation::new_any<alloc::MemPool>(METHOD_CODE_POOL_INITIAL_SIZE, METHOD_CODE_POOL_PAGE_SIZE,
+                                                                           METHOD_CODE_POOL_PAGE_SIZE)
+                       : &mod->get_mem_pool();
+}
+
+MethodCodePool::~MethodCodePool()
+{
+    if (_dedicated)
+    {
+        alloc::GeneralAllocation::delete_any(_pool);
+    }
+}
+
+void MethodCodePool::release_to(RtInterpMethodInfo* imi)
+{
+    if (_dedicated)
+    {
+        imi->code_pool = _pool;
+        _dedicated = false;
+    }
+}
+} // namespace leanclr::interp
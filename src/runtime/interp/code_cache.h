@@ -0,0 +1,50 @@
+#pragma once
+
+#include "interp_defs.h"
+
+namespace leanclr::interp
+{
+struct CodeCacheStats
+{
+    size_t budget;
+    size_t resident_bytes;
+    size_t resident_method_count;
+    size_t eviction_count;
+};
+
+// Budgeted residence of transformed methods. While vm::Settings has an IR code cache budget, the IR of every method (method
+// info, codes, resolved datas, exception clauses and inline caches) is allocated from a pool of its own instead of the module
+// pool. Installing a method that takes the resident bytes over the budget evicts cold methods with a clock sweep; methods with
+// frames on the machine state are never evicted, and evicted ones are transformed again on their next call, at the tier they
+// had reached.
+class CodeCache
+{
+  public:
+    // Makes imi the code of method. Code it replaces is freed by a later sweep once no frame runs it.
+    static void install(const metadata::RtMethodInfo* method, const RtInterpMethodInfo* imi);
+    static void get_stats(CodeCacheStats& stats);
+};
+
+// Pool the IR of one method is allocated from: the module pool without a budget, a dedicated pool with one.
+// A dedicated pool is freed on destruction unless it was released to the method info allocated from it.
+class MethodCodePool
+{
+  public:
+    explicit MethodCodePool(metadata::RtModuleDef* mod);
+    ~MethodCodePool();
+
+    MethodCodePool(const MethodCodePool&) = delete;
+    MethodCodePool& operator=(const MethodCodePool&) = delete;
+
+    alloc::MemPool& get() const
+    {
+        return *_pool;
+    }
+
+    void release_to(RtInterpMethodInfo* imi);
+
+  private:
+    alloc::MemPool* _pool;
+    bool _dedicated;
+};
+} // namespace leanclr::interp
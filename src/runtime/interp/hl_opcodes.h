@@ -177,6 +177,8 @@ enum class OpCodeEnum
     Ldsfld,
     Ldsflda,
     Stsfld,
+    CheckNull,
+    CountBackEdge,
     Call,
     CallVirt,
     CallInternalCall,
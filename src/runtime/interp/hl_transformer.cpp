@@ -15,12 +15,14 @@
 #include "utils/mem_op.h"
 #include "const_strs.h"
 
+#include <cmath>
+
 namespace leanclr::interp::hl
 {
 
 Transformer::Transformer(metadata::RtModuleDef* mod, const metadata::RtMethodInfo* method_info, const metadata::RtMethodBody& method_body,
-                         alloc::MemPool& mem_pool)
-    : _mod(mod), _method(method_info), _method_body(&method_body), _pool(&mem_pool), _vars(&mem_pool)
+                         alloc::MemPool& mem_pool, bool optimize)
+    : _mod(mod), _method(method_info), _method_body(&method_body), _pool(&mem_pool), _optimize(optimize), _vars(&mem_pool)
 {
     _generic_context = _method->generic_method ? &_method->generic_method->generic_context : nullptr;
     _generic_container_context.klass = method_info->parent->generic_container;
@@ -149,6 +151,7 @@ Variable* Transformer::create_eval_stack_variable_from_var(const Variable* var,
     eval_stack_var->byte_size = var->byte_size;
     eval_stack_var->stack_object_size = var->stack_object_size;
     eval_stack_var->eval_stack_offset = eval_stack_offset;
+    eval_stack_var->exact_klass = var->exact_klass;
     return eval_stack_var;
 }
 
@@ -594,6 +597,15 @@ RtResultVoid Transformer::setup_target_branch_eval_stack(BasicBlock* target)
             const Variable* cur_var = _cur_bb->eval_stack[i];
             if (target_var->data_type != cur_var->data_type || target_var->eval_stack_offset != cur_var->eval_stack_offset)
                 RET_ERR(RtErr::ExecutionEngine);
+            // an exact class only survives a merge when every predecessor agrees on it
+            if (target_var->exact_klass && target_var->exact_klass != cur_var->exact_klass)
+            {
+                // backward branch targets never get exact classes, so the target has not been transformed yet
+                assert(!target->visited);
+                Variable* merged_var = create_eval_stack_variable_from_var(target_var, target_var->eval_stack_offset);
+                merged_var->exact_klass = nullptr;
+                target->in_eval_stack[i] = merged_var;
+            }
         }
     }
     else
@@ -602,6 +614,20 @@ RtResultVoid Transformer::setup_target_branch_eval_stack(BasicBlock* target)
         target->inited_eval_stack = true;
         target->in_eval_stack_top = _cur_bb->eval_stack_top;
         target->in_eval_stack.push_range(_cur_bb->eval_stack.data(), cur_eval_stack_size);
+        // blocks are transformed in IL order: a backward branch may bring another class once the target relied on this one
+        if (target->backward_branch_target)
+        {
+            for (size_t i = 0; i < cur_eval_stack_size; ++i)
+            {
+                const Variable* var = target->in_eval_stack[i];
+                if (var->exact_klass)
+                {
+                    Variable* merged_var = create_eval_stack_variable_from_var(var, var->eval_stack_offset);
+                    merged_var->exact_klass = nullptr;
+                    target->in_eval_stack[i] = merged_var;
+                }
+            }
+        }
     }
     RET_VOID_OK();
 }
@@ -617,6 +643,16 @@ RtResultVoid Transformer::setup_next_and_target_branch_eval_stack(BasicBlock* ta
     RET_VOID_OK();
 }
 
+// Unoptimized code counts the backward branches it runs, so a method spinning in a loop is re-transformed with
+// optimizations on its next invocation even if it is rarely called.
+void Transformer::add_count_back_edge(ptrdiff_t target_offset)
+{
+    if (!_optimize && target_offset < 0)
+    {
+        create_add_inst(OpCodeEnum::CountBackEdge);
+    }
+}
+
 RtResultVoid Transformer::add_br(uint32_t next_offset, int32_t target_offset)
 {
     if (target_offset == 0)
@@ -629,6 +665,7 @@ RtResultVoid Transformer::add_br(uint32_t next_offset, int32_t target_offset)
     const size_t target_il_offset = next_offset + target_offset;
     DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(BasicBlock*, target_bb, get_branch_target_bb(target_il_offset));
 
+    add_count_back_edge(target_offset);
     GeneralInst* ir = create_add_inst(OpCodeEnum::Br);
     ir->set_branch_target(target_bb);
     RET_ERR_ON_FAIL(setup_target_branch_eval_stack(target_bb));
@@ -646,6 +683,7 @@ RtResultVoid Transformer::add_brtrue_or_false(uint32_t next_offset, int32_t targ
     RET_ERR_ON_FAIL(target_bb_result);
     BasicBlock* target_bb = target_bb_result.unwrap();
 
+    add_count_back_edge(target_offset);
     GeneralInst* ir = create_add_inst(is_true ? OpCodeEnum::BrTrue : OpCodeEnum::BrFalse);
     ir->set_var_src(cond_var);
     ir->set_branch_target(target_bb);
@@ -667,6 +705,7 @@ RtResultVoid Transformer::add_condition_branch(uint32_t next_offset, int32_t tar
 
     DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(BasicBlock*, target_bb, get_branch_target_bb(target_il_offset));
 
+    add_count_back_edge(target_offset);
     GeneralInst* ir = create_add_inst(opcode);
     ir->set_var_arg1(left_var);
     ir->set_var_arg2(right_var);
@@ -684,17 +723,21 @@ RtResultVoid Transformer::add_switch(uint32_t next_offset, const void* case_targ
 
     const BasicBlock** targets = _pool->calloc_any<const BasicBlock*>(count);
     bool any_not_zero_branch = false;
+    int32_t min_rel_offset = 0;
     for (size_t i = 0; i < count; ++i)
     {
         int32_t rel_offset = utils::MemOp::read_u32_may_unaligned(((const int32_t*)case_targets) + i);
         if (rel_offset != 0)
             any_not_zero_branch = true;
+        if (rel_offset < min_rel_offset)
+            min_rel_offset = rel_offset;
     }
 
     // return directly if all branches are zero offset
     if (!any_not_zero_branch)
         RET_VOID_OK();
 
+    add_count_back_edge(min_rel_offset);
     GeneralInst* ir = create_add_inst(OpCodeEnum::Switch);
     ir->set_var_arg1(key_var);
 
@@ -1170,9 +1213,392 @@ RtResultVoid Transformer::add_call_common(const metadata::RtMethodInfo* method,
 
 RtResultVoid Transformer::add_call(const metadata::RtMethodInfo* method)
 {
+#if LEANCLR_ENABLE_INLINING
+    DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(bool, inlined, try_inline_call(method));
+    if (inlined)
+    {
+        RET_VOID_OK();
+    }
+#endif
     return add_call_common(method, method->invoker_type, method->invoke_method_ptr, false, false);
 }
 
+RtResult<bool> Transformer::try_inline_call(const metadata::RtMethodInfo* method)
+{
+    // The callee's args are the call's params, already in place on the eval stack where its frame would start, and its locals
+    // are pushed right above them. Its IL is then transformed in the current basic block, against its own module and generic
+    // context. A callee using anything outside the supported straight-line subset leaves the block exactly as it was.
+    metadata::RtClass* klass = method->parent;
+    const uint16_t not_inlinable_flags =
+        static_cast<uint16_t>(metadata::RtMethodImplAttribute::NoInlining) | static_cast<uint16_t>(metadata::RtMethodImplAttribute::Synchronized);
+    if (!_optimize || _prefix != il::OpCodePrefix::None || method->invoker_type != metadata::RtInvokerType::Interpreter ||
+        (method->iflags & not_inlinable_flags) != 0 || vm::Method::is_abstract(method) || vm::Class::is_array_or_szarray(klass))
+    {
+        RET_OK(false);
+    }
+    // a static call runs the class constructor first
+    if (vm::Method::is_static(method) && vm::Class::is_cctor_not_finished(klass))
+    {
+        RET_OK(false);
+    }
+
+    metadata::RtModuleDef* callee_mod = klass->image;
+    auto ret_method_body = callee_mod->read_method_body(method->token);
+    if (ret_method_body.is_err() || !ret_method_body.unwrap())
+    {
+        RET_OK(false);
+    }
+    const metadata::RtMethodBody& method_body = ret_method_body.unwrap().value();
+    if (method_body.code_size > LEANCLR_INLINE_MAX_IL_SIZE || !method_body.exception_clauses.empty())
+    {
+        RET_OK(false);
+    }
+    const size_t param_count = vm::Method::get_param_count_include_this(method);
+    if (_cur_bb->eval_stack.size() < param_count)
+    {
+        RET_ERR(RtErr::ExecutionEngine);
+    }
+
+    const size_t saved_inst_count = _cur_bb->insts.size();
+    const size_t saved_eval_stack_size = _cur_bb->eval_stack.size();
+    const size_t saved_eval_stack_top = _cur_bb->eval_stack_top;
+    const size_t frame_base_idx = saved_eval_stack_size - param_count;
+    // the body may replace the params' slots (the return value takes the place of the first one), so they are kept for a rollback
+    const Variable** saved_params = param_count > 0 ? _pool->calloc_any<const Variable*>(param_count) : nullptr;
+    for (size_t i = 0; i < param_count; ++i)
+    {
+        saved_params[i] = _cur_bb->eval_stack[frame_base_idx + i];
+    }
+
+    metadata::RtModuleDef* caller_mod = _mod;
+    const metadata::RtGenericContext* caller_generic_context = _generic_context;
+    const metadata::RtGenericContainerContext caller_generic_container_context = _generic_container_context;
+    const Variable** caller_arg_vars = _arg_vars;
+    const size_t caller_arg_vars_count = _arg_vars_count;
+    const Variable** caller_local_vars = _local_vars;
+    const size_t caller_local_vars_count = _local_vars_count;
+    utils::HashMap<uint32_t, metadata::RtRuntimeHandle> callee_runtime_handle_cache;
+
+    _mod = callee_mod;
+    _generic_context = method->generic_method ? &method->generic_method->generic_context : nullptr;
+    _generic_container_context.klass = klass->generic_container;
+    _generic_container_context.method = method->generic_container;
+    _runtime_handle_cache.swap(callee_runtime_handle_cache);
+
+    auto ret = add_inlined_body(method, method_body, frame_base_idx);
+
+    _mod = caller_mod;
+    _generic_context = caller_generic_context;
+    _generic_container_context = caller_generic_container_context;
+    _runtime_handle_cache.swap(callee_runtime_handle_cache);
+    _arg_vars = caller_arg_vars;
+    _arg_vars_count = caller_arg_vars_count;
+    _local_vars = caller_local_vars;
+    _local_vars_count = caller_local_vars_count;
+    clear_prefix();
+
+    if (ret.is_err())
+    {
+        _cur_bb->insts.resize_uninitialized(saved_inst_count);
+        _cur_bb->eval_stack.resize_uninitialized(frame_base_idx);
+        _cur_bb->eval_stack.push_range(saved_params, param_count);
+        _cur_bb->eval_stack_top = saved_eval_stack_top;
+        RET_OK(false);
+    }
+    RET_OK(true);
+}
+
+RtResultVoid Transformer::add_inlined_body(const metadata::RtMethodInfo* method, const metadata::RtMethodBody& method_body, size_t frame_base_idx)
+{
+    const size_t param_count = _cur_bb->eval_stack.size() - frame_base_idx;
+    const size_t frame_base = _cur_bb->eval_stack[frame_base_idx]->eval_stack_offset;
+
+    // args get the declared types of the callee's params, so that they are read and stored with the callee's widths
+    const Variable** arg_vars = param_count > 0 ? _pool->calloc_any<const Variable*>(param_count) : nullptr;
+    const size_t arg_base_idx = vm::Method::is_instance(method) ? 1 : 0;
+    for (size_t i = 0; i < param_count; ++i)
+    {
+        const metadata::RtTypeSig* type_sig;
+        if (i < arg_base_idx)
+            type_sig = vm::Class::is_value_type(method->parent) ? method->parent->by_ref : method->parent->by_val;
+        else
+            type_sig = method->parameters[i - arg_base_idx];
+        const Variable* param = _cur_bb->eval_stack[frame_base_idx + i];
+        DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(const Variable*, arg_var, alloc_variable_by_typesig(type_sig, param->eval_stack_offset));
+        if (arg_var->stack_object_size != param->stack_object_size)
+            RET_ERR(RtErr::NotSupported);
+        arg_vars[i] = arg_var;
+    }
+    _arg_vars = arg_vars;
+    _arg_vars_count = param_count;
+
+    _local_vars = nullptr;
+    _local_vars_count = 0;
+    if (method_body.local_var_sig_token != 0)
+    {
+        utils::Vector<const metadata::RtTypeSig*> local_var_type_sigs;
+        RET_ERR_ON_FAIL(_mod->read_local_var_sig(method_body.local_var_sig_token, _generic_container_context, _generic_context, local_var_type_sigs));
+        if (!local_var_type_sigs.empty())
+        {
+            const size_t locals_offset = get_cur_eval_stack_top();
+            const Variable** local_vars = _pool->calloc_any<const Variable*>(local_var_type_sigs.size());
+            for (size_t i = 0; i < local_var_type_sigs.size(); ++i)
+            {
+                DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(const Variable*, local_var, alloc_variable_by_typesig(local_var_type_sigs[i], get_cur_eval_stack_top()));
+                internal_push_eval_stack_var_and_update_max(local_var);
+                local_vars[i] = local_var;
+            }
+            _local_vars = local_vars;
+            _local_vars_count = local_var_type_sigs.size();
+
+            if ((method_body.flags & static_cast<uint16_t>(metadata::RtILMethodFormat::InitLocals)) != 0)
+            {
+                GeneralInst* ir = create_add_inst(OpCodeEnum::InitLocals);
+                ir->set_locals_offset(locals_offset);
+                ir->set_size(get_cur_eval_stack_top() - locals_offset);
+            }
+        }
+    }
+    const size_t callee_eval_stack_base_idx = _cur_bb->eval_stack.size();
+
+    const uint8_t* codes_begin = method_body.code;
+    const uint8_t* codes_end = codes_begin + method_body.code_size;
+    for (const uint8_t* codes_cur = codes_begin; codes_cur < codes_end;)
+    {
+        const il::OpCodeInfo* opcode_info;
+        if (!il::OpCodes::try_decode_opcode_info(codes_cur, codes_end, opcode_info) || opcode_info->inline_type == il::ArgType::Switch)
+            RET_ERR(RtErr::NotSupported);
+        const size_t opcode_size = il::OpCodes::get_opcode_size(codes_cur, opcode_info);
+        if (opcode_size > static_cast<size_t>(codes_end - codes_cur))
+            RET_ERR(RtErr::BadImageFormat);
+        const uint8_t* operand = codes_cur + opcode_size - opcode_info->inline_param;
+        codes_cur += opcode_size;
+
+        switch (opcode_info->id)
+        {
+        case il::OpCodeEnum::Nop:
+            break;
+        case il::OpCodeEnum::LdArg0:
+        case il::OpCodeEnum::LdArg1:
+        case il::OpCodeEnum::LdArg2:
+        case il::OpCodeEnum::LdArg3:
+            RET_ERR_ON_FAIL(add_ldarg(opcode_info->const_value));
+            break;
+        case il::OpCodeEnum::LdArgS:
+            RET_ERR_ON_FAIL(add_ldarg(*operand));
+            break;
+        case il::OpCodeEnum::Ldarg:
+            RET_ERR_ON_FAIL(add_ldarg(utils::MemOp::read_u16_may_unaligned(operand)));
+            break;
+        case il::OpCodeEnum::StArgS:
+            RET_ERR_ON_FAIL(add_starg(*operand));
+            break;
+        case il::OpCodeEnum::Starg:
+            RET_ERR_ON_FAIL(add_starg(utils::MemOp::read_u16_may_unaligned(operand)));
+            break;
+        case il::OpCodeEnum::LdLoc0:
+        case il::OpCodeEnum::LdLoc1:
+        case il::OpCodeEnum::LdLoc2:
+        case il::OpCodeEnum::LdLoc3:
+            RET_ERR_ON_FAIL(add_ldloc(opcode_info->const_value));
+            break;
+        case il::OpCodeEnum::LdLocS:
+            RET_ERR_ON_FAIL(add_ldloc(*operand));
+            break;
+        case il::OpCodeEnum::Ldloc:
+            RET_ERR_ON_FAIL(add_ldloc(utils::MemOp::read_u16_may_unaligned(operand)));
+            break;
+        case il::OpCodeEnum::StLoc0:
+        case il::OpCodeEnum::StLoc1:
+        case il::OpCodeEnum::StLoc2:
+        case il::OpCodeEnum::StLoc3:
+            RET_ERR_ON_FAIL(add_stloc(opcode_info->const_value));
+            break;
+        case il::OpCodeEnum::StLocS:
+            RET_ERR_ON_FAIL(add_stloc(*operand));
+            break;
+        case il::OpCodeEnum::Stloc:
+            RET_ERR_ON_FAIL(add_stloc(utils::MemOp::read_u16_may_unaligned(operand)));
+            break;
+        case il::OpCodeEnum::LdNull:
+            RET_ERR_ON_FAIL(add_ldnull());
+            break;
+        case il::OpCodeEnum::LdcI4M1:
+        case il::OpCodeEnum::LdcI40:
+        case il::OpCodeEnum::LdcI41:
+        case il::OpCodeEnum::LdcI42:
+        case il::OpCodeEnum::LdcI43:
+        case il::OpCodeEnum::LdcI44:
+        case il::OpCodeEnum::LdcI45:
+        case il::OpCodeEnum::LdcI46:
+        case il::OpCodeEnum::LdcI47:
+        case il::OpCodeEnum::LdcI48:
+            RET_ERR_ON_FAIL(add_ldci4(opcode_info->const_value));
+            break;
+        case il::OpCodeEnum::LdcI4S:
+            RET_ERR_ON_FAIL(add_ldci4(*(const int8_t*)operand));
+            break;
+        case il::OpCodeEnum::LdcI4:
+            RET_ERR_ON_FAIL(add_ldci4((int32_t)utils::MemOp::read_u32_may_unaligned(operand)));
+            break;
+        case il::OpCodeEnum::LdcI8:
+            RET_ERR_ON_FAIL(add_ldci8(static_cast<int64_t>(utils::MemOp::read_u64_may_unaligned(operand))));
+            break;
+        case il::OpCodeEnum::LdcR4:
+            RET_ERR_ON_FAIL(add_ldcr4(utils::MemOp::read_f32_may_unaligned(operand)));
+            break;
+        case il::OpCodeEnum::LdcR8:
+            RET_ERR_ON_FAIL(add_ldcr8(utils::MemOp::read_f64_may_unaligned(operand)));
+            break;
+        case il::OpCodeEnum::Dup:
+            RET_ERR_ON_FAIL(add_dup());
+            break;
+        case il::OpCodeEnum::Pop:
+            RET_ERR_ON_FAIL(pop_eval_stack());
+            break;
+        case il::OpCodeEnum::Add:
+            RET_ERR_ON_FAIL(add_bin_arith_op(OpCodeEnum::Add));
+            break;
+        case il::OpCodeEnum::Sub:
+            RET_ERR_ON_FAIL(add_bin_arith_op(OpCodeEnum::Sub));
+            break;
+        case il::OpCodeEnum::Mul:
+            RET_ERR_ON_FAIL(add_bin_arith_op(OpCodeEnum::Mul));
+            break;
+        case il::OpCodeEnum::And:
+            RET_ERR_ON_FAIL(add_bin_bit_op(OpCodeEnum::And));
+            break;
+        case il::OpCodeEnum::Or:
+            RET_ERR_ON_FAIL(add_bin_bit_op(OpCodeEnum::Or));
+            break;
+        case il::OpCodeEnum::Xor:
+            RET_ERR_ON_FAIL(add_bin_bit_op(OpCodeEnum::Xor));
+            break;
+        case il::OpCodeEnum::Shl:
+            RET_ERR_ON_FAIL(add_bit_shift_op(OpCodeEnum::Shl));
+            break;
+        case il::OpCodeEnum::Shr:
+            RET_ERR_ON_FAIL(add_bit_shift_op(OpCodeEnum::Shr));
+            break;
+        case il::OpCodeEnum::ShrUn:
+            RET_ERR_ON_FAIL(add_bit_shift_op(OpCodeEnum::ShrUn));
+            break;
+        case il::OpCodeEnum::Neg:
+            RET_ERR_ON_FAIL(add_neg());
+            break;
+        case il::OpCodeEnum::Not:
+            RET_ERR_ON_FAIL(add_not());
+            break;
+        case il::OpCodeEnum::ConvI1:
+            RET_ERR_ON_FAIL(add_conv(OpCodeEnum::ConvI1, RtEvalStackDataType::I4));
+            break;
+        case il::OpCodeEnum::ConvI2:
+            RET_ERR_ON_FAIL(add_conv(OpCodeEnum::ConvI2, RtEvalStackDataType::I4));
+            break;
+        case il::OpCodeEnum::ConvI4:
+            RET_ERR_ON_FAIL(add_conv(OpCodeEnum::ConvI4, RtEvalStackDataType::I4));
+            break;
+        case il::OpCodeEnum::ConvI8:
+            RET_ERR_ON_FAIL(add_conv(OpCodeEnum::ConvI8, RtEvalStackDataType::I8));
+            break;
+        case il::OpCodeEnum::ConvR4:
+            RET_ERR_ON_FAIL(add_conv(OpCodeEnum::ConvR4, RtEvalStackDataType::R4));
+            break;
+        case il::OpCodeEnum::ConvR8:
+            RET_ERR_ON_FAIL(add_conv(OpCodeEnum::ConvR8, RtEvalStackDataType::R8));
+            break;
+        case il::OpCodeEnum::ConvU1:
+            RET_ERR_ON_FAIL(add_conv(OpCodeEnum::ConvU1, RtEvalStackDataType::I4));
+            break;
+        case il::OpCodeEnum::ConvU2:
+            RET_ERR_ON_FAIL(add_conv(OpCodeEnum::ConvU2, RtEvalStackDataType::I4));
+            break;
+        case il::OpCodeEnum::ConvU4:
+            RET_ERR_ON_FAIL(add_conv(OpCodeEnum::ConvU4, RtEvalStackDataType::I4));
+            break;
+        case il::OpCodeEnum::ConvU8:
+            RET_ERR_ON_FAIL(add_conv(OpCodeEnum::ConvU8, RtEvalStackDataType::I8));
+            break;
+        case il::OpCodeEnum::Ceq:
+            RET_ERR_ON_FAIL(add_bin_compare_op(OpCodeEnum::Ceq));
+            break;
+        case il::OpCodeEnum::Cgt:
+            RET_ERR_ON_FAIL(add_bin_compare_op(OpCodeEnum::Cgt));
+            break;
+        case il::OpCodeEnum::CgtUn:
+            RET_ERR_ON_FAIL(add_bin_compare_op(OpCodeEnum::CgtUn));
+            break;
+        case il::OpCodeEnum::Clt:
+            RET_ERR_ON_FAIL(add_bin_compare_op(OpCodeEnum::Clt));
+            break;
+        case il::OpCodeEnum::CltUn:
+            RET_ERR_ON_FAIL(add_bin_compare_op(OpCodeEnum::CltUn));
+            break;
+        case il::OpCodeEnum::Ldfld:
+        {
+            DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(const metadata::RtFieldInfo*, field, get_field_from_token(utils::MemOp::read_u32_may_unaligned(operand)));
+            RET_ERR_ON_FAIL(add_ldfld(field));
+            break;
+        }
+        case il::OpCodeEnum::Stfld:
+        {
+            DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(const metadata::RtFieldInfo*, field, get_field_from_token(utils::MemOp::read_u32_may_unaligned(operand)));
+            RET_ERR_ON_FAIL(add_stfld(field));
+            break;
+        }
+        case il::OpCodeEnum::Ldsfld:
+        {
+            DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(const metadata::RtFieldInfo*, field, get_field_from_token(utils::MemOp::read_u32_may_unaligned(operand)));
+            RET_ERR_ON_FAIL(add_ldsfld(field));
+            break;
+        }
+        case il::OpCodeEnum::Stsfld:
+        {
+            DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(const metadata::RtFieldInfo*, field, get_field_from_token(utils::MemOp::read_u32_may_unaligned(operand)));
+            RET_ERR_ON_FAIL(add_stsfld(field));
+            break;
+        }
+        case il::OpCodeEnum::Ret:
+        {
+            // only a ret ending the body is supported, so the callee never leaves the current basic block
+            if (codes_cur != codes_end)
+                RET_ERR(RtErr::NotSupported);
+            const Variable* ret_var = nullptr;
+            if (!vm::Method::is_void_return(method))
+            {
+                UNWRAP_OR_RET_ERR_ON_FAIL(ret_var, pop_eval_stack());
+            }
+            if (_cur_bb->eval_stack.size() != callee_eval_stack_base_idx)
+                RET_ERR(RtErr::ExecutionEngine);
+
+            // the return value goes where the call would have left it, checked before the args and locals are dropped
+            Variable* return_var = nullptr;
+            if (ret_var)
+            {
+                UNWRAP_OR_RET_ERR_ON_FAIL(return_var, create_eval_stack_variable_from_type_sig(method->return_type, frame_base));
+                if (return_var->data_type != ret_var->data_type || return_var->stack_object_size != ret_var->stack_object_size ||
+                    (return_var->eval_stack_offset != ret_var->eval_stack_offset &&
+                     return_var->eval_stack_offset + return_var->stack_object_size > ret_var->eval_stack_offset))
+                    RET_ERR(RtErr::NotSupported);
+            }
+            _cur_bb->eval_stack.resize_uninitialized(frame_base_idx);
+            _cur_bb->eval_stack_top = frame_base;
+            if (return_var)
+            {
+                internal_push_eval_stack_var_and_update_max(return_var);
+                GeneralInst* ir = create_add_inst(OpCodeEnum::Dup);
+                ir->set_var_src(ret_var);
+                ir->set_var_dst(return_var);
+            }
+            RET_VOID_OK();
+        }
+        default:
+            RET_ERR(RtErr::NotSupported);
+        }
+    }
+    RET_ERR(RtErr::NotSupported);
+}
+
 RtResult<bool> Transformer::try_handle_newobj_intrinsic(const metadata::RtMethodInfo* method)
 {
     metadata::RtClass* klass = method->parent;
@@ -1262,6 +1688,8 @@ RtResultVoid Transformer::add_newobj(const metadata::RtMethodInfo* method)
     ir->set_newobj_method_and_params(target_method, get_cur_eval_stack_top(), total_param_stack_object_size, params);
 
     DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(Variable*, obj_var, push_class_to_eval_stack(klass));
+    if (!vm::Class::is_value_type(klass))
+        obj_var->exact_klass = klass;
     ir->set_var_dst(obj_var);
 
     RET_VOID_OK();
@@ -1368,8 +1796,27 @@ RtResultVoid Transformer::add_callvirt(const metadata::RtMethodInfo* method)
         }
     }
 
+    // A receiver just created by newobj is non-null and of an exactly known class, so the override can be resolved here.
+    const Variable* obj_var = _cur_bb->eval_stack[_cur_bb->eval_stack.size() - param_count];
+    if (obj_var->exact_klass && vm::Method::is_virtual(method))
+    {
+        RET_ERR_ON_FAIL(vm::Class::initialize_all(obj_var->exact_klass));
+        DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(const metadata::RtMethodInfo*, impl_method,
+                                                vm::Method::get_virtual_method_impl_on_klass(obj_var->exact_klass, method));
+        if (!vm::Method::is_abstract(impl_method) && !vm::Class::is_value_type(impl_method->parent))
+        {
+            return add_call(impl_method);
+        }
+    }
+
     if (vm::Method::is_devirtualed(method))
     {
+        // callvirt still has to raise NullReferenceException on a null receiver
+        if (!obj_var->exact_klass)
+        {
+            GeneralInst* ir = create_add_inst(OpCodeEnum::CheckNull);
+            ir->set_var_src(obj_var);
+        }
         return add_call(method);
     }
     else
@@ -1510,6 +1957,7 @@ RtResultVoid Transformer::add_cpobj(metadata::RtClass* klass)
     {
         ir = create_add_inst(OpCodeEnum::CpObjAny);
         ir->set_size(type_and_size.byte_size);
+        ir->stores_references = vm::Class::get_has_references(klass);
         break;
     }
     default:
@@ -1605,6 +2053,7 @@ RtResultVoid Transformer::add_stobj(metadata::RtClass* klass)
     {
         ir = create_add_inst(OpCodeEnum::StObjAny);
         ir->set_size(type_and_size.byte_size);
+        ir->stores_references = vm::Class::get_has_references(klass);
         break;
     }
     default:
@@ -2072,6 +2521,7 @@ RtResultVoid Transformer::add_leave(size_t next_offset, ptrdiff_t target_offset)
     const size_t target_il_offset = next_offset + target_offset;
     DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(BasicBlock*, target_bb, get_branch_target_bb(target_il_offset));
 
+    add_count_back_edge(target_offset);
     GeneralInst* ir = create_add_inst(OpCodeEnum::Leave);
     clear_eval_stack();
     ir->set_branch_target(target_bb);
@@ -2154,6 +2604,1491 @@ RtResultVoid Transformer::transform()
     // Transform IL body to HL opcodes
     RET_ERR_ON_FAIL(transform_body());
 
+    if (_optimize)
+    {
+        // Forward locals and args into their consumers and drop the moves made redundant
+        RET_ERR_ON_FAIL(optimize_moves());
+
+        // Evaluate instructions with constant operands and prune the code they make unreachable
+        RET_ERR_ON_FAIL(fold_constants());
+        RET_ERR_ON_FAIL(remove_unreachable_basic_blocks());
+
+        // Drop the null and range checks of array accesses guarded by the condition of a counted loop
+        RET_ERR_ON_FAIL(eliminate_bounds_checks());
+    }
+
+    RET_VOID_OK();
+}
+
+// Locals and args whose frame slot has exactly the layout of the eval stack value loaded from it, so that an instruction may
+// read the slot directly instead of the copy.
+static bool is_copy_forwardable_var(const Variable* var)
+{
+    switch (var->reduce_type)
+    {
+    case metadata::RtArgOrLocOrFieldReduceType::I4:
+    case metadata::RtArgOrLocOrFieldReduceType::I8:
+    case metadata::RtArgOrLocOrFieldReduceType::I:
+    case metadata::RtArgOrLocOrFieldReduceType::R4:
+    case metadata::RtArgOrLocOrFieldReduceType::R8:
+    case metadata::RtArgOrLocOrFieldReduceType::Ref:
+        return true;
+    default:
+        return false;
+    }
+}
+
+// Collects the var operands that the instruction only reads and pops, and whose low-level form addresses them by frame slot.
+// Calls, in-place conversions and the remaining instructions rely on the physical eval stack layout and are not listed.
+static size_t get_forwardable_operands(GeneralInst* inst, InstArgData** operands)
+{
+    switch (inst->get_opcode())
+    {
+    case OpCodeEnum::Ret:
+        if (inst->get_var_src() == nullptr)
+            return 0;
+        operands[0] = &inst->arg1_or_src;
+        return 1;
+    case OpCodeEnum::StArg:
+    case OpCodeEnum::StLoc:
+    case OpCodeEnum::BrTrue:
+    case OpCodeEnum::BrFalse:
+    case OpCodeEnum::Switch:
+    case OpCodeEnum::LdIndI1:
+    case OpCodeEnum::LdIndU1:
+    case OpCodeEnum::LdIndI2:
+    case OpCodeEnum::LdIndU2:
+    case OpCodeEnum::LdIndI4:
+    case OpCodeEnum::LdIndI8:
+    case OpCodeEnum::LdIndR4:
+    case OpCodeEnum::LdIndR8:
+    case OpCodeEnum::LdIndRef:
+    case OpCodeEnum::Neg:
+    case OpCodeEnum::Not:
+    case OpCodeEnum::LdLen:
+    case OpCodeEnum::Ldfld:
+    case OpCodeEnum::Ldflda:
+    case OpCodeEnum::CheckNull:
+    case OpCodeEnum::Throw:
+        operands[0] = &inst->arg1_or_src;
+        return 1;
+    case OpCodeEnum::StIndI1:
+    case OpCodeEnum::StIndI2:
+    case OpCodeEnum::StIndI4:
+    case OpCodeEnum::StIndI8:
+    case OpCodeEnum::StIndR4:
+    case OpCodeEnum::StIndR8:
+    case OpCodeEnum::StIndRef:
+        operands[0] = &inst->arg1_or_src;
+        operands[1] = &inst->dst_or_ret;
+        return 2;
+    case OpCodeEnum::Beq:
+    case OpCodeEnum::Bge:
+    case OpCodeEnum::Bgt:
+    case OpCodeEnum::Ble:
+    case OpCodeEnum::Blt:
+    case OpCodeEnum::BneUn:
+    case OpCodeEnum::BgeUn:
+    case OpCodeEnum::BgtUn:
+    case OpCodeEnum::BleUn:
+    case OpCodeEnum::BltUn:
+    case OpCodeEnum::Add:
+    case OpCodeEnum::Sub:
+    case OpCodeEnum::Mul:
+    case OpCodeEnum::Div:
+    case OpCodeEnum::DivUn:
+    case OpCodeEnum::Rem:
+    case OpCodeEnum::RemUn:
+    case OpCodeEnum::And:
+    case OpCodeEnum::Or:
+    case OpCodeEnum::Xor:
+    case OpCodeEnum::Shl:
+    case OpCodeEnum::Shr:
+    case OpCodeEnum::ShrUn:
+    case OpCodeEnum::AddOvf:
+    case OpCodeEnum::AddOvfUn:
+    case OpCodeEnum::MulOvf:
+    case OpCodeEnum::MulOvfUn:
+    case OpCodeEnum::SubOvf:
+    case OpCodeEnum::SubOvfUn:
+    case OpCodeEnum::Ceq:
+    case OpCodeEnum::Cgt:
+    case OpCodeEnum::CgtUn:
+    case OpCodeEnum::Clt:
+    case OpCodeEnum::CltUn:
+    case OpCodeEnum::LdelemI1:
+    case OpCodeEnum::LdelemU1:
+    case OpCodeEnum::LdelemI2:
+    case OpCodeEnum::LdelemU2:
+    case OpCodeEnum::LdelemI4:
+    case OpCodeEnum::LdelemI8:
+    case OpCodeEnum::LdelemR4:
+    case OpCodeEnum::LdelemR8:
+    case OpCodeEnum::LdelemI:
+    case OpCodeEnum::LdelemRef:
+    case OpCodeEnum::Stfld:
+        operands[0] = &inst->arg1_or_src;
+        operands[1] = &inst->arg2;
+        return 2;
+    case OpCodeEnum::StelemI1:
+    case OpCodeEnum::StelemI2:
+    case OpCodeEnum::StelemI4:
+    case OpCodeEnum::StelemI8:
+    case OpCodeEnum::StelemI:
+    case OpCodeEnum::StelemR4:
+    case OpCodeEnum::StelemR8:
+    case OpCodeEnum::StelemRef:
+        operands[0] = &inst->arg1_or_src;
+        operands[1] = &inst->arg2;
+        operands[2] = &inst->arg3;
+        return 3;
+    default:
+        return 0;
+    }
+}
+
+// Instructions that fully write their dst var without reading it, and whose low-level form never degrades to a Nop that
+// relies on dst sharing the slot of its source. The result of such an instruction may be written straight into a local.
+static bool can_write_dst_to_local(OpCodeEnum opcode)
+{
+    switch (opcode)
+    {
+    case OpCodeEnum::LdArg:
+    case OpCodeEnum::LdLoc:
+    case OpCodeEnum::LdNull:
+    case OpCodeEnum::LdcI4:
+    case OpCodeEnum::LdcI8:
+    case OpCodeEnum::LdcR4:
+    case OpCodeEnum::LdcR8:
+    case OpCodeEnum::LdIndI1:
+    case OpCodeEnum::LdIndU1:
+    case OpCodeEnum::LdIndI2:
+    case OpCodeEnum::LdIndU2:
+    case OpCodeEnum::LdIndI4:
+    case OpCodeEnum::LdIndI8:
+    case OpCodeEnum::LdIndR4:
+    case OpCodeEnum::LdIndR8:
+    case OpCodeEnum::LdIndRef:
+    case OpCodeEnum::Add:
+    case OpCodeEnum::Sub:
+    case OpCodeEnum::Mul:
+    case OpCodeEnum::And:
+    case OpCodeEnum::Or:
+    case OpCodeEnum::Xor:
+    case OpCodeEnum::Shl:
+    case OpCodeEnum::Shr:
+    case OpCodeEnum::ShrUn:
+    case OpCodeEnum::Neg:
+    case OpCodeEnum::Not:
+    case OpCodeEnum::Ceq:
+    case OpCodeEnum::Cgt:
+    case OpCodeEnum::CgtUn:
+    case OpCodeEnum::Clt:
+    case OpCodeEnum::CltUn:
+    case OpCodeEnum::LdLen:
+    case OpCodeEnum::Ldfld:
+    case OpCodeEnum::LdelemI1:
+    case OpCodeEnum::LdelemU1:
+    case OpCodeEnum::LdelemI2:
+    case OpCodeEnum::LdelemU2:
+    case OpCodeEnum::LdelemI4:
+    case OpCodeEnum::LdelemI8:
+    case OpCodeEnum::LdelemR4:
+    case OpCodeEnum::LdelemR8:
+    case OpCodeEnum::LdelemI:
+    case OpCodeEnum::LdelemRef:
+        return true;
+    default:
+        return false;
+    }
+}
+
+static bool references_var(const GeneralInst* inst, const Variable* var)
+{
+    return inst->arg1_or_src.var == var || inst->arg2.var == var || inst->arg3.var == var || inst->dst_or_ret.var == var || inst->extra_data.var == var;
+}
+
+const bool* Transformer::collect_address_taken_vars()
+{
+    bool* address_taken_vars = _pool->calloc_any<bool>(_next_var_id);
+    for (size_t i = 0; i < _basic_block_count; ++i)
+    {
+        for (const GeneralInst* inst : _basic_blocks[i].insts)
+        {
+            if (inst->get_opcode() == OpCodeEnum::LdLoca || inst->get_opcode() == OpCodeEnum::LdArga)
+                address_taken_vars[inst->get_var_src()->id] = true;
+        }
+    }
+    return address_taken_vars;
+}
+
+struct CopyMove
+{
+    GeneralInst* inst;
+    // the copy still equals its source local, so a consumer may read the local instead
+    bool active;
+    // the instruction popping the copy was rewritten to read the local
+    bool forwarded;
+    // some instruction still reads the copy itself
+    bool used;
+};
+
+RtResultVoid Transformer::optimize_moves()
+{
+    // Each IL ldloc/ldarg becomes a move from the frame slot of the local to a fresh eval stack var. Within a basic block,
+    // consumers of such a copy are rewritten to read the local directly as long as the local is not stored to in between,
+    // and the move is dropped once nothing reads the copy anymore. A stloc/starg of an eval stack temp computed by the
+    // preceding instruction is folded into that instruction. Locals whose address is taken are never forwarded, since they may be
+    // written through a pointer. Both rewrites keep every store to a local at its original position, so exception handlers
+    // and code after a leave observe exactly the same local state.
+    if (_local_vars_count == 0 && _arg_vars_count == 0)
+        RET_VOID_OK();
+
+    const bool* address_taken_vars = collect_address_taken_vars();
+    CopyMove** move_of_copy_vars = _pool->calloc_any<CopyMove*>(_next_var_id);
+    utils::NotFreeList<CopyMove*> moves(_pool);
+    utils::NotFreeList<CopyMove*> active_moves(_pool);
+    InstArgData* operands[3];
+
+    for (size_t i = 0; i < _basic_block_count; ++i)
+    {
+        BasicBlock* bb = _basic_blocks + i;
+        moves.clear();
+        active_moves.clear();
+
+        for (const GeneralInst* const_inst : bb->insts)
+        {
+            GeneralInst* inst = const_cast<GeneralInst*>(const_inst);
+            OpCodeEnum opcode = inst->get_opcode();
+            if (opcode == OpCodeEnum::LdLoc || opcode == OpCodeEnum::LdArg)
+            {
+                const Variable* src = inst->get_var_src();
+                if (is_copy_forwardable_var(src) && !address_taken_vars[src->id])
+                {
+                    CopyMove* move = _pool->malloc_any_zeroed<CopyMove>();
+                    move->inst = inst;
+                    move->active = true;
+                    move_of_copy_vars[inst->get_var_dst()->id] = move;
+                    moves.push_back(move);
+                    active_moves.push_back(move);
+                }
+                continue;
+            }
+
+            size_t operand_count = get_forwardable_operands(inst, operands);
+            if (operand_count > 0)
+            {
+                for (size_t j = 0; j < operand_count; ++j)
+                {
+                    const Variable* var = operands[j]->var;
+                    CopyMove* move = move_of_copy_vars[var->id];
+                    if (move == nullptr || move->inst->get_var_dst() != var)
+                        continue;
+                    if (move->active)
+                    {
+                        operands[j]->var = move->inst->get_var_src();
+                        move->active = false;
+                        move->forwarded = true;
+                    }
+                    else
+                    {
+                        move->used = true;
+                    }
+                }
+            }
+            else
+            {
+                // the copy may be read in place or overwritten by a conversion sharing its slot
+                for (CopyMove* move : active_moves)
+                {
+                    if (move->active && references_var(inst, move->inst->get_var_dst()))
+                    {
+                        move->active = false;
+                        move->used = true;
+                    }
+                }
+            }
+
+            if (opcode == OpCodeEnum::StLoc || opcode == OpCodeEnum::StArg || opcode == OpCodeEnum::InitLocals)
+            {
+                const Variable* dst = opcode == OpCodeEnum::InitLocals ? nullptr : inst->get_var_dst();
+                for (CopyMove* move : active_moves)
+                {
+                    if (dst == nullptr || move->inst->get_var_src() == dst)
+                        move->active = false;
+                }
+            }
+
+            size_t active_count = 0;
+            for (CopyMove* move : active_moves)
+            {
+                if (move->active)
+                    active_moves[active_count++] = move;
+            }
+            active_moves.resize_uninitialized(active_count);
+        }
+
+        for (CopyMove* move : moves)
+        {
+            // copies live across the block boundary are read by successors through their slot
+            move->active = false;
+            if (move->forwarded && !move->used)
+                move->inst->set_opcode(OpCodeEnum::Nop);
+        }
+
+        size_t inst_count = 0;
+        for (const GeneralInst* const_inst : bb->insts)
+        {
+            GeneralInst* inst = const_cast<GeneralInst*>(const_inst);
+            OpCodeEnum opcode = inst->get_opcode();
+            if (opcode == OpCodeEnum::Nop)
+                continue;
+            if ((opcode == OpCodeEnum::StLoc || opcode == OpCodeEnum::StArg) && inst_count > 0)
+            {
+                GeneralInst* prev_inst = const_cast<GeneralInst*>(bb->insts[inst_count - 1]);
+                const Variable* src = inst->get_var_src();
+                const Variable* dst = inst->get_var_dst();
+                // only a temp of the eval stack is dead after the store; a forwarded copy may make src a local that is read later
+                if (src->eval_stack_offset >= _total_arg_and_local_stack_object_size && can_write_dst_to_local(prev_inst->get_opcode()) &&
+                    prev_inst->get_var_dst() == src && is_copy_forwardable_var(dst) && dst->data_type == src->data_type)
+                {
+                    prev_inst->set_var_dst(dst);
+                    continue;
+                }
+            }
+            bb->insts[inst_count++] = inst;
+        }
+        bb->insts.resize_uninitialized(inst_count);
+    }
+
+    RET_VOID_OK();
+}
+
+struct ConstValue
+{
+    RtEvalStackDataType data_type;
+    union
+    {
+        int32_t i4;
+        int64_t i8;
+        float r4;
+        double r8;
+    };
+};
+
+enum class ConstCompare
+{
+    Eq,
+    NeUn,
+    Ge,
+    GeUn,
+    Gt,
+    GtUn,
+    Le,
+    LeUn,
+    Lt,
+    LtUn,
+};
+
+static bool get_inst_const_value(const GeneralInst* inst, ConstValue& value)
+{
+    switch (inst->get_opcode())
+    {
+    case OpCodeEnum::LdcI4:
+        value.data_type = RtEvalStackDataType::I4;
+        value.i4 = inst->get_i4();
+        return true;
+    case OpCodeEnum::LdcI8:
+        value.data_type = RtEvalStackDataType::I8;
+        value.i8 = inst->get_i8();
+        return true;
+    case OpCodeEnum::LdcR4:
+        value.data_type = RtEvalStackDataType::R4;
+        value.r4 = inst->get_r4();
+        return true;
+    case OpCodeEnum::LdcR8:
+        value.data_type = RtEvalStackDataType::R8;
+        value.r8 = inst->get_r8();
+        return true;
+    default:
+        return false;
+    }
+}
+
+// Rewrites the instruction into a load of the constant into its dst var.
+static void set_inst_const_value(GeneralInst* inst, const ConstValue& value)
+{
+    inst->set_var_src_invalid();
+    inst->arg2.value = 0;
+    inst->arg3.value = 0;
+    inst->extra_data.value = 0;
+    inst->set_prefix(il::OpCodePrefix::None);
+    switch (value.data_type)
+    {
+    case RtEvalStackDataType::I4:
+        inst->set_opcode(OpCodeEnum::LdcI4);
+        inst->set_i4(value.i4);
+        break;
+    case RtEvalStackDataType::I8:
+        inst->set_opcode(OpCodeEnum::LdcI8);
+        inst->set_i8(value.i8);
+        break;
+    case RtEvalStackDataType::R4:
+        inst->set_opcode(OpCodeEnum::LdcR4);
+        inst->set_r4(value.r4);
+        break;
+    default:
+        inst->set_opcode(OpCodeEnum::LdcR8);
+        inst->set_r8(value.r8);
+        break;
+    }
+}
+
+static void clear_inst(GeneralInst* inst)
+{
+    inst->set_opcode(OpCodeEnum::Nop);
+    inst->set_var_src_invalid();
+    inst->arg2.value = 0;
+    inst->arg3.value = 0;
+    inst->set_var_dst(nullptr);
+    inst->extra_data.value = 0;
+}
+
+static bool is_int_const(const ConstValue& value)
+{
+    return value.data_type == RtEvalStackDataType::I4 || value.data_type == RtEvalStackDataType::I8;
+}
+
+// I4 operands of an I8 operation were widened by an inserted conv.i8, which sign-extends.
+static int64_t get_int_const(const ConstValue& value)
+{
+    return value.data_type == RtEvalStackDataType::I4 ? value.i4 : value.i8;
+}
+
+// Arithmetic follows the interpreter handlers exactly; operations that would raise an exception are left to run time.
+static bool fold_bin_arith_op(OpCodeEnum opcode, RtEvalStackDataType result_type, const ConstValue& left, const ConstValue& right, ConstValue& result)
+{
+    result.data_type = result_type;
+    switch (result_type)
+    {
+    case RtEvalStackDataType::I4:
+    {
+        if (left.data_type != RtEvalStackDataType::I4 || right.data_type != RtEvalStackDataType::I4)
+            return false;
+        const int32_t x = left.i4;
+        const int32_t y = right.i4;
+        const uint32_t ux = static_cast<uint32_t>(x);
+        const uint32_t uy = static_cast<uint32_t>(y);
+        switch (opcode)
+        {
+        case OpCodeEnum::Add:
+            result.i4 = static_cast<int32_t>(ux + uy);
+            return true;
+        case OpCodeEnum::Sub:
+            result.i4 = static_cast<int32_t>(ux - uy);
+            return true;
+        case OpCodeEnum::Mul:
+            result.i4 = static_cast<int32_t>(ux * uy);
+            return true;
+        case OpCodeEnum::Div:
+        case OpCodeEnum::Rem:
+            if (y == 0 || (y == -1 && x == INT32_MIN))
+                return false;
+            result.i4 = opcode == OpCodeEnum::Div ? x / y : x % y;
+            return true;
+        case OpCodeEnum::DivUn:
+        case OpCodeEnum::RemUn:
+            if (uy == 0)
+                return false;
+            result.i4 = static_cast<int32_t>(opcode == OpCodeEnum::DivUn ? ux / uy : ux % uy);
+            return true;
+        case OpCodeEnum::And:
+            result.i4 = x & y;
+            return true;
+        case OpCodeEnum::Or:
+            result.i4 = x | y;
+            return true;
+        case OpCodeEnum::Xor:
+            result.i4 = x ^ y;
+            return true;
+        default:
+            return false;
+        }
+    }
+    case RtEvalStackDataType::I8:
+    {
+        if (!is_int_const(left) || !is_int_const(right))
+            return false;
+        const int64_t x = get_int_const(left);
+        const int64_t y = get_int_const(right);
+        const uint64_t ux = static_cast<uint64_t>(x);
+        const uint64_t uy = static_cast<uint64_t>(y);
+        switch (opcode)
+        {
+        case OpCodeEnum::Add:
+            result.i8 = static_cast<int64_t>(ux + uy);
+            return true;
+        case OpCodeEnum::Sub:
+            result.i8 = static_cast<int64_t>(ux - uy);
+            return true;
+        case OpCodeEnum::Mul:
+            result.i8 = static_cast<int64_t>(ux * uy);
+            return true;
+        case OpCodeEnum::Div:
+        case OpCodeEnum::Rem:
+            if (y == 0 || (y == -1 && x == INT64_MIN))
+                return false;
+            result.i8 = opcode == OpCodeEnum::Div ? x / y : x % y;
+            return true;
+        case OpCodeEnum::DivUn:
+        case OpCodeEnum::RemUn:
+            if (uy == 0)
+                return false;
+            result.i8 = static_cast<int64_t>(opcode == OpCodeEnum::DivUn ? ux / uy : ux % uy);
+            return true;
+        case OpCodeEnum::And:
+            result.i8 = x & y;
+            return true;
+        case OpCodeEnum::Or:
+            result.i8 = x | y;
+            return true;
+        case OpCodeEnum::Xor:
+            result.i8 = x ^ y;
+            return true;
+        default:
+            return false;
+        }
+    }
+    case RtEvalStackDataType::R4:
+    {
+        if (left.data_type != RtEvalStackDataType::R4 || right.data_type != RtEvalStackDataType::R4)
+            return false;
+        switch (opcode)
+        {
+        case OpCodeEnum::Add:
+            result.r4 = left.r4 + right.r4;
+            return true;
+        case OpCodeEnum::Sub:
+            result.r4 = left.r4 - right.r4;
+            return true;
+        case OpCodeEnum::Mul:
+            result.r4 = left.r4 * right.r4;
+            return true;
+        case OpCodeEnum::Div:
+            result.r4 = left.r4 / right.r4;
+            return true;
+        case OpCodeEnum::Rem:
+            result.r4 = std::fmod(left.r4, right.r4);
+            return true;
+        default:
+            return false;
+        }
+    }
+    case RtEvalStackDataType::R8:
+    {
+        if (left.data_type != RtEvalStackDataType::R8 || right.data_type != RtEvalStackDataType::R8)
+            return false;
+        switch (opcode)
+        {
+        case OpCodeEnum::Add:
+            result.r8 = left.r8 + right.r8;
+            return true;
+        case OpCodeEnum::Sub:
+            result.r8 = left.r8 - right.r8;
+            return true;
+        case OpCodeEnum::Mul:
+            result.r8 = left.r8 * right.r8;
+            return true;
+        case OpCodeEnum::Div:
+            result.r8 = left.r8 / right.r8;
+            return true;
+        case OpCodeEnum::Rem:
+            result.r8 = std::fmod(left.r8, right.r8);
+            return true;
+        default:
+            return false;
+        }
+    }
+    default:
+        return false;
+    }
+}
+
+static bool fold_bit_shift_op(OpCodeEnum opcode, const ConstValue& value, const ConstValue& shift_amount, ConstValue& result)
+{
+    if (shift_amount.data_type != RtEvalStackDataType::I4 || shift_amount.i4 < 0)
+        return false;
+    const int32_t n = shift_amount.i4;
+    result.data_type = value.data_type;
+    switch (value.data_type)
+    {
+    case RtEvalStackDataType::I4:
+        if (n >= 32)
+            return false;
+        result.i4 = opcode == OpCodeEnum::Shl     ? static_cast<int32_t>(static_cast<uint32_t>(value.i4) << n)
+                    : opcode == OpCodeEnum::Shr ? value.i4 >> n
+                                                : static_cast<int32_t>(static_cast<uint32_t>(value.i4) >> n);
+        return true;
+    case RtEvalStackDataType::I8:
+        if (n >= 64)
+            return false;
+        result.i8 = opcode == OpCodeEnum::Shl     ? static_cast<int64_t>(static_cast<uint64_t>(value.i8) << n)
+                    : opcode == OpCodeEnum::Shr ? value.i8 >> n
+                                                : static_cast<int64_t>(static_cast<uint64_t>(value.i8) >> n);
+        return true;
+    default:
+        return false;
+    }
+}
+
+static bool fold_unary_op(OpCodeEnum opcode, const ConstValue& value, ConstValue& result)
+{
+    result.data_type = value.data_type;
+    switch (value.data_type)
+    {
+    case RtEvalStackDataType::I4:
+        result.i4 = opcode == OpCodeEnum::Neg ? static_cast<int32_t>(0u - static_cast<uint32_t>(value.i4)) : ~value.i4;
+        return true;
+    case RtEvalStackDataType::I8:
+        result.i8 = opcode == OpCodeEnum::Neg ? static_cast<int64_t>(0ull - static_cast<uint64_t>(value.i8)) : ~value.i8;
+        return true;
+    case RtEvalStackDataType::R4:
+        result.r4 = -value.r4;
+        return opcode == OpCodeEnum::Neg;
+    case RtEvalStackDataType::R8:
+        result.r8 = -value.r8;
+        return opcode == OpCodeEnum::Neg;
+    default:
+        return false;
+    }
+}
+
+// Float to integer conversions are not folded: their out-of-range behaviour is up to the interpreter's cast helpers.
+static bool fold_conv(OpCodeEnum opcode, const ConstValue& value, ConstValue& result)
+{
+    if (!is_int_const(value))
+    {
+        switch (opcode)
+        {
+        case OpCodeEnum::ConvR4:
+            result.data_type = RtEvalStackDataType::R4;
+            result.r4 = value.data_type == RtEvalStackDataType::R4 ? value.r4 : static_cast<float>(value.r8);
+            return true;
+        case OpCodeEnum::ConvR8:
+            result.data_type = RtEvalStackDataType::R8;
+            result.r8 = value.data_type == RtEvalStackDataType::R4 ? static_cast<double>(value.r4) : value.r8;
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    const int64_t x = get_int_const(value);
+    switch (opcode)
+    {
+    case OpCodeEnum::ConvI1:
+        result.data_type = RtEvalStackDataType::I4;
+        result.i4 = static_cast<int8_t>(x);
+        return true;
+    case OpCodeEnum::ConvU1:
+        result.data_type = RtEvalStackDataType::I4;
+        result.i4 = static_cast<uint8_t>(x);
+        return true;
+    case OpCodeEnum::ConvI2:
+        result.data_type = RtEvalStackDataType::I4;
+        result.i4 = static_cast<int16_t>(x);
+        return true;
+    case OpCodeEnum::ConvU2:
+        result.data_type = RtEvalStackDataType::I4;
+        result.i4 = static_cast<uint16_t>(x);
+        return true;
+    case OpCodeEnum::ConvI4:
+    case OpCodeEnum::ConvU4:
+        result.data_type = RtEvalStackDataType::I4;
+        result.i4 = static_cast<int32_t>(static_cast<uint32_t>(x));
+        return true;
+    case OpCodeEnum::ConvI8:
+        result.data_type = RtEvalStackDataType::I8;
+        result.i8 = x;
+        return true;
+    case OpCodeEnum::ConvU8:
+        result.data_type = RtEvalStackDataType::I8;
+        result.i8 = value.data_type == RtEvalStackDataType::I4 ? static_cast<int64_t>(static_cast<uint32_t>(value.i4)) : x;
+        return true;
+    case OpCodeEnum::ConvR4:
+        result.data_type = RtEvalStackDataType::R4;
+        result.r4 = value.data_type == RtEvalStackDataType::I4 ? static_cast<float>(value.i4) : static_cast<float>(x);
+        return true;
+    case OpCodeEnum::ConvR8:
+        result.data_type = RtEvalStackDataType::R8;
+        result.r8 = value.data_type == RtEvalStackDataType::I4 ? static_cast<double>(value.i4) : static_cast<double>(x);
+        return true;
+    default:
+        return false;
+    }
+}
+
+static bool get_const_compare(OpCodeEnum opcode, ConstCompare& compare)
+{
+    switch (opcode)
+    {
+    case OpCodeEnum::Ceq:
+    case OpCodeEnum::Beq:
+        compare = ConstCompare::Eq;
+        return true;
+    case OpCodeEnum::BneUn:
+        compare = ConstCompare::NeUn;
+        return true;
+    case OpCodeEnum::Bge:
+        compare = ConstCompare::Ge;
+        return true;
+    case OpCodeEnum::BgeUn:
+        compare = ConstCompare::GeUn;
+        return true;
+    case OpCodeEnum::Cgt:
+    case OpCodeEnum::Bgt:
+        compare = ConstCompare::Gt;
+        return true;
+    case OpCodeEnum::CgtUn:
+    case OpCodeEnum::BgtUn:
+        compare = ConstCompare::GtUn;
+        return true;
+    case OpCodeEnum::Ble:
+        compare = ConstCompare::Le;
+        return true;
+    case OpCodeEnum::BleUn:
+        compare = ConstCompare::LeUn;
+        return true;
+    case OpCodeEnum::Clt:
+    case OpCodeEnum::Blt:
+        compare = ConstCompare::Lt;
+        return true;
+    case OpCodeEnum::CltUn:
+    case OpCodeEnum::BltUn:
+        compare = ConstCompare::LtUn;
+        return true;
+    default:
+        return false;
+    }
+}
+
+template <typename T, typename U>
+static bool eval_int_compare(ConstCompare compare, T x, T y)
+{
+    const U ux = static_cast<U>(x);
+    const U uy = static_cast<U>(y);
+    switch (compare)
+    {
+    case ConstCompare::Eq:
+        return x == y;
+    case ConstCompare::NeUn:
+        return x != y;
+    case ConstCompare::Ge:
+        return x >= y;
+    case ConstCompare::GeUn:
+        return ux >= uy;
+    case ConstCompare::Gt:
+        return x > y;
+    case ConstCompare::GtUn:
+        return ux > uy;
+    case ConstCompare::Le:
+        return x <= y;
+    case ConstCompare::LeUn:
+        return ux <= uy;
+    case ConstCompare::Lt:
+        return x < y;
+    default:
+        return ux < uy;
+    }
+}
+
+// The 'Un' forms of float comparisons are true for unordered operands.
+template <typename T>
+static bool eval_float_compare(ConstCompare compare, T x, T y)
+{
+    const bool unordered = std::isunordered(x, y);
+    switch (compare)
+    {
+    case ConstCompare::Eq:
+        return x == y;
+    case ConstCompare::NeUn:
+        return x != y || unordered;
+    case ConstCompare::Ge:
+        return x >= y;
+    case ConstCompare::GeUn:
+        return x >= y || unordered;
+    case ConstCompare::Gt:
+        return x > y;
+    case ConstCompare::GtUn:
+        return x > y || unordered;
+    case ConstCompare::Le:
+        return x <= y;
+    case ConstCompare::LeUn:
+        return x <= y || unordered;
+    case ConstCompare::Lt:
+        return x < y;
+    default:
+        return x < y || unordered;
+    }
+}
+
+static bool eval_const_compare(ConstCompare compare, const ConstValue& left, const ConstValue& right, bool& result)
+{
+    if (left.data_type != right.data_type)
+        return false;
+    switch (left.data_type)
+    {
+    case RtEvalStackDataType::I4:
+        result = eval_int_compare<int32_t, uint32_t>(compare, left.i4, right.i4);
+        return true;
+    case RtEvalStackDataType::I8:
+        result = eval_int_compare<int64_t, uint64_t>(compare, left.i8, right.i8);
+        return true;
+    case RtEvalStackDataType::R4:
+        result = eval_float_compare<float>(compare, left.r4, right.r4);
+        return true;
+    case RtEvalStackDataType::R8:
+        result = eval_float_compare<double>(compare, left.r8, right.r8);
+        return true;
+    default:
+        return false;
+    }
+}
+
+// A constant loaded into an eval stack var.
+struct ConstDef
+{
+    GeneralInst* inst;
+    // the var was popped by an instruction that has been folded away
+    bool popped;
+    // some instruction that is kept still reads the var
+    bool used;
+};
+
+RtResultVoid Transformer::fold_constants()
+{
+    // Constants are tracked per basic block, for eval stack vars as well as for locals and args assigned a constant earlier in
+    // the block. Arithmetic, conversion and compare instructions whose operands are all constant become a single ldc, and
+    // conditional branches on constants become an unconditional br or disappear. An ldc whose value is then only popped by
+    // folded instructions is removed. Locals whose address is taken are never considered constant.
+    const bool* address_taken_vars = collect_address_taken_vars();
+    ConstValue* const_values = _pool->calloc_any<ConstValue>(_next_var_id);
+    bool* const_value_valid = _pool->calloc_any<bool>(_next_var_id);
+    ConstDef** const_def_of_vars = _pool->calloc_any<ConstDef*>(_next_var_id);
+    utils::NotFreeList<const Variable*> const_vars(_pool);
+    utils::NotFreeList<const Variable*> const_frame_vars(_pool);
+    utils::NotFreeList<ConstDef*> const_defs(_pool);
+    utils::NotFreeList<ConstDef*> live_const_defs(_pool);
+
+    for (size_t i = 0; i < _basic_block_count; ++i)
+    {
+        BasicBlock* bb = _basic_blocks + i;
+        const size_t inst_count = bb->insts.size();
+        for (const Variable* var : const_vars)
+            const_value_valid[var->id] = false;
+        const_vars.clear();
+        const_frame_vars.clear();
+        const_defs.clear();
+        live_const_defs.clear();
+        GeneralInst* inplace_conv = nullptr;
+
+        for (size_t j = 0; j < inst_count; ++j)
+        {
+            GeneralInst* inst = const_cast<GeneralInst*>(bb->insts[j]);
+            const OpCodeEnum opcode = inst->get_opcode();
+            const Variable* operands[2] = {nullptr, nullptr};
+            size_t operand_count = 0;
+            ConstValue result;
+            bool folded = false;
+            // 0: not a branch on constants, 1: always taken, 2: never taken
+            int32_t branch_state = 0;
+            const BasicBlock* branch_target = nullptr;
+
+            switch (opcode)
+            {
+            case OpCodeEnum::Add:
+            case OpCodeEnum::Sub:
+            case OpCodeEnum::Mul:
+            case OpCodeEnum::Div:
+            case OpCodeEnum::DivUn:
+            case OpCodeEnum::Rem:
+            case OpCodeEnum::RemUn:
+            case OpCodeEnum::And:
+            case OpCodeEnum::Or:
+            case OpCodeEnum::Xor:
+            case OpCodeEnum::Shl:
+            case OpCodeEnum::Shr:
+            case OpCodeEnum::ShrUn:
+            case OpCodeEnum::Ceq:
+            case OpCodeEnum::Cgt:
+            case OpCodeEnum::CgtUn:
+            case OpCodeEnum::Clt:
+            case OpCodeEnum::CltUn:
+            {
+                operands[0] = inst->get_var_arg1();
+                operands[1] = inst->get_var_arg2();
+                operand_count = 2;
+                if (!const_value_valid[operands[0]->id] || !const_value_valid[operands[1]->id])
+                    break;
+                const ConstValue& left = const_values[operands[0]->id];
+                const ConstValue& right = const_values[operands[1]->id];
+                ConstCompare compare;
+                bool compare_result;
+                if (opcode == OpCodeEnum::Shl || opcode == OpCodeEnum::Shr || opcode == OpCodeEnum::ShrUn)
+                {
+                    folded = fold_bit_shift_op(opcode, left, right, result);
+                }
+                else if (get_const_compare(opcode, compare))
+                {
+                    folded = eval_const_compare(compare, left, right, compare_result);
+                    result.data_type = RtEvalStackDataType::I4;
+                    result.i4 = compare_result ? 1 : 0;
+                }
+                else
+                {
+                    folded = fold_bin_arith_op(opcode, inst->get_var_dst()->data_type, left, right, result);
+                }
+                break;
+            }
+            case OpCodeEnum::Neg:
+            case OpCodeEnum::Not:
+                operands[0] = inst->get_var_src();
+                operand_count = 1;
+                if (const_value_valid[operands[0]->id])
+                    folded = fold_unary_op(opcode, const_values[operands[0]->id], result);
+                break;
+            case OpCodeEnum::ConvI1:
+            case OpCodeEnum::ConvU1:
+            case OpCodeEnum::ConvI2:
+            case OpCodeEnum::ConvU2:
+            case OpCodeEnum::ConvI4:
+            case OpCodeEnum::ConvU4:
+            case OpCodeEnum::ConvI8:
+            case OpCodeEnum::ConvU8:
+            case OpCodeEnum::ConvR4:
+            case OpCodeEnum::ConvR8:
+            {
+                const Variable* src = inst->get_var_src();
+                if (!const_value_valid[src->id])
+                    break;
+                // a conversion inserted to widen an operand of the next instruction rewrites the slot of its source in place;
+                // it is dropped once that instruction is folded, which reads the constant of the source directly
+                if (j + 1 < inst_count && references_var(bb->insts[j + 1], src))
+                {
+                    inplace_conv = inst;
+                    continue;
+                }
+                operands[0] = src;
+                operand_count = 1;
+                folded = fold_conv(opcode, const_values[src->id], result) && result.data_type == inst->get_var_dst()->data_type;
+                break;
+            }
+            case OpCodeEnum::BrTrue:
+            case OpCodeEnum::BrFalse:
+            {
+                operands[0] = inst->get_var_src();
+                operand_count = 1;
+                if (!const_value_valid[operands[0]->id] || !is_int_const(const_values[operands[0]->id]))
+                    break;
+                const bool is_true = get_int_const(const_values[operands[0]->id]) != 0;
+                branch_state = is_true == (opcode == OpCodeEnum::BrTrue) ? 1 : 2;
+                branch_target = inst->get_branch_target();
+                break;
+            }
+            case OpCodeEnum::Beq:
+            case OpCodeEnum::Bge:
+            case OpCodeEnum::Bgt:
+            case OpCodeEnum::Ble:
+            case OpCodeEnum::Blt:
+            case OpCodeEnum::BneUn:
+            case OpCodeEnum::BgeUn:
+            case OpCodeEnum::BgtUn:
+            case OpCodeEnum::BleUn:
+            case OpCodeEnum::BltUn:
+            {
+                operands[0] = inst->get_var_arg1();
+                operands[1] = inst->get_var_arg2();
+                operand_count = 2;
+                if (!const_value_valid[operands[0]->id] || !const_value_valid[operands[1]->id])
+                    break;
+                ConstCompare compare;
+                bool taken;
+                get_const_compare(opcode, compare);
+                if (eval_const_compare(compare, const_values[operands[0]->id], const_values[operands[1]->id], taken))
+                {
+                    branch_state = taken ? 1 : 2;
+                    branch_target = inst->get_branch_target();
+                }
+                break;
+            }
+            case OpCodeEnum::Switch:
+            {
+                operands[0] = inst->get_var_arg1();
+                operand_count = 1;
+                if (!const_value_valid[operands[0]->id] || const_values[operands[0]->id].data_type != RtEvalStackDataType::I4)
+                    break;
+                auto switch_targets = inst->get_switch_targets();
+                const uint32_t key = static_cast<uint32_t>(const_values[operands[0]->id].i4);
+                branch_state = key < switch_targets.second ? 1 : 2;
+                branch_target = key < switch_targets.second ? switch_targets.first[key] : nullptr;
+                break;
+            }
+            default:
+                break;
+            }
+
+            if (inplace_conv != nullptr && inst != inplace_conv)
+            {
+                if (folded)
+                    clear_inst(inplace_conv);
+                else
+                    operand_count = 0;
+                inplace_conv = nullptr;
+            }
+
+            if (folded || branch_state != 0)
+            {
+                for (size_t k = 0; k < operand_count; ++k)
+                {
+                    ConstDef* def = const_def_of_vars[operands[k]->id];
+                    if (def != nullptr && def->inst->get_var_dst() == operands[k])
+                        def->popped = true;
+                }
+                if (folded)
+                {
+                    set_inst_const_value(inst, result);
+                }
+                else if (branch_state == 1)
+                {
+                    clear_inst(inst);
+                    inst->set_opcode(OpCodeEnum::Br);
+                    inst->set_branch_target(const_cast<BasicBlock*>(branch_target));
+                }
+                else
+                {
+                    clear_inst(inst);
+                }
+            }
+            else
+            {
+                for (ConstDef* def : live_const_defs)
+                {
+                    if (references_var(inst, def->inst->get_var_dst()))
+                        def->used = true;
+                }
+            }
+
+            // record the constant written by this instruction, and forget constants of locals it overwrites
+            const Variable* dst = nullptr;
+            ConstValue dst_value;
+            bool dst_is_const = false;
+            if (get_inst_const_value(inst, dst_value))
+            {
+                dst = inst->get_var_dst();
+                dst_is_const = true;
+            }
+            else if (opcode == OpCodeEnum::StLoc || opcode == OpCodeEnum::StArg)
+            {
+                dst = inst->get_var_dst();
+                const Variable* src = inst->get_var_src();
+                if (const_value_valid[src->id])
+                {
+                    dst_value = const_values[src->id];
+                    dst_is_const = true;
+                }
+            }
+
+            for (const Variable* var : const_frame_vars)
+            {
+                if (const_value_valid[var->id] && (var == inst->dst_or_ret.var || opcode == OpCodeEnum::InitLocals))
+                    const_value_valid[var->id] = false;
+            }
+
+            if (!dst_is_const)
+                continue;
+            // args and locals of inlined callees live in eval stack slots, but are stored to like any other local
+            if (dst->eval_stack_offset < _total_arg_and_local_stack_object_size || opcode == OpCodeEnum::StLoc || opcode == OpCodeEnum::StArg)
+            {
+                const metadata::RtArgOrLocOrFieldReduceType reduce_type = dst->reduce_type;
+                if (address_taken_vars[dst->id] ||
+                    (reduce_type != metadata::RtArgOrLocOrFieldReduceType::I4 && reduce_type != metadata::RtArgOrLocOrFieldReduceType::I8 &&
+                     reduce_type != metadata::RtArgOrLocOrFieldReduceType::R4 && reduce_type != metadata::RtArgOrLocOrFieldReduceType::R8) ||
+                    dst_value.data_type != dst->data_type)
+                    continue;
+                const_frame_vars.push_back(dst);
+            }
+            else
+            {
+                ConstDef* def = _pool->malloc_any_zeroed<ConstDef>();
+                def->inst = inst;
+                const_def_of_vars[dst->id] = def;
+                const_defs.push_back(def);
+
+                // everything pushed at or above this slot has been popped already
+                size_t live_count = 0;
+                for (ConstDef* live_def : live_const_defs)
+                {
+                    if (live_def->inst->get_var_dst()->eval_stack_offset < dst->eval_stack_offset)
+                        live_const_defs[live_count++] = live_def;
+                }
+                live_const_defs.resize_uninitialized(live_count);
+                live_const_defs.push_back(def);
+            }
+            const_values[dst->id] = dst_value;
+            const_value_valid[dst->id] = true;
+            const_vars.push_back(dst);
+        }
+
+        size_t new_inst_count = 0;
+        for (ConstDef* def : const_defs)
+        {
+            if (def->popped && !def->used)
+                clear_inst(def->inst);
+        }
+        for (size_t j = 0; j < inst_count; ++j)
+        {
+            const GeneralInst* inst = bb->insts[j];
+            if (inst->get_opcode() != OpCodeEnum::Nop)
+                bb->insts[new_inst_count++] = inst;
+        }
+        bb->insts.resize_uninitialized(new_inst_count);
+    }
+
+    RET_VOID_OK();
+}
+
+RtResultVoid Transformer::remove_unreachable_basic_blocks()
+{
+    // Blocks are reachable from the method entry and from the entry of every handler and filter. Unreachable blocks keep
+    // their place, so exception clause offsets stay valid, but lose all their instructions.
+    bool* reachable = _pool->calloc_any<bool>(_basic_block_count);
+    utils::NotFreeList<const BasicBlock*> pending_bbs(_pool);
+    pending_bbs.push_back(_basic_blocks);
+
+    const auto& clauses = _method_body->exception_clauses;
+    for (size_t i = 0; i < clauses.size(); ++i)
+    {
+        const auto& clause = clauses[i];
+        DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(BasicBlock*, handler_bb, get_branch_target_bb(clause.handler_offset));
+        pending_bbs.push_back(handler_bb);
+        if (clause.flags == metadata::RtILExceptionClauseType::Filter)
+        {
+            DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(BasicBlock*, filter_bb, get_branch_target_bb(clause.class_token_or_filter_offset));
+            pending_bbs.push_back(filter_bb);
+        }
+    }
+
+    while (!pending_bbs.empty())
+    {
+        const BasicBlock* bb = pending_bbs[pending_bbs.size() - 1];
+        pending_bbs.pop_unchecked();
+        const size_t bb_idx = static_cast<size_t>(bb - _basic_blocks);
+        if (reachable[bb_idx])
+            continue;
+        reachable[bb_idx] = true;
+
+        bool fall_through = true;
+        if (!bb->insts.empty())
+        {
+            const GeneralInst* last_inst = bb->insts[bb->insts.size() - 1];
+            switch (last_inst->get_opcode())
+            {
+            case OpCodeEnum::Br:
+            case OpCodeEnum::Leave:
+                pending_bbs.push_back(last_inst->get_branch_target());
+                fall_through = false;
+                break;
+            case OpCodeEnum::BrTrue:
+            case OpCodeEnum::BrFalse:
+            case OpCodeEnum::Beq:
+            case OpCodeEnum::Bge:
+            case OpCodeEnum::Bgt:
+            case OpCodeEnum::Ble:
+            case OpCodeEnum::Blt:
+            case OpCodeEnum::BneUn:
+            case OpCodeEnum::BgeUn:
+            case OpCodeEnum::BgtUn:
+            case OpCodeEnum::BleUn:
+            case OpCodeEnum::BltUn:
+                pending_bbs.push_back(last_inst->get_branch_target());
+                break;
+            case OpCodeEnum::Switch:
+            {
+                auto switch_targets = last_inst->get_switch_targets();
+                for (size_t i = 0; i < switch_targets.second; ++i)
+                    pending_bbs.push_back(switch_targets.first[i]);
+                break;
+            }
+            case OpCodeEnum::Ret:
+            case OpCodeEnum::Throw:
+            case OpCodeEnum::Rethrow:
+            case OpCodeEnum::EndFilter:
+            case OpCodeEnum::EndFinallyOrFault:
+                fall_through = false;
+                break;
+            default:
+                break;
+            }
+        }
+        if (fall_through && bb->next_bb)
+            pending_bbs.push_back(bb->next_bb);
+    }
+
+    for (size_t i = 0; i < _basic_block_count; ++i)
+    {
+        if (!reachable[i])
+            _basic_blocks[i].insts.clear();
+    }
+    RET_VOID_OK();
+}
+
+// Whether `inst` may store to the frame var `var`. Besides the dst of any instruction, InitLocals clears every local.
+static bool may_write_frame_var(const GeneralInst* inst, const Variable* var)
+{
+    return inst->get_opcode() == OpCodeEnum::InitLocals || inst->dst_or_ret.var == var;
+}
+
+// Finds the last instruction before `end` in `bb` whose dst is `var`.
+static bool find_def_inst(const BasicBlock* bb, size_t end, const Variable* var, size_t* def_idx)
+{
+    for (size_t j = end; j > 0; --j)
+    {
+        if (bb->insts[j - 1]->dst_or_ret.var == var)
+        {
+            *def_idx = j - 1;
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool is_i4_const_def(const BasicBlock* bb, size_t end, const Variable* var, int32_t min_value, int32_t max_value)
+{
+    size_t def_idx;
+    if (!find_def_inst(bb, end, var, &def_idx))
+        return false;
+    const GeneralInst* def_inst = bb->insts[def_idx];
+    return def_inst->get_opcode() == OpCodeEnum::LdcI4 && def_inst->get_i4() >= min_value && def_inst->get_i4() <= max_value;
+}
+
+// Resolves the value `var` holds before instruction `end` of `bb` to a frame var: either `var` itself is an arg or local, or it
+// is a copy loaded from one earlier in the block with no store to the arg or local since.
+static const Variable* resolve_frame_var(const BasicBlock* bb, size_t end, const Variable* var, size_t frame_size)
+{
+    if (var == nullptr)
+        return nullptr;
+    if (var->eval_stack_offset < frame_size)
+        return var;
+    size_t def_idx;
+    if (!find_def_inst(bb, end, var, &def_idx))
+        return nullptr;
+    const GeneralInst* def_inst = bb->insts[def_idx];
+    if (def_inst->get_opcode() != OpCodeEnum::LdLoc && def_inst->get_opcode() != OpCodeEnum::LdArg)
+        return nullptr;
+    const Variable* src = def_inst->get_var_src();
+    for (size_t j = def_idx + 1; j < end; ++j)
+    {
+        if (may_write_frame_var(bb->insts[j], src))
+            return nullptr;
+    }
+    return src;
+}
+
+static bool is_checked_element_access(OpCodeEnum opcode)
+{
+    switch (opcode)
+    {
+    case OpCodeEnum::Ldelema:
+    case OpCodeEnum::LdelemI1:
+    case OpCodeEnum::LdelemU1:
+    case OpCodeEnum::LdelemI2:
+    case OpCodeEnum::LdelemU2:
+    case OpCodeEnum::LdelemI4:
+    case OpCodeEnum::LdelemI8:
+    case OpCodeEnum::LdelemI:
+    case OpCodeEnum::LdelemR4:
+    case OpCodeEnum::LdelemR8:
+    case OpCodeEnum::LdelemRef:
+    case OpCodeEnum::StelemI1:
+    case OpCodeEnum::StelemI2:
+    case OpCodeEnum::StelemI4:
+    case OpCodeEnum::StelemI8:
+    case OpCodeEnum::StelemI:
+    case OpCodeEnum::StelemR4:
+    case OpCodeEnum::StelemR8:
+        return true;
+    default:
+        return false;
+    }
+}
+
+// Whether the I4 local `index_var` can never be negative and is only ever incremented at the loop body `body_bb`: every store
+// to it is a non-negative constant, the zeroing of InitLocals, or a single `index + 1` in the body before any other store to
+// it. Since the body is only entered with index < length, that increment cannot overflow.
+bool Transformer::is_counted_loop_index(const Variable* index_var, const BasicBlock* body_bb) const
+{
+    for (size_t i = 0; i < _basic_block_count; ++i)
+    {
+        const BasicBlock* bb = _basic_blocks + i;
+        bool stored_in_body = false;
+        for (size_t j = 0; j < bb->insts.size(); ++j)
+        {
+            const GeneralInst* inst = bb->insts[j];
+            if (!may_write_frame_var(inst, index_var))
+                continue;
+            switch (inst->get_opcode())
+            {
+            case OpCodeEnum::InitLocals:
+                break;
+            case OpCodeEnum::LdcI4:
+                if (inst->get_i4() < 0)
+                    return false;
+                break;
+            case OpCodeEnum::StLoc:
+                if (!is_i4_const_def(bb, j, inst->get_var_src(), 0, INT32_MAX))
+                    return false;
+                break;
+            case OpCodeEnum::Add:
+                if (bb != body_bb || stored_in_body)
+                    return false;
+                if (resolve_frame_var(bb, j, inst->get_var_arg1(), _total_arg_and_local_stack_object_size) != index_var ||
+                    !is_i4_const_def(bb, j, inst->get_var_arg2(), 1, 1))
+                    return false;
+                break;
+            default:
+                return false;
+            }
+            if (bb == body_bb)
+                stored_in_body = true;
+        }
+    }
+    return true;
+}
+
+RtResultVoid Transformer::eliminate_bounds_checks()
+{
+    // Recognizes the loop shape C# emits for `for (int i = ...; i < arr.Length; i++)`: a block ending in `blt` on a local index
+    // and the length of a local array, whose target is the loop body and has no other predecessor. On entry to the body the
+    // array is non-null and 0 <= index < length, so element accesses on that array and index in the body need neither a
+    // null nor a range check until the index or the array local is stored to. Accesses in further blocks of the body keep
+    // their checks.
+    if (_local_vars_count == 0 || !need_init_locals())
+        RET_VOID_OK();
+
+    const bool* address_taken_vars = collect_address_taken_vars();
+    const size_t frame_size = _total_arg_and_local_stack_object_size;
+
+    // Blocks entered other than through a branch or fall through from a single predecessor are never a loop body.
+    uint32_t* pred_counts = _pool->calloc_any<uint32_t>(_basic_block_count);
+    pred_counts[0] = 2;
+    const auto& clauses = _method_body->exception_clauses;
+    for (size_t i = 0; i < clauses.size(); ++i)
+    {
+        const auto& clause = clauses[i];
+        DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(BasicBlock*, handler_bb, get_branch_target_bb(clause.handler_offset));
+        pred_counts[handler_bb - _basic_blocks] = 2;
+        if (clause.flags == metadata::RtILExceptionClauseType::Filter)
+        {
+            DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(BasicBlock*, filter_bb, get_branch_target_bb(clause.class_token_or_filter_offset));
+            pred_counts[filter_bb - _basic_blocks] = 2;
+        }
+    }
+    for (size_t i = 0; i < _basic_block_count; ++i)
+    {
+        const BasicBlock* bb = _basic_blocks + i;
+        bool fall_through = true;
+        if (!bb->insts.empty())
+        {
+            const GeneralInst* last_inst = bb->insts[bb->insts.size() - 1];
+            switch (last_inst->get_opcode())
+            {
+            case OpCodeEnum::Br:
+            case OpCodeEnum::Leave:
+                ++pred_counts[last_inst->get_branch_target() - _basic_blocks];
+                fall_through = false;
+                break;
+            case OpCodeEnum::BrTrue:
+            case OpCodeEnum::BrFalse:
+            case OpCodeEnum::Beq:
+            case OpCodeEnum::Bge:
+            case OpCodeEnum::Bgt:
+            case OpCodeEnum::Ble:
+            case OpCodeEnum::Blt:
+            case OpCodeEnum::BneUn:
+            case OpCodeEnum::BgeUn:
+            case OpCodeEnum::BgtUn:
+            case OpCodeEnum::BleUn:
+            case OpCodeEnum::BltUn:
+                ++pred_counts[last_inst->get_branch_target() - _basic_blocks];
+                break;
+            case OpCodeEnum::Switch:
+            {
+                auto switch_targets = last_inst->get_switch_targets();
+                for (size_t j = 0; j < switch_targets.second; ++j)
+                    ++pred_counts[switch_targets.first[j] - _basic_blocks];
+                break;
+            }
+            case OpCodeEnum::Ret:
+            case OpCodeEnum::Throw:
+            case OpCodeEnum::Rethrow:
+            case OpCodeEnum::EndFilter:
+            case OpCodeEnum::EndFinallyOrFault:
+                fall_through = false;
+                break;
+            default:
+                break;
+            }
+        }
+        if (fall_through && bb->next_bb)
+            ++pred_counts[bb->next_bb - _basic_blocks];
+    }
+
+    for (size_t i = 0; i < _basic_block_count; ++i)
+    {
+        const BasicBlock* cond_bb = _basic_blocks + i;
+        if (cond_bb->insts.empty())
+            continue;
+        const size_t branch_idx = cond_bb->insts.size() - 1;
+        const GeneralInst* branch_inst = cond_bb->insts[branch_idx];
+        if (branch_inst->get_opcode() != OpCodeEnum::Blt)
+            continue;
+        BasicBlock* body_bb = branch_inst->get_branch_target();
+        if (body_bb == cond_bb || body_bb == cond_bb->next_bb || pred_counts[body_bb - _basic_blocks] != 1)
+            continue;
+
+        const Variable* index_var = resolve_frame_var(cond_bb, branch_idx, branch_inst->get_var_arg1(), frame_size);
+        if (index_var == nullptr || address_taken_vars[index_var->id] || index_var->eval_stack_offset < _total_arg_stack_object_size ||
+            index_var->reduce_type != metadata::RtArgOrLocOrFieldReduceType::I4)
+            continue;
+
+        size_t len_idx;
+        if (!find_def_inst(cond_bb, branch_idx, branch_inst->get_var_arg2(), &len_idx))
+            continue;
+        const GeneralInst* len_inst = cond_bb->insts[len_idx];
+        if (len_inst->get_opcode() != OpCodeEnum::LdLen)
+            continue;
+        const Variable* arr_var = resolve_frame_var(cond_bb, len_idx, len_inst->get_var_src(), frame_size);
+        if (arr_var == nullptr || address_taken_vars[arr_var->id])
+            continue;
+        bool arr_stored = false;
+        for (size_t j = len_idx + 1; j < branch_idx; ++j)
+        {
+            if (may_write_frame_var(cond_bb->insts[j], arr_var))
+                arr_stored = true;
+        }
+        if (arr_stored || !is_counted_loop_index(index_var, body_bb))
+            continue;
+
+        for (size_t j = 0; j < body_bb->insts.size(); ++j)
+        {
+            GeneralInst* inst = const_cast<GeneralInst*>(body_bb->insts[j]);
+            if (is_checked_element_access(inst->get_opcode()) && resolve_frame_var(body_bb, j, inst->get_var_arg1(), frame_size) == arr_var &&
+                resolve_frame_var(body_bb, j, inst->get_var_arg2(), frame_size) == index_var)
+                inst->index_in_range = true;
+            if (may_write_frame_var(inst, index_var) || may_write_frame_var(inst, arr_var))
+                break;
+        }
+    }
     RET_VOID_OK();
 }
 
@@ -2302,6 +4237,7 @@ RtResultVoid Transformer::setup_basic_blocks()
     RET_ERR_ON_FAIL(splitter.split());
 
     const auto& split_offsets = splitter.get_split_offsets();
+    const auto& backward_branch_target_offsets = splitter.get_backward_branch_target_offsets();
     if (split_offsets.empty())
         RET_ERR(RtErr::ExecutionEngine);
 
@@ -2326,6 +4262,7 @@ RtResultVoid Transformer::setup_basic_blocks()
 
         cur_bb->visited = false;
         cur_bb->inited_eval_stack = false;
+        cur_bb->backward_branch_target = backward_branch_target_offsets.find(last_split_offset) != backward_branch_target_offsets.end();
         cur_bb->il_begin_offset = last_split_offset;
         cur_bb->il_end_offset = split_offset;
         cur_bb->eval_stack_top = 0;
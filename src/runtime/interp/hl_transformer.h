@@ -14,6 +14,8 @@ struct BasicBlock
 {
     bool visited;
     bool inited_eval_stack;
+    // reached by a branch from itself or a later block, after it has been transformed
+    bool backward_branch_target;
     size_t il_begin_offset;
     size_t il_end_offset;
     utils::NotFreeList<const GeneralInst*> insts;
@@ -24,7 +26,7 @@ struct BasicBlock
     BasicBlock* next_bb;
 
     BasicBlock(alloc::MemPool* pool)
-        : visited(false), inited_eval_stack(false), il_begin_offset(0), il_end_offset(0), insts(pool), in_eval_stack(pool), in_eval_stack_top(0),
+        : visited(false), inited_eval_stack(false), backward_branch_target(false), il_begin_offset(0), il_end_offset(0), insts(pool), in_eval_stack(pool), in_eval_stack_top(0),
           eval_stack(pool), eval_stack_top(0), next_bb(nullptr)
     {
     }
@@ -53,6 +55,10 @@ struct GeneralInst
     InstArgData dst_or_ret;
     il::OpCodePrefix prefix;
     IRExtraValue extra_data;
+    // the array of this element access is known to be non-null and the index to be within its bounds
+    bool index_in_range;
+    // the value type copied by CpObjAny or StObjAny holds references, so the copy goes through the write barrier
+    bool stores_references;
 
     OpCodeEnum get_opcode() const
     {
@@ -422,7 +428,8 @@ struct GeneralInst
 class Transformer
 {
   public:
-    Transformer(metadata::RtModuleDef* mod, const metadata::RtMethodInfo* method_info, const metadata::RtMethodBody& method_body, alloc::MemPool& mem_pool);
+    Transformer(metadata::RtModuleDef* mod, const metadata::RtMethodInfo* method_info, const metadata::RtMethodBody& method_body, alloc::MemPool& mem_pool,
+                bool optimize);
 
     RtResultVoid transform();
 
@@ -434,6 +441,10 @@ class Transformer
     size_t get_total_arg_and_local_stack_object_size() const;
     size_t get_max_stack_size() const;
     bool need_init_locals() const;
+    bool is_optimizing() const
+    {
+        return _optimize;
+    }
     const Variable* get_ret_var() const;
     const BasicBlock* get_basic_blocks() const;
     size_t get_basic_block_count() const
@@ -501,6 +512,7 @@ class Transformer
 
     RtResultVoid setup_target_branch_eval_stack(BasicBlock* target);
     RtResultVoid setup_next_and_target_branch_eval_stack(BasicBlock* target);
+    void add_count_back_edge(ptrdiff_t target_offset);
     RtResultVoid add_br(uint32_t next_offset, int32_t target_offset);
     RtResultVoid add_brtrue_or_false(uint32_t next_offset, int32_t target_offset, bool is_true);
     RtResultVoid add_condition_branch(uint32_t next_offset, int32_t target_offset, OpCodeEnum opcode);
@@ -526,6 +538,8 @@ class Transformer
     RtResultVoid add_call_common(const metadata::RtMethodInfo* method, metadata::RtInvokerType invoker_type, metadata::RtInvokeMethodPointer invoker,
                                  bool is_new_obj, bool is_call_vir);
     RtResultVoid add_call(const metadata::RtMethodInfo* method);
+    RtResult<bool> try_inline_call(const metadata::RtMethodInfo* method);
+    RtResultVoid add_inlined_body(const metadata::RtMethodInfo* method, const metadata::RtMethodBody& method_body, size_t frame_base_idx);
     RtResult<bool> try_handle_newobj_intrinsic(const metadata::RtMethodInfo* method);
     RtResultVoid add_newobj(const metadata::RtMethodInfo* method);
     RtResultVoid add_enum_hash_code_call(metadata::RtClass* enum_klass);
@@ -574,11 +588,18 @@ class Transformer
     RtResultVoid add_initblk();
     RtResultVoid add_sizeof(const metadata::RtTypeSig* type_sig);
     RtResultVoid transform_body();
+    const bool* collect_address_taken_vars();
+    RtResultVoid optimize_moves();
+    RtResultVoid fold_constants();
+    RtResultVoid remove_unreachable_basic_blocks();
+    bool is_counted_loop_index(const Variable* index_var, const BasicBlock* body_bb) const;
+    RtResultVoid eliminate_bounds_checks();
 
     metadata::RtModuleDef* _mod;
     const metadata::RtMethodInfo* _method;
     const metadata::RtMethodBody* _method_body;
     alloc::MemPool* _pool;
+    bool _optimize;
 
     metadata::RtGenericContainerContext _generic_container_context{};
     const metadata::RtGenericContext* _generic_context{nullptr};
@@ -1,5 +1,9 @@
+#include <algorithm>
+
 #include "interp_defs.h"
 
+#include "alloc/mem_pool.h"
+#include "utils/rt_vector.h"
 #include "vm/class.h"
 #include "vm/generic_class.h"
 
@@ -178,4 +182,99 @@ size_t InterpDefs::get_stack_object_size_by_byte_size(size_t byte_size)
     assert(byte_size <= UINT16_MAX * sizeof(RtStackObject) && "byte_size too large for stack object");
     return (byte_size + 7) / 8;
 }
+
+void InterpDefs::init_type_check_cache(RtTypeCheckCache* cache, metadata::RtClass* klass)
+{
+    cache->klass = klass;
+    // for a non-interface reference class, is_assignable_from reduces to the super type compare
+    const metadata::RtElementType ele_type = vm::Class::get_by_val_type_sig(klass)->ele_type;
+    cache->is_class_hierarchy_check = !vm::Class::is_interface(klass) &&
+                                      (ele_type == metadata::RtElementType::Class ||
+                                       (ele_type == metadata::RtElementType::GenericInst && !vm::Class::is_value_type(klass)));
+}
+
+void InterpDefs::build_exception_ranges(RtInterpMethodInfo* imi, alloc::MemPool& pool)
+{
+    const size_t clause_count = imi->exception_clause_count;
+    if (clause_count == 0)
+    {
+        return;
+    }
+
+    // try block boundaries split the IR into ranges whose covering clauses do not change
+    utils::Vector<uint32_t> bounds;
+    for (size_t i = 0; i < clause_count; ++i)
+    {
+        bounds.push_back(imi->exception_clauses[i].try_begin_offset);
+        bounds.push_back(imi->exception_clauses[i].try_end_offset);
+    }
+    std::sort(bounds.begin(), bounds.end());
+    bounds.resize(static_cast<size_t>(std::unique(bounds.begin(), bounds.end()) - bounds.begin()));
+
+    utils::Vector<RtInterpExceptionRange> ranges;
+    utils::Vector<uint8_t> clause_indices;
+    for (size_t i = 0; i + 1 < bounds.size(); ++i)
+    {
+        const uint32_t begin_offset = bounds[i];
+        const uint32_t end_offset = bounds[i + 1];
+        const size_t first_pos = clause_indices.size();
+        for (size_t j = 0; j < clause_count; ++j)
+        {
+            if (imi->exception_clauses[j].is_in_try_block(begin_offset))
+            {
+                clause_indices.push_back(static_cast<uint8_t>(j));
+            }
+        }
+        const size_t range_clause_count = clause_indices.size() - first_pos;
+        if (range_clause_count == 0)
+        {
+            continue;
+        }
+        if (!ranges.empty())
+        {
+            RtInterpExceptionRange& prev = ranges.back();
+            // a range covered by the same clauses as the one before it extends it
+            if (prev.end_offset == begin_offset && prev.clause_count == range_clause_count &&
+                std::equal(clause_indices.begin() + prev.first_clause_index_pos, clause_indices.begin() + first_pos, clause_indices.begin() + first_pos))
+            {
+                prev.end_offset = end_offset;
+                clause_indices.resize(first_pos);
+                continue;
+            }
+        }
+        ranges.push_back({begin_offset, end_offset, static_cast<uint32_t>(first_pos), static_cast<uint32_t>(range_clause_count)});
+    }
+
+    RtInterpExceptionRange* dst_ranges = pool.malloc_any_uninitialized<RtInterpExceptionRange>(ranges.size());
+    std::copy(ranges.begin(), ranges.end(), dst_ranges);
+    uint8_t* dst_clause_indices = pool.malloc_any_uninitialized<uint8_t>(clause_indices.size());
+    std::copy(clause_indices.begin(), clause_indices.end(), dst_clause_indices);
+    imi->exception_ranges = dst_ranges;
+    imi->exception_range_clause_indices = dst_clause_indices;
+    imi->exception_range_count = static_cast<uint32_t>(ranges.size());
+}
+
+const RtInterpExceptionRange* InterpDefs::find_exception_range(const RtInterpMethodInfo* imi, uint32_t ir_offset)
+{
+    const RtInterpExceptionRange* ranges = imi->exception_ranges;
+    size_t low = 0;
+    size_t high = imi->exception_range_count;
+    while (low < high)
+    {
+        const size_t mid = (low + high) / 2;
+        if (ranges[mid].end_offset <= ir_offset)
+        {
+            low = mid + 1;
+        }
+        else
+        {
+            high = mid;
+        }
+    }
+    if (low < imi->exception_range_count && ranges[low].begin_offset <= ir_offset)
+    {
+        return &ranges[low];
+    }
+    return nullptr;
+}
 } // namespace leanclr::interp
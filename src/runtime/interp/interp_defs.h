@@ -2,6 +2,11 @@
 
 #include "vm/rt_managed_types.h"
 
+namespace leanclr::alloc
+{
+class MemPool;
+}
+
 namespace leanclr::interp
 {
 // Stack object union for interpreter execution
@@ -66,21 +71,91 @@ struct RtInterpExceptionClause
     }
 };
 
+// Maximal IR range covered by the same try blocks. Its clauses are the clause_count indices starting at
+// RtInterpMethodInfo::exception_range_clause_indices[first_clause_index_pos], in clause order, so innermost first.
+struct RtInterpExceptionRange
+{
+    uint32_t begin_offset;
+    uint32_t end_offset;
+    uint32_t first_clause_index_pos;
+    uint32_t clause_count;
+};
+
 // Interpreter method info
 struct RtInterpMethodInfo
 {
     uint8_t* codes;
     const RtInterpExceptionClause* exception_clauses;
+    // sorted, non-overlapping ranges of the IR inside try blocks, binary searched by throw and leave
+    const RtInterpExceptionRange* exception_ranges;
+    const uint8_t* exception_range_clause_indices;
+    uint32_t exception_range_count;
     const void** resolved_datas;
     uint16_t total_arg_and_local_stack_object_size;
     uint16_t max_stack_object_size;
     uint8_t exception_clause_count;
     bool init_locals;
+    bool optimized;
+    // set on every frame entry and cleared by the clock sweep of the IR code cache
+    bool recently_used;
     uint32_t code_size;
+    // pool owning the method info and everything it points to, nullptr when it lives in the module pool
+    alloc::MemPool* code_pool;
 };
 
 // Constants
 const size_t INVALID_EVAL_STACK_OFFSET = static_cast<size_t>(UINT16_MAX);
+const size_t VIRTUAL_CALL_CACHE_ENTRY_COUNT = 4;
+
+// Size of the handler offset preceding every instruction of direct-threaded code.
+#if LEANCLR_USE_DIRECT_THREADED_DISPATCHER
+const size_t THREADED_CODE_HEADER_SIZE = sizeof(int32_t);
+#else
+const size_t THREADED_CODE_HEADER_SIZE = 0;
+#endif
+
+// Inline cache of a CallVirtInterp or Ldvirtftn call site, stored in the resolved data slot of the instruction.
+// Entries map receiver classes to the override of virtual_method and are replaced round-robin.
+struct RtVirtualCallCache
+{
+    const metadata::RtMethodInfo* virtual_method;
+    metadata::RtClass* klasses[VIRTUAL_CALL_CACHE_ENTRY_COUNT];
+    const metadata::RtMethodInfo* method_impls[VIRTUAL_CALL_CACHE_ENTRY_COUNT];
+    size_t next_replace_index;
+};
+
+const size_t TYPE_CHECK_CACHE_ENTRY_COUNT = 4;
+
+// Cache of a CastClass or IsInst site, stored in the resolved data slot of the instruction.
+// Casts to ordinary classes are a single super type compare and bypass the entries.
+struct RtTypeCheckCache
+{
+    metadata::RtClass* klass;
+    bool is_class_hierarchy_check;
+    bool results[TYPE_CHECK_CACHE_ENTRY_COUNT];
+    metadata::RtClass* from_klasses[TYPE_CHECK_CACHE_ENTRY_COUNT];
+    size_t next_replace_index;
+};
+
+// What a resolved data slot points to, recorded while transforming so the slot can be written to and restored from an IR cache.
+enum class RtResolvedDataKind : uint8_t
+{
+    Class,
+    Method,
+    Field,
+    FieldRvaData,
+    TypeSig,
+    UserString,
+    VirtualCallCache,
+    TypeCheckCache,
+};
+
+struct RtResolvedDataSource
+{
+    RtResolvedDataKind kind;
+    // the metadata the data was resolved from: the field for FieldRvaData, the data itself otherwise
+    const void* source;
+};
 
 struct ReduceTypeAndSize
 {
@@ -95,6 +170,11 @@ class InterpDefs
     static RtEvalStackDataType get_eval_stack_data_type_by_reduce_type(metadata::RtArgOrLocOrFieldReduceType reduce_type);
     static RtResult<ReduceTypeAndSize> get_reduce_type_and_size_by_typesig(const metadata::RtTypeSig* typeSig);
     static size_t get_stack_object_size_by_byte_size(size_t byte_size);
+    static void init_type_check_cache(RtTypeCheckCache* cache, metadata::RtClass* klass);
+    // Builds the exception ranges of imi from its exception clauses.
+    static void build_exception_ranges(RtInterpMethodInfo* imi, alloc::MemPool& pool);
+    // Returns the exception range covering ir_offset, or nullptr when no try block covers it.
+    static const RtInterpExceptionRange* find_exception_range(const RtInterpMethodInfo* imi, uint32_t ir_offset);
 };
 
 } // namespace leanclr::interp
@@ -1,9 +1,13 @@
+#include <optional>
 #include "interpreter.h"
 #include "vm/class.h"
 #include "metadata/module_def.h"
 #include "hl_transformer.h"
 #include "ll_transformer.h"
+#include "ir_cache.h"
+#include "code_cache.h"
 #include "machine_state.h"
+#include "opcode_profiler.h"
 #include "vm/object.h"
 #include "vm/rt_array.h"
 #include "vm/method.h"
@@ -12,11 +16,65 @@
 #include "vm/intrinsics.h"
 #include "vm/rt_exception.h"
 #include "vm/enum.h"
+#include "gc/garbage_collector.h"
 
 namespace leanclr::interp
 {
 
-static RtResult<const RtInterpMethodInfo*> transform(const metadata::RtMethodInfo* method)
+// Scratch memory of method transformations. Nothing the transformers allocate outlives build_interp_method_info(), so the
+// arena is rewound instead of freed between methods and settles at the size of the largest transformation.
+static alloc::MemPool* s_transform_arena = nullptr;
+static bool s_transform_arena_in_use = false;
+static size_t s_transform_arena_high_water_mark = 0;
+
+class TransformArenaScope
+{
+  public:
+    TransformArenaScope(size_t guess_size)
+    {
+        const size_t page_size = 1024;
+        if (s_transform_arena_in_use)
+        {
+            // a transformation nested in another one gets a pool of its own
+            _fallback_pool.emplace(guess_size, page_size, utils::MemOp::align_up(guess_size, page_size));
+            _pool = &_fallback_pool.value();
+            return;
+        }
+        if (!s_transform_arena)
+        {
+            s_transform_arena = alloc::GeneralAllocation::new_any<alloc::MemPool>(guess_size, page_size, utils::MemOp::align_up(guess_size, page_size));
+        }
+        s_transform_arena_in_use = true;
+        _pool = s_transform_arena;
+    }
+
+    ~TransformArenaScope()
+    {
+        if (_pool != s_transform_arena)
+        {
+            return;
+        }
+        s_transform_arena_high_water_mark = std::max(s_transform_arena_high_water_mark, s_transform_arena->get_used_size());
+        s_transform_arena->reset();
+        s_transform_arena_in_use = false;
+    }
+
+    alloc::MemPool& get_pool() const
+    {
+        return *_pool;
+    }
+
+  private:
+    alloc::MemPool* _pool;
+    std::optional<alloc::MemPool> _fallback_pool;
+};
+
+size_t Interpreter::get_transform_arena_high_water_mark()
+{
+    return s_transform_arena_high_water_mark;
+}
+
+static RtResult<const RtInterpMethodInfo*> transform(const metadata::RtMethodInfo* method, bool optimize)
 {
     metadata::RtClass* klass = method->parent;
     metadata::RtModuleDef* mod = !vm::Class::is_array_or_szarray(klass) ? klass->image : klass->parent->image;
@@ -29,25 +87,97 @@ static RtResult<const RtInterpMethodInfo*> transform(const metadata::RtMethodInf
     }
 
     metadata::RtMethodBody& methodBody = optMethodBody.value();
-    size_t guessSize = methodBody.code_size * 32;
-    size_t pageSize = 1024;
-    alloc::MemPool pool(guessSize, pageSize, utils::MemOp::align_up(guessSize, pageSize));
-    hl::Transformer hl_transformer(mod, method, methodBody, pool);
+    TransformArenaScope arena_scope(methodBody.code_size * 32);
+    alloc::MemPool& pool = arena_scope.get_pool();
+    hl::Transformer hl_transformer(mod, method, methodBody, pool, optimize);
     RET_ERR_ON_FAIL(hl_transformer.transform());
     ll::Transformer ll_transformer(hl_transformer, pool);
     RET_ERR_ON_FAIL(ll_transformer.transform());
     return ll_transformer.build_interp_method_info();
 }
 
+#if LEANCLR_USE_DIRECT_THREADED_DISPATCHER
+const size_t THREADED_HANDLER_TABLE_COUNT = 6;
+const size_t THREADED_HANDLER_TABLE_SIZE = 256;
+
+// Offsets of the handlers of the prefix0 to prefix5 opcodes from the dispatcher base label, exported by execute().
+static int32_t s_threaded_handler_offsets[THREADED_HANDLER_TABLE_COUNT][THREADED_HANDLER_TABLE_SIZE];
+
+void Interpreter::initialize()
+{
+    // a null method only exports the label tables of the dispatcher
+    auto ret = execute(nullptr, nullptr);
+    assert(ret.is_ok());
+    (void)ret;
+}
+
+void Interpreter::thread_instruction(uint8_t* codes)
+{
+    const uint8_t* inst = codes + THREADED_CODE_HEADER_SIZE;
+    int32_t handler_offset;
+    if (inst[0] >= static_cast<uint8_t>(ll::OpCodeValue0::Prefix1))
+    {
+        const size_t table_idx = inst[0] - static_cast<uint8_t>(ll::OpCodeValue0::Prefix1) + 1;
+        handler_offset = s_threaded_handler_offsets[table_idx][inst[1]];
+    }
+    else
+    {
+        handler_offset = s_threaded_handler_offsets[0][inst[0]];
+    }
+    std::memcpy(codes, &handler_offset, sizeof(handler_offset));
+}
+
+const int32_t* Interpreter::get_threaded_handler_offsets(size_t& count)
+{
+    count = THREADED_HANDLER_TABLE_COUNT * THREADED_HANDLER_TABLE_SIZE;
+    return &s_threaded_handler_offsets[0][0];
+}
+#else
+void Interpreter::initialize()
+{
+}
+#endif
+
+// The counters stop at the thresholds once the method is optimized, so they also tell the tier of code the code cache evicted.
+static bool is_hot(const metadata::RtMethodInfo* method)
+{
+    return method->invocation_count >= LEANCLR_TIER_UP_INVOCATION_THRESHOLD || method->back_edge_count >= LEANCLR_TIER_UP_BACK_EDGE_THRESHOLD;
+}
+
 RtResult<const RtInterpMethodInfo*> Interpreter::init_interpreter_method(const metadata::RtMethodInfo* method)
 {
     assert(!method->interp_data);
     RET_ERR_ON_FAIL(vm::Class::initialize_all(method->parent));
-    DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(const RtInterpMethodInfo*, interp_method, transform(method));
-    const_cast<metadata::RtMethodInfo*>(method)->interp_data = interp_method;
+    const RtInterpMethodInfo* cached_interp_method = IrCache::load_method(method);
+    if (cached_interp_method)
+    {
+        CodeCache::install(method, cached_interp_method);
+        RET_OK(cached_interp_method);
+    }
+    // most methods run only a few times, so they start with the cheaper unoptimized transform; a hot method whose code was
+    // evicted goes straight back to the optimized tier
+    const bool optimize = !LEANCLR_ENABLE_TIERED_EXECUTION || is_hot(method);
+    DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(const RtInterpMethodInfo*, interp_method, transform(method, optimize));
+    CodeCache::install(method, interp_method);
     RET_OK(interp_method);
 }
 
+RtResult<const RtInterpMethodInfo*> Interpreter::tier_up_interpreter_method_if_hot(const metadata::RtMethodInfo* method)
+{
+    const RtInterpMethodInfo* interp_method = method->interp_data;
+    assert(interp_method && !interp_method->optimized);
+    metadata::RtMethodInfo* mut_method = const_cast<metadata::RtMethodInfo*>(method);
+    ++mut_method->invocation_count;
+    if (!is_hot(method))
+    {
+        RET_OK(interp_method);
+    }
+    // frames already running the unoptimized code keep it through InterpFrame::imi
+    DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(const RtInterpMethodInfo*, optimized_interp_method, transform(method, true));
+    CodeCache::install(method, optimized_interp_method);
+    RET_OK(optimized_interp_method);
+}
+
 template <typename T>
 inline T get_stack_value_at(RtStackObject* base, size_t index)
 {
@@ -89,6 +219,121 @@ inline T* get_resolved_data(const RtInterpMethodInfo* imi, size_t index)
     return (T*)imi->resolved_datas[index];
 }
 
+inline RtResult<const metadata::RtMethodInfo*> get_virtual_method_impl_cached(RtVirtualCallCache* cache, metadata::RtClass* klass)
+{
+    for (size_t i = 0; i < VIRTUAL_CALL_CACHE_ENTRY_COUNT; ++i)
+    {
+        if (cache->klasses[i] == klass)
+        {
+            RET_OK(cache->method_impls[i]);
+        }
+    }
+    DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(const metadata::RtMethodInfo*, actual_method,
+                                            vm::Method::get_virtual_method_impl_on_klass(klass, cache->virtual_method));
+    size_t index = cache->next_replace_index;
+    cache->method_impls[index] = actual_method;
+    cache->klasses[index] = klass;
+    cache->next_replace_index = (index + 1) % VIRTUAL_CALL_CACHE_ENTRY_COUNT;
+    RET_OK(actual_method);
+}
+
+inline bool is_instance_of_cached(RtTypeCheckCache* cache, metadata::RtClass* klass)
+{
+    if (cache->is_class_hierarchy_check)
+    {
+        return vm::Class::has_class_parent_fast(klass, cache->klass);
+    }
+    for (size_t i = 0; i < TYPE_CHECK_CACHE_ENTRY_COUNT; ++i)
+    {
+        if (cache->from_klasses[i] == klass)
+        {
+            return cache->results[i];
+        }
+    }
+    bool result = vm::Class::is_assignable_from(klass, cache->klass);
+    size_t index = cache->next_replace_index;
+    cache->results[index] = result;
+    cache->from_klasses[index] = klass;
+    cache->next_replace_index = (index + 1) % TYPE_CHECK_CACHE_ENTRY_COUNT;
+    return result;
+}
+
+inline void quicken_code_to_no_cctor_opcode(uint8_t* codes)
+{
+    if (codes[0] == static_cast<uint8_t>(ll::OpCodeValue0::Prefix1))
+    {
+        ll::OpCodeValue2 quickened;
+        switch (static_cast<ll::OpCodeValue1>(codes[1]))
+        {
+        case ll::OpCodeValue1::LdsfldU1:
+            quickened = ll::OpCodeValue2::LdsfldU1NoCctor;
+            break;
+        case ll::OpCodeValue1::LdsfldI4:
+            quickened = ll::OpCodeValue2::LdsfldI4NoCctor;
+            break;
+        case ll::OpCodeValue1::LdsfldI8:
+            quickened = ll::OpCodeValue2::LdsfldI8NoCctor;
+            break;
+        case ll::OpCodeValue1::Ldsflda:
+            quickened = ll::OpCodeValue2::LdsfldaNoCctor;
+            break;
+        case ll::OpCodeValue1::StsfldI4:
+            quickened = ll::OpCodeValue2::StsfldI4NoCctor;
+            break;
+        case ll::OpCodeValue1::StsfldI8:
+            quickened = ll::OpCodeValue2::StsfldI8NoCctor;
+            break;
+        case ll::OpCodeValue1::CallInterp:
+            quickened = ll::OpCodeValue2::CallInterpNoCctor;
+            break;
+        default:
+            return;
+        }
+        codes[1] = static_cast<uint8_t>(quickened);
+        codes[0] = static_cast<uint8_t>(ll::OpCodeValue0::Prefix2);
+        return;
+    }
+
+    // superinstructions starting with one of these opcodes keep their code and their check
+    ll::OpCodeValue0 quickened;
+    switch (static_cast<ll::OpCodeValue0>(codes[0]))
+    {
+    case ll::OpCodeValue0::LdsfldU1Short:
+        quickened = ll::OpCodeValue0::LdsfldU1NoCctorShort;
+        break;
+    case ll::OpCodeValue0::LdsfldI4Short:
+        quickened = ll::OpCodeValue0::LdsfldI4NoCctorShort;
+        break;
+    case ll::OpCodeValue0::LdsfldI8Short:
+        quickened = ll::OpCodeValue0::LdsfldI8NoCctorShort;
+        break;
+    case ll::OpCodeValue0::LdsfldaShort:
+        quickened = ll::OpCodeValue0::LdsfldaNoCctorShort;
+        break;
+    case ll::OpCodeValue0::StsfldI4Short:
+        quickened = ll::OpCodeValue0::StsfldI4NoCctorShort;
+        break;
+    case ll::OpCodeValue0::StsfldI8Short:
+        quickened = ll::OpCodeValue0::StsfldI8NoCctorShort;
+        break;
+    case ll::OpCodeValue0::CallInterpShort:
+        quickened = ll::OpCodeValue0::CallInterpNoCctorShort;
+        break;
+    default:
+        return;
+    }
+    codes[0] = static_cast<uint8_t>(quickened);
+}
+
+inline void quicken_to_no_cctor_opcode(const uint8_t* ip)
+{
+    uint8_t* codes = const_cast<uint8_t*>(ip);
+    quicken_code_to_no_cctor_opcode(codes + THREADED_CODE_HEADER_SIZE);
+#if LEANCLR_USE_DIRECT_THREADED_DISPATCHER
+    Interpreter::thread_instruction(codes);
+#endif
+}
+
 template <typename Src, typename Dst>
 inline int32_t cast_float_to_small_int(Src value)
 {
@@ -275,6 +520,17 @@ struct ExceptionFlow
 
 static utils::Vector<ExceptionFlow> s_exception_flows;
 
+void Interpreter::mark_roots()
+{
+    for (const ExceptionFlow& flow : s_exception_flows)
+    {
+        if (flow.throw_flow)
+        {
+            gc::GarbageCollector::mark_object(flow.throw_data.ex);
+        }
+    }
+}
+
 ExceptionFlow* peek_top_exception_flow()
 {
     assert(!s_exception_flows.empty());
@@ -566,6 +822,16 @@ vm::RtException* get_exception_in_last_throw_flow(InterpFrame* frame, uint32_t i
         }                                                                                      \
     }
 
+// Static field accesses and static calls run the class constructor check until it first passes. The instruction is then
+// rewritten in place to its NoCctor form, which has the same layout.
+#define QUICKEN_IF_CCTOR_FINISHED(klass)              \
+    {                                                 \
+        if (!vm::Class::is_cctor_not_finished(klass)) \
+        {                                             \
+            quicken_to_no_cctor_opcode(ip);           \
+        }                                             \
+    }
+
 #define ENTER_INTERP_FRAME(_method, _frame_base_idx, _next_ip)                                                    \
     frame->save(_next_ip);                                                                                        \
     HANDLE_RAISE_RUNTIME_ERROR2(frame, ms.enter_frame_from_interp(_method, eval_stack_base + (_frame_base_idx))); \
@@ -588,22 +854,40 @@ T* get_static_field_address(const metadata::RtFieldInfo* field)
     return reinterpret_cast<T*>(klass->static_fields_data + field->offset);
 }
 
+#if LEANCLR_ENABLE_OPCODE_PAIR_PROFILE
+#define LEANCLR_PROFILE_OPCODE(code) OpcodeProfiler::record(ll::OpCodeEnum::code);
+#else
+#define LEANCLR_PROFILE_OPCODE(code)
+#endif
+
+#if LEANCLR_USE_DIRECT_THREADED_DISPATCHER
+// the prefix tables are only walked by Prefix1..Prefix5, which direct-threaded code never dispatches to
+#define LEANCLR_DISPATCH() goto* (static_cast<char*>(&&method_start) + *reinterpret_cast<const int32_t*>(ip));
+#elif LEANCLR_USE_COMPUTED_GOTO_DISPATCHER
+#define LEANCLR_DISPATCH() goto* in_labels0[*ip];
+#endif
+
 #if LEANCLR_USE_COMPUTED_GOTO_DISPATCHER
 #define LEANCLR_SWITCH_N(n, op_offset) goto* in_labels##n[ip[op_offset]];
 #define LEANCLR_CONTINUE_N(n, op_offset) goto* in_labels##n[ip[op_offset]];
 #define LEANCLR_CASE_BEGIN_N(n, code) \
     LABEL##n##_##code:                \
     {                                 \
-        const auto ir = (ll::code*)ip;
+        LEANCLR_PROFILE_OPCODE(code)  \
+        const auto ir = (ll::code*)(ip + THREADED_CODE_HEADER_SIZE);
 #define LEANCLR_CASE_BEGIN_LITE_N(n, code) \
     LABEL##n##_##code:                     \
+    {                                      \
+        LEANCLR_PROFILE_OPCODE(code)
+#define LEANCLR_CASE_BEGIN_DISPATCH_N(n, code) \
+    LABEL##n##_##code:                         \
     {
 #define LEANCLR_CASE_END_N(n)                      \
     ip = reinterpret_cast<const uint8_t*>(ir + 1); \
-    goto* in_labels0[*ip];                         \
+    LEANCLR_DISPATCH()                             \
     }
 #define LEANCLR_CASE_END_LITE_N(n) \
-    goto* in_labels0[*ip];         \
+    LEANCLR_DISPATCH()             \
     }
 
 #else
@@ -614,10 +898,15 @@ T* get_static_field_address(const metadata::RtFieldInfo* field)
 #define LEANCLR_CASE_BEGIN_N(n, code) \
     case ll::OpCodeValue##n::code:    \
     {                                 \
-        const auto ir = (ll::code*)ip;
+        LEANCLR_PROFILE_OPCODE(code)  \
+        const auto ir = (ll::code*)(ip + THREADED_CODE_HEADER_SIZE);
 
 #define LEANCLR_CASE_BEGIN_LITE_N(n, code) \
     case ll::OpCodeValue##n::code:         \
+    {                                      \
+        LEANCLR_PROFILE_OPCODE(code)
+#define LEANCLR_CASE_BEGIN_DISPATCH_N(n, code) \
+    case ll::OpCodeValue##n::code:             \
     {
 #define LEANCLR_CASE_END_N(n)                      \
     ip = reinterpret_cast<const uint8_t*>(ir + 1); \
@@ -628,10 +917,17 @@ T* get_static_field_address(const metadata::RtFieldInfo* field)
     }
 #endif
 
+#if LEANCLR_USE_COMPUTED_GOTO_DISPATCHER
+#define LEANCLR_SWITCH0() LEANCLR_DISPATCH()
+#define LEANCLR_CONTINUE0() LEANCLR_DISPATCH()
+#else
 #define LEANCLR_SWITCH0() LEANCLR_SWITCH_N(0, 0)
 #define LEANCLR_CONTINUE0() LEANCLR_CONTINUE_N(0, 0)
+#endif
 #define LEANCLR_CASE_BEGIN0(code) LEANCLR_CASE_BEGIN_N(0, code)
 #define LEANCLR_CASE_BEGIN_LITE0(code) LEANCLR_CASE_BEGIN_LITE_N(0, code)
+// prefix and unused-code entries only dispatch further, they are not opcodes of their own
+#define LEANCLR_CASE_BEGIN_DISPATCH0(code) LEANCLR_CASE_BEGIN_DISPATCH_N(0, code)
 #define LEANCLR_CASE_END0() LEANCLR_CASE_END_N(0)
 #define LEANCLR_CASE_END_LITE0() LEANCLR_CASE_END_LITE_N(0)
 
@@ -672,10 +968,6 @@ T* get_static_field_address(const metadata::RtFieldInfo* field)
 
 RtResult<const RtStackObject*> Interpreter::execute(const metadata::RtMethodInfo* method, const interp::RtStackObject* params)
 {
-    MachineState& ms = MachineState::get_global_machine_state();
-    MachineStateSavePoint sp(ms);
-    DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL3(InterpFrame*, frame, ms.enter_frame_from_native(method, params));
-
 #pragma region goto_lable
 #if LEANCLR_USE_COMPUTED_GOTO_DISPATCHER
     ///{{COMPUTED_GOTO_LABELS
@@ -915,22 +1207,22 @@ RtResult<const RtStackObject*> Interpreter::execute(const metadata::RtMethodInfo
         &&LABEL0_EndFilterShort,
         &&LABEL0_EndFinallyShort,
         &&LABEL0_EndFaultShort,
-        &&LABEL0___UnusedF9,
-        &&LABEL0___UnusedF9,
-        &&LABEL0___UnusedF9,
-        &&LABEL0___UnusedF9,
-        &&LABEL0___UnusedF9,
-        &&LABEL0___UnusedF9,
-        &&LABEL0___UnusedF9,
-        &&LABEL0___UnusedF9,
-        &&LABEL0___UnusedF9,
-        &&LABEL0___UnusedF9,
-        &&LABEL0___UnusedF9,
-        &&LABEL0___UnusedF9,
-        &&LABEL0___UnusedF9,
-        &&LABEL0___UnusedF9,
-        &&LABEL0___UnusedF9,
-        &&LABEL0___UnusedF9,
+        &&LABEL0_CheckNullShort,
+        &&LABEL0_LdsfldU1NoCctorShort,
+        &&LABEL0_LdsfldI4NoCctorShort,
+        &&LABEL0_LdsfldI8NoCctorShort,
+        &&LABEL0_LdsfldaNoCctorShort,
+        &&LABEL0_StsfldI4NoCctorShort,
+        &&LABEL0_StsfldI8NoCctorShort,
+        &&LABEL0_CallInterpNoCctorShort,
+        &&LABEL0_LdelemI4UncheckedShort,
+        &&LABEL0_LdelemR4UncheckedShort,
+        &&LABEL0_LdelemR8UncheckedShort,
+        &&LABEL0_StelemI4UncheckedShort,
+        &&LABEL0_StelemR4UncheckedShort,
+        &&LABEL0_StelemR8UncheckedShort,
+        &&LABEL0_StfldRefShort,
+        &&LABEL0___UnusedFA,
         &&LABEL0_Prefix1,
         &&LABEL0_Prefix2,
         &&LABEL0_Prefix3,
@@ -1188,6 +1480,10 @@ RtResult<const RtStackObject*> Interpreter::execute(const metadata::RtMethodInfo
         &&LABEL1_EndFilter,
         &&LABEL1_EndFinally,
         &&LABEL1_EndFault,
+        &&LABEL1_CheckNull,
+        &&LABEL1_StfldRef,
+        &&LABEL1_StIndRefShort,
+        &&LABEL1_CpObjRef,
     };
     static void* const in_labels2[] = {
         &&LABEL2_LdIndI1,  &&LABEL2_LdIndU1,   &&LABEL2_LdIndI2,
@@ -1207,6 +1503,21 @@ RtResult<const RtStackObject*> Interpreter::execute(const metadata::RtMethodInfo
         &&LABEL2_ConvR4I8, &&LABEL2_ConvR4R8,  &&LABEL2_ConvR8I4,
         &&LABEL2_ConvR8I8, &&LABEL2_ConvR8R4,  &&LABEL2_LdelemaReadOnly,
         &&LABEL2_InitBlk,  &&LABEL2_CpBlk,     &&LABEL2_GetEnumLongHashCode,
+        &&LABEL2_LdsfldU1NoCctor, &&LABEL2_LdsfldI4NoCctor, &&LABEL2_LdsfldI8NoCctor,
+        &&LABEL2_LdsfldaNoCctor,  &&LABEL2_StsfldI4NoCctor, &&LABEL2_StsfldI8NoCctor,
+        &&LABEL2_CallInterpNoCctor, &&LABEL2_CountBackEdge,
+        &&LABEL2_LdelemaUnchecked, &&LABEL2_LdelemaReadOnlyUnchecked, &&LABEL2_LdelemI1Unchecked,
+        &&LABEL2_LdelemU1Unchecked, &&LABEL2_LdelemI2Unchecked, &&LABEL2_LdelemU2Unchecked,
+        &&LABEL2_LdelemI4Unchecked, &&LABEL2_LdelemI8Unchecked, &&LABEL2_LdelemIUnchecked,
+        &&LABEL2_LdelemR4Unchecked, &&LABEL2_LdelemR8Unchecked, &&LABEL2_LdelemRefUnchecked,
+        &&LABEL2_StelemI1Unchecked, &&LABEL2_StelemI2Unchecked, &&LABEL2_StelemI4Unchecked,
+        &&LABEL2_StelemI8Unchecked, &&LABEL2_StelemIUnchecked, &&LABEL2_StelemR4Unchecked,
+        &&LABEL2_StelemR8Unchecked,
+        &&LABEL2_InvokeDelegate,
+        &&LABEL2_StfldAnyRef,
+        &&LABEL2_StIndRef,
+        &&LABEL2_CpObjAnyRef,
+        &&LABEL2_StObjAnyRef,
     };
     static void* const in_labels3[] = {
         &&LABEL3_LdIndI2Unaligned,   &&LABEL3_LdIndU2Unaligned,  &&LABEL3_LdIndI4Unaligned,   &&LABEL3_LdIndI8Unaligned,   &&LABEL3_StIndI2Unaligned,
@@ -1231,7 +1542,7 @@ RtResult<const RtStackObject*> Interpreter::execute(const metadata::RtMethodInfo
         &&LABEL3_LdvfldI2Unaligned,  &&LABEL3_LdvfldU2Large,     &&LABEL3_LdvfldU2Unaligned,  &&LABEL3_LdvfldI4Large,      &&LABEL3_LdvfldI4Unaligned,
         &&LABEL3_LdvfldI8Large,      &&LABEL3_LdvfldI8Unaligned, &&LABEL3_LdvfldAnyLarge,     &&LABEL3_LdfldaLarge,        &&LABEL3_StfldI1Large,
         &&LABEL3_StfldI2Large,       &&LABEL3_StfldI2Unaligned,  &&LABEL3_StfldI4Large,       &&LABEL3_StfldI4Unaligned,   &&LABEL3_StfldI8Large,
-        &&LABEL3_StfldI8Unaligned,   &&LABEL3_StfldAnyLarge,
+        &&LABEL3_StfldI8Unaligned,   &&LABEL3_StfldAnyLarge,      &&LABEL3_StfldRefLarge,      &&LABEL3_StfldAnyRefLarge,
     };
     static void* const in_labels4[] = {
         &&LABEL4_Illegal,
@@ -1244,13 +1555,38 @@ RtResult<const RtStackObject*> Interpreter::execute(const metadata::RtMethodInfo
 #endif
 #pragma endregion
 
+#if LEANCLR_USE_DIRECT_THREADED_DISPATCHER
+    if (method == nullptr)
+    {
+        void* const* const label_tables[THREADED_HANDLER_TABLE_COUNT] = {in_labels0, in_labels1, in_labels2, in_labels3, in_labels4, in_labels5};
+        const size_t label_counts[THREADED_HANDLER_TABLE_COUNT] = {
+            sizeof(in_labels0) / sizeof(void*), sizeof(in_labels1) / sizeof(void*), sizeof(in_labels2) / sizeof(void*),
+            sizeof(in_labels3) / sizeof(void*), sizeof(in_labels4) / sizeof(void*), sizeof(in_labels5) / sizeof(void*),
+        };
+        for (size_t i = 0; i < THREADED_HANDLER_TABLE_COUNT; ++i)
+        {
+            for (size_t j = 0; j < THREADED_HANDLER_TABLE_SIZE; ++j)
+            {
+                // codes past the end of a table are never emitted
+                void* label = j < label_counts[i] ? label_tables[i][j] : &&LABEL4_Illegal;
+                s_threaded_handler_offsets[i][j] = static_cast<int32_t>(static_cast<char*>(label) - static_cast<char*>(&&method_start));
+            }
+        }
+        RET_OK(nullptr);
+    }
+#endif
+
+    MachineState& ms = MachineState::get_global_machine_state();
+    MachineStateSavePoint sp(ms);
+    DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL3(InterpFrame*, frame, ms.enter_frame_from_native(method, params));
+
     const uint8_t* ip = frame->ip;
     const RtStackObject* ret = frame->eval_stack_base;
 
 method_start:
 {
     RtStackObject* const eval_stack_base = frame->eval_stack_base;
-    const RtInterpMethodInfo* const imi = frame->method->interp_data;
+    const RtInterpMethodInfo* const imi = frame->imi;
     // loop_start:
     while (true)
     {
@@ -1432,13 +1768,13 @@ method_start:
             LEANCLR_CASE_END0()
             LEANCLR_CASE_BEGIN_LITE0(BrShort)
             {
-                const auto* ir = (ll::Br*)ip;
+                const auto* ir = (ll::BrShort*)(ip + THREADED_CODE_HEADER_SIZE);
                 ip = reinterpret_cast<const uint8_t*>(ip + ir->target_offset);
             }
             LEANCLR_CASE_END_LITE0()
             LEANCLR_CASE_BEGIN_LITE0(BrTrueI4Short)
             {
-                const auto* ir = (ll::BrTrueI4*)ip;
+                const auto* ir = (ll::BrTrueI4Short*)(ip + THREADED_CODE_HEADER_SIZE);
                 RtStackObject* cond = eval_stack_base + ir->condition;
                 if (cond->i32 != 0)
                 {
@@ -1452,7 +1788,7 @@ method_start:
             LEANCLR_CASE_END_LITE0()
             LEANCLR_CASE_BEGIN_LITE0(BrTrueI8Short)
             {
-                const auto* ir = (ll::BrTrueI8*)ip;
+                const auto* ir = (ll::BrTrueI8Short*)(ip + THREADED_CODE_HEADER_SIZE);
                 RtStackObject* cond = eval_stack_base + ir->condition;
                 if (cond->i64 != 0)
                 {
@@ -1466,7 +1802,7 @@ method_start:
             LEANCLR_CASE_END_LITE0()
             LEANCLR_CASE_BEGIN_LITE0(BrFalseI4Short)
             {
-                const auto* ir = (ll::BrFalseI4*)ip;
+                const auto* ir = (ll::BrFalseI4Short*)(ip + THREADED_CODE_HEADER_SIZE);
                 RtStackObject* cond = eval_stack_base + ir->condition;
                 if (cond->i32 == 0)
                 {
@@ -1480,7 +1816,7 @@ method_start:
             LEANCLR_CASE_END_LITE0()
             LEANCLR_CASE_BEGIN_LITE0(BrFalseI8Short)
             {
-                const auto* ir = (ll::BrFalseI8*)ip;
+                const auto* ir = (ll::BrFalseI8Short*)(ip + THREADED_CODE_HEADER_SIZE);
                 RtStackObject* cond = eval_stack_base + ir->condition;
                 if (cond->i64 == 0)
                 {
@@ -1494,7 +1830,7 @@ method_start:
             LEANCLR_CASE_END_LITE0()
             LEANCLR_CASE_BEGIN_LITE0(BeqI4Short)
             {
-                const auto* ir = (ll::BeqI4*)ip;
+                const auto* ir = (ll::BeqI4Short*)(ip + THREADED_CODE_HEADER_SIZE);
                 RtStackObject* op1 = eval_stack_base + ir->arg1;
                 RtStackObject* op2 = eval_stack_base + ir->arg2;
                 if (op1->i32 == op2->i32)
@@ -1509,7 +1845,7 @@ method_start:
             LEANCLR_CASE_END_LITE0()
             LEANCLR_CASE_BEGIN_LITE0(BeqI8Short)
             {
-                const auto* ir = (ll::BeqI8*)ip;
+                const auto* ir = (ll::BeqI8Short*)(ip + THREADED_CODE_HEADER_SIZE);
                 RtStackObject* op1 = eval_stack_base + ir->arg1;
                 RtStackObject* op2 = eval_stack_base + ir->arg2;
                 if (op1->i64 == op2->i64)
@@ -1524,7 +1860,7 @@ method_start:
             LEANCLR_CASE_END_LITE0()
             LEANCLR_CASE_BEGIN_LITE0(BgeI4Short)
             {
-                const auto* ir = (ll::BgeI4*)ip;
+                const auto* ir = (ll::BgeI4Short*)(ip + THREADED_CODE_HEADER_SIZE);
                 RtStackObject* op1 = eval_stack_base + ir->arg1;
                 RtStackObject* op2 = eval_stack_base + ir->arg2;
                 if (op1->i32 >= op2->i32)
@@ -1539,7 +1875,7 @@ method_start:
             LEANCLR_CASE_END_LITE0()
             LEANCLR_CASE_BEGIN_LITE0(BgeI8Short)
             {
-                const auto* ir = (ll::BgeI8*)ip;
+                const auto* ir = (ll::BgeI8Short*)(ip + THREADED_CODE_HEADER_SIZE);
                 RtStackObject* op1 = eval_stack_base + ir->arg1;
                 RtStackObject* op2 = eval_stack_base + ir->arg2;
                 if (op1->i64 >= op2->i64)
@@ -1554,7 +1890,7 @@ method_start:
             LEANCLR_CASE_END_LITE0()
             LEANCLR_CASE_BEGIN_LITE0(BgtI4Short)
             {
-                const auto* ir = (ll::BgtI4*)ip;
+                const auto* ir = (ll::BgtI4Short*)(ip + THREADED_CODE_HEADER_SIZE);
                 RtStackObject* op1 = eval_stack_base + ir->arg1;
                 RtStackObject* op2 = eval_stack_base + ir->arg2;
                 if (op1->i32 > op2->i32)
@@ -1569,7 +1905,7 @@ method_start:
             LEANCLR_CASE_END_LITE0()
             LEANCLR_CASE_BEGIN_LITE0(BgtI8Short)
             {
-                const auto* ir = (ll::BgtI8*)ip;
+                const auto* ir = (ll::BgtI8Short*)(ip + THREADED_CODE_HEADER_SIZE);
                 RtStackObject* op1 = eval_stack_base + ir->arg1;
                 RtStackObject* op2 = eval_stack_base + ir->arg2;
                 if (op1->i64 > op2->i64)
@@ -1584,7 +1920,7 @@ method_start:
             LEANCLR_CASE_END_LITE0()
             LEANCLR_CASE_BEGIN_LITE0(BleI4Short)
             {
-                const auto* ir = (ll::BleI4*)ip;
+                const auto* ir = (ll::BleI4Short*)(ip + THREADED_CODE_HEADER_SIZE);
                 RtStackObject* op1 = eval_stack_base + ir->arg1;
                 RtStackObject* op2 = eval_stack_base + ir->arg2;
                 if (op1->i32 <= op2->i32)
@@ -1599,7 +1935,7 @@ method_start:
             LEANCLR_CASE_END_LITE0()
             LEANCLR_CASE_BEGIN_LITE0(BleI8Short)
             {
-                const auto* ir = (ll::BleI8*)ip;
+                const auto* ir = (ll::BleI8Short*)(ip + THREADED_CODE_HEADER_SIZE);
                 RtStackObject* op1 = eval_stack_base + ir->arg1;
                 RtStackObject* op2 = eval_stack_base + ir->arg2;
                 if (op1->i64 <= op2->i64)
@@ -1614,7 +1950,7 @@ method_start:
             LEANCLR_CASE_END_LITE0()
             LEANCLR_CASE_BEGIN_LITE0(BltI4Short)
             {
-                const auto* ir = (ll::BltI4*)ip;
+                const auto* ir = (ll::BltI4Short*)(ip + THREADED_CODE_HEADER_SIZE);
                 RtStackObject* op1 = eval_stack_base + ir->arg1;
                 RtStackObject* op2 = eval_stack_base + ir->arg2;
                 if (op1->i32 < op2->i32)
@@ -1629,7 +1965,7 @@ method_start:
             LEANCLR_CASE_END_LITE0()
             LEANCLR_CASE_BEGIN_LITE0(BltI8Short)
             {
-                const auto* ir = (ll::BltI8*)ip;
+                const auto* ir = (ll::BltI8Short*)(ip + THREADED_CODE_HEADER_SIZE);
                 RtStackObject* op1 = eval_stack_base + ir->arg1;
                 RtStackObject* op2 = eval_stack_base + ir->arg2;
                 if (op1->i64 < op2->i64)
@@ -1644,7 +1980,7 @@ method_start:
             LEANCLR_CASE_END_LITE0()
             LEANCLR_CASE_BEGIN_LITE0(BneUnI4Short)
             {
-                const auto* ir = (ll::BneUnI4*)ip;
+                const auto* ir = (ll::BneUnI4Short*)(ip + THREADED_CODE_HEADER_SIZE);
                 RtStackObject* op1 = eval_stack_base + ir->arg1;
                 RtStackObject* op2 = eval_stack_base + ir->arg2;
                 if (op1->u32 != op2->u32)
@@ -1659,7 +1995,7 @@ method_start:
             LEANCLR_CASE_END_LITE0()
             LEANCLR_CASE_BEGIN_LITE0(BneUnI8Short)
             {
-                const auto* ir = (ll::BneUnI8*)ip;
+                const auto* ir = (ll::BneUnI8Short*)(ip + THREADED_CODE_HEADER_SIZE);
                 RtStackObject* op1 = eval_stack_base + ir->arg1;
                 RtStackObject* op2 = eval_stack_base + ir->arg2;
                 if (op1->u64 != op2->u64)
@@ -1674,7 +2010,7 @@ method_start:
             LEANCLR_CASE_END_LITE0()
             LEANCLR_CASE_BEGIN_LITE0(BgeUnI4Short)
             {
-                const auto* ir = (ll::BgeUnI4*)ip;
+                const auto* ir = (ll::BgeUnI4Short*)(ip + THREADED_CODE_HEADER_SIZE);
                 RtStackObject* op1 = eval_stack_base + ir->arg1;
                 RtStackObject* op2 = eval_stack_base + ir->arg2;
                 if (op1->u32 >= op2->u32)
@@ -1689,7 +2025,7 @@ method_start:
             LEANCLR_CASE_END_LITE0()
             LEANCLR_CASE_BEGIN_LITE0(BgeUnI8Short)
             {
-                const auto* ir = (ll::BgeUnI8*)ip;
+                const auto* ir = (ll::BgeUnI8Short*)(ip + THREADED_CODE_HEADER_SIZE);
                 RtStackObject* op1 = eval_stack_base + ir->arg1;
                 RtStackObject* op2 = eval_stack_base + ir->arg2;
                 if (op1->u64 >= op2->u64)
@@ -1704,7 +2040,7 @@ method_start:
             LEANCLR_CASE_END_LITE0()
             LEANCLR_CASE_BEGIN_LITE0(BgtUnI4Short)
             {
-                const auto* ir = (ll::BgtUnI4*)ip;
+                const auto* ir = (ll::BgtUnI4Short*)(ip + THREADED_CODE_HEADER_SIZE);
                 RtStackObject* op1 = eval_stack_base + ir->arg1;
                 RtStackObject* op2 = eval_stack_base + ir->arg2;
                 if (op1->u32 > op2->u32)
@@ -1719,7 +2055,7 @@ method_start:
             LEANCLR_CASE_END_LITE0()
             LEANCLR_CASE_BEGIN_LITE0(BgtUnI8Short)
             {
-                const auto* ir = (ll::BgtUnI8*)ip;
+                const auto* ir = (ll::BgtUnI8Short*)(ip + THREADED_CODE_HEADER_SIZE);
                 RtStackObject* op1 = eval_stack_base + ir->arg1;
                 RtStackObject* op2 = eval_stack_base + ir->arg2;
                 if (op1->u64 > op2->u64)
@@ -1734,7 +2070,7 @@ method_start:
             LEANCLR_CASE_END_LITE0()
             LEANCLR_CASE_BEGIN_LITE0(BleUnI4Short)
             {
-                const auto* ir = (ll::BleUnI4*)ip;
+                const auto* ir = (ll::BleUnI4Short*)(ip + THREADED_CODE_HEADER_SIZE);
                 RtStackObject* op1 = eval_stack_base + ir->arg1;
                 RtStackObject* op2 = eval_stack_base + ir->arg2;
                 if (op1->u32 <= op2->u32)
@@ -1749,7 +2085,7 @@ method_start:
             LEANCLR_CASE_END_LITE0()
             LEANCLR_CASE_BEGIN_LITE0(BleUnI8Short)
             {
-                const auto* ir = (ll::BleUnI8*)ip;
+                const auto* ir = (ll::BleUnI8Short*)(ip + THREADED_CODE_HEADER_SIZE);
                 RtStackObject* op1 = eval_stack_base + ir->arg1;
                 RtStackObject* op2 = eval_stack_base + ir->arg2;
                 if (op1->u64 <= op2->u64)
@@ -1764,7 +2100,7 @@ method_start:
             LEANCLR_CASE_END_LITE0()
             LEANCLR_CASE_BEGIN_LITE0(BltUnI4Short)
             {
-                const auto* ir = (ll::BltUnI4*)ip;
+                const auto* ir = (ll::BltUnI4Short*)(ip + THREADED_CODE_HEADER_SIZE);
                 RtStackObject* op1 = eval_stack_base + ir->arg1;
                 RtStackObject* op2 = eval_stack_base + ir->arg2;
                 if (op1->u32 < op2->u32)
@@ -1779,7 +2115,7 @@ method_start:
             LEANCLR_CASE_END_LITE0()
             LEANCLR_CASE_BEGIN_LITE0(BltUnI8Short)
             {
-                const auto* ir = (ll::BltUnI8*)ip;
+                const auto* ir = (ll::BltUnI8Short*)(ip + THREADED_CODE_HEADER_SIZE);
                 RtStackObject* op1 = eval_stack_base + ir->arg1;
                 RtStackObject* op2 = eval_stack_base + ir->arg2;
                 if (op1->u64 < op2->u64)
@@ -2573,8 +2909,8 @@ method_start:
                 vm::RtObject* obj = get_stack_value_at<vm::RtObject*>(eval_stack_base, ir->obj);
                 if (obj)
                 {
-                    metadata::RtClass* to_class = get_resolved_data<metadata::RtClass>(imi, ir->klass_idx);
-                    if (!vm::Class::is_assignable_from(obj->klass, to_class))
+                    RtTypeCheckCache* cache = get_resolved_data<RtTypeCheckCache>(imi, ir->klass_idx);
+                    if (!is_instance_of_cached(cache, obj->klass))
                     {
                         RAISE_RUNTIME_ERROR(RtErr::InvalidCast);
                     }
@@ -2587,8 +2923,8 @@ method_start:
                 vm::RtObject* result;
                 if (obj)
                 {
-                    metadata::RtClass* to_class = get_resolved_data<metadata::RtClass>(imi, ir->klass_idx);
-                    result = vm::Class::is_assignable_from(obj->klass, to_class) ? obj : nullptr;
+                    RtTypeCheckCache* cache = get_resolved_data<RtTypeCheckCache>(imi, ir->klass_idx);
+                    result = is_instance_of_cached(cache, obj->klass) ? obj : nullptr;
                 }
                 else
                 {
@@ -3014,7 +3350,7 @@ method_start:
                     RAISE_RUNTIME_ERROR(RtErr::IndexOutOfRange);
                 }
                 vm::RtObject* value = get_stack_value_at<vm::RtObject*>(eval_stack_base, ir->value);
-                vm::Array::set_array_data_at<vm::RtObject*>(array, index, value);
+                gc::GarbageCollector::write_barrier(vm::Array::get_array_element_address<vm::RtObject*>(array, index), value);
             }
             LEANCLR_CASE_END0()
             LEANCLR_CASE_BEGIN0(StelemAnyRefShort)
@@ -3035,7 +3371,7 @@ method_start:
                 {
                     RAISE_RUNTIME_ERROR(RtErr::ArrayTypeMismatch);
                 }
-                vm::Array::set_array_data_at<vm::RtObject*>(array, index, value);
+                gc::GarbageCollector::write_barrier(vm::Array::get_array_element_address<vm::RtObject*>(array, index), value);
             }
             LEANCLR_CASE_END0()
             LEANCLR_CASE_BEGIN0(StelemAnyValShort)
@@ -3060,6 +3396,10 @@ method_start:
                 RtStackObject* src = eval_stack_base + ir->value;
                 void* dst_addr = const_cast<void*>(vm::Array::get_array_element_address_with_size_as_ptr_void(array, index, ir->ele_size));
                 std::memcpy(dst_addr, src, ir->ele_size);
+                if (vm::Class::get_has_references(ele_klass))
+                {
+                    gc::GarbageCollector::write_barrier_range(dst_addr, ir->ele_size);
+                }
             }
             LEANCLR_CASE_END0()
             LEANCLR_CASE_BEGIN0(LdftnShort)
@@ -3075,9 +3415,9 @@ method_start:
                 {
                     RAISE_RUNTIME_ERROR(RtErr::NullReference);
                 }
-                const metadata::RtMethodInfo* method = get_resolved_data<metadata::RtMethodInfo>(imi, ir->method_idx);
-                assert(method->slot < method->parent->vtable_count);
-                DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(const metadata::RtMethodInfo*, actual_method, vm::Method::get_virtual_method_impl(obj, method));
+                RtVirtualCallCache* cache = get_resolved_data<RtVirtualCallCache>(imi, ir->method_idx);
+                assert(cache->virtual_method->slot < cache->virtual_method->parent->vtable_count);
+                DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(const metadata::RtMethodInfo*, actual_method, get_virtual_method_impl_cached(cache, obj->klass));
                 set_stack_value_at(eval_stack_base, ir->dst, actual_method);
             }
             LEANCLR_CASE_END0()
@@ -3305,6 +3645,7 @@ method_start:
             {
                 const metadata::RtFieldInfo* field = get_resolved_data<metadata::RtFieldInfo>(imi, ir->field_idx);
                 TRY_RUN_CLASS_STATIC_CCTOR(field->parent);
+                QUICKEN_IF_CCTOR_FINISHED(field->parent);
                 const uint8_t* field_addr = get_static_field_address<uint8_t>(field);
                 uint8_t value = *field_addr;
                 set_stack_value_at<int32_t>(eval_stack_base, ir->dst, static_cast<int32_t>(value));
@@ -3332,6 +3673,7 @@ method_start:
             {
                 const metadata::RtFieldInfo* field = get_resolved_data<metadata::RtFieldInfo>(imi, ir->field_idx);
                 TRY_RUN_CLASS_STATIC_CCTOR(field->parent);
+                QUICKEN_IF_CCTOR_FINISHED(field->parent);
                 const int32_t* field_addr = get_static_field_address<int32_t>(field);
                 int32_t value = *field_addr;
                 set_stack_value_at<int32_t>(eval_stack_base, ir->dst, value);
@@ -3341,6 +3683,7 @@ method_start:
             {
                 const metadata::RtFieldInfo* field = get_resolved_data<metadata::RtFieldInfo>(imi, ir->field_idx);
                 TRY_RUN_CLASS_STATIC_CCTOR(field->parent);
+                QUICKEN_IF_CCTOR_FINISHED(field->parent);
                 const int64_t* field_addr = get_static_field_address<int64_t>(field);
                 int64_t value = *field_addr;
                 set_stack_value_at<int64_t>(eval_stack_base, ir->dst, value);
@@ -3360,6 +3703,7 @@ method_start:
                 const metadata::RtFieldInfo* field = get_resolved_data<metadata::RtFieldInfo>(imi, ir->field_idx);
                 metadata::RtClass* klass = field->parent;
                 TRY_RUN_CLASS_STATIC_CCTOR(klass);
+                QUICKEN_IF_CCTOR_FINISHED(klass);
                 const void* field_addr = get_static_field_address<void>(field);
                 set_stack_value_at(eval_stack_base, ir->dst, field_addr);
             }
@@ -3394,6 +3738,7 @@ method_start:
                 const metadata::RtFieldInfo* field = get_resolved_data<metadata::RtFieldInfo>(imi, ir->field_idx);
                 metadata::RtClass* klass = field->parent;
                 TRY_RUN_CLASS_STATIC_CCTOR(klass);
+                QUICKEN_IF_CCTOR_FINISHED(klass);
                 int32_t* field_addr = get_static_field_address<int32_t>(field);
                 *field_addr = value;
             }
@@ -3404,6 +3749,7 @@ method_start:
                 const metadata::RtFieldInfo* field = get_resolved_data<metadata::RtFieldInfo>(imi, ir->field_idx);
                 metadata::RtClass* klass = field->parent;
                 TRY_RUN_CLASS_STATIC_CCTOR(klass);
+                QUICKEN_IF_CCTOR_FINISHED(klass);
                 int64_t* field_addr = get_static_field_address<int64_t>(field);
                 *field_addr = value;
             }
@@ -3448,11 +3794,16 @@ method_start:
             LEANCLR_CASE_END_LITE0()
             LEANCLR_CASE_BEGIN_LITE0(CallInterpShort)
             {
-                const auto* ir = reinterpret_cast<const ll::CallInterp*>(ip);
+                const auto* ir = reinterpret_cast<const ll::CallInterpShort*>(ip + THREADED_CODE_HEADER_SIZE);
                 const metadata::RtMethodInfo* target_method = get_resolved_data<metadata::RtMethodInfo>(imi, ir->method_idx);
                 if (vm::Method::is_static(target_method))
                 {
                     TRY_RUN_CLASS_STATIC_CCTOR(target_method->parent);
+                    QUICKEN_IF_CCTOR_FINISHED(target_method->parent);
+                }
+                else
+                {
+                    quicken_to_no_cctor_opcode(ip);
                 }
                 const uint8_t* next_ip = reinterpret_cast<const uint8_t*>(ir + 1);
                 ENTER_INTERP_FRAME(target_method, ir->frame_base, next_ip);
@@ -3460,15 +3811,14 @@ method_start:
             LEANCLR_CASE_END_LITE0()
             LEANCLR_CASE_BEGIN_LITE0(CallVirtInterpShort)
             {
-                const auto* ir = reinterpret_cast<const ll::CallVirtInterp*>(ip);
+                const auto* ir = reinterpret_cast<const ll::CallVirtInterpShort*>(ip + THREADED_CODE_HEADER_SIZE);
                 vm::RtObject* obj = get_stack_value_at<vm::RtObject*>(eval_stack_base, ir->frame_base);
                 if (!obj)
                 {
                     RAISE_RUNTIME_ERROR(RtErr::NullReference);
                 }
-                const metadata::RtMethodInfo* original_method = get_resolved_data<metadata::RtMethodInfo>(imi, ir->method_idx);
-                DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(const metadata::RtMethodInfo*, actual_method,
-                                                        vm::Method::get_virtual_method_impl(obj, original_method));
+                RtVirtualCallCache* cache = get_resolved_data<RtVirtualCallCache>(imi, ir->method_idx);
+                DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(const metadata::RtMethodInfo*, actual_method, get_virtual_method_impl_cached(cache, obj->klass));
                 if (vm::Class::is_value_type(actual_method->parent))
                 {
                     set_stack_value_at(eval_stack_base, ir->frame_base, obj + 1);
@@ -3487,7 +3837,7 @@ method_start:
             LEANCLR_CASE_END_LITE0()
             LEANCLR_CASE_BEGIN_LITE0(CallInternalCallShort)
             {
-                const auto* ir = reinterpret_cast<const ll::CallInternalCall*>(ip);
+                const auto* ir = reinterpret_cast<const ll::CallInternalCallShort*>(ip + THREADED_CODE_HEADER_SIZE);
                 const metadata::RtMethodInfo* target_method = get_resolved_data<metadata::RtMethodInfo>(imi, ir->method_idx);
                 if (vm::Method::is_static(target_method))
                 {
@@ -3500,7 +3850,7 @@ method_start:
             LEANCLR_CASE_END_LITE0()
             LEANCLR_CASE_BEGIN_LITE0(CallIntrinsicShort)
             {
-                const auto* ir = reinterpret_cast<const ll::CallIntrinsic*>(ip);
+                const auto* ir = reinterpret_cast<const ll::CallIntrinsicShort*>(ip + THREADED_CODE_HEADER_SIZE);
                 const metadata::RtMethodInfo* target_method = get_resolved_data<metadata::RtMethodInfo>(imi, ir->method_idx);
                 if (vm::Method::is_static(target_method))
                 {
@@ -3513,7 +3863,7 @@ method_start:
             LEANCLR_CASE_END_LITE0()
             LEANCLR_CASE_BEGIN_LITE0(CallPInvokeShort)
             {
-                const auto* ir = reinterpret_cast<const ll::CallPInvoke*>(ip);
+                const auto* ir = reinterpret_cast<const ll::CallPInvokeShort*>(ip + THREADED_CODE_HEADER_SIZE);
                 const metadata::RtMethodInfo* target_method = get_resolved_data<metadata::RtMethodInfo>(imi, ir->method_idx);
                 if (vm::Method::is_static(target_method))
                 {
@@ -3526,7 +3876,7 @@ method_start:
             LEANCLR_CASE_END_LITE0()
             LEANCLR_CASE_BEGIN_LITE0(CallRuntimeImplementedShort)
             {
-                const auto* ir = reinterpret_cast<const ll::CallRuntimeImplemented*>(ip);
+                const auto* ir = reinterpret_cast<const ll::CallRuntimeImplementedShort*>(ip + THREADED_CODE_HEADER_SIZE);
                 const metadata::RtMethodInfo* target_method = get_resolved_data<metadata::RtMethodInfo>(imi, ir->method_idx);
                 if (vm::Method::is_static(target_method))
                 {
@@ -3539,7 +3889,7 @@ method_start:
             LEANCLR_CASE_END_LITE0()
             LEANCLR_CASE_BEGIN_LITE0(CalliInterpShort)
             {
-                const auto* ir = reinterpret_cast<const ll::CalliInterp*>(ip);
+                const auto* ir = reinterpret_cast<const ll::CalliInterpShort*>(ip + THREADED_CODE_HEADER_SIZE);
                 const metadata::RtMethodSig* method_sig = get_resolved_data<const metadata::RtMethodSig>(imi, ir->method_sig_idx);
                 const uint8_t* next_ip = reinterpret_cast<const uint8_t*>(ir + 1);
                 const metadata::RtMethodInfo* target_method = get_stack_value_at<const metadata::RtMethodInfo*>(eval_stack_base, ir->method_idx);
@@ -3569,7 +3919,7 @@ method_start:
             LEANCLR_CASE_END0()
             LEANCLR_CASE_BEGIN_LITE0(NewObjInterpShort)
             {
-                const auto* ir = reinterpret_cast<const ll::NewObjInterp*>(ip);
+                const auto* ir = reinterpret_cast<const ll::NewObjInterpShort*>(ip + THREADED_CODE_HEADER_SIZE);
                 const metadata::RtMethodInfo* ctor = get_resolved_data<metadata::RtMethodInfo>(imi, ir->method_idx);
                 metadata::RtClass* klass = ctor->parent;
                 TRY_RUN_CLASS_STATIC_CCTOR(klass);
@@ -3582,7 +3932,7 @@ method_start:
             LEANCLR_CASE_END_LITE0()
             LEANCLR_CASE_BEGIN_LITE0(NewValueTypeInterpShort)
             {
-                const auto* ir = reinterpret_cast<const ll::NewValueTypeInterp*>(ip);
+                const auto* ir = reinterpret_cast<const ll::NewValueTypeInterpShort*>(ip + THREADED_CODE_HEADER_SIZE);
                 const metadata::RtMethodInfo* ctor = get_resolved_data<metadata::RtMethodInfo>(imi, ir->method_idx);
                 metadata::RtClass* klass = ctor->parent;
                 RtStackObject* original_frame_base = eval_stack_base + ir->frame_base;
@@ -3596,7 +3946,7 @@ method_start:
             LEANCLR_CASE_END_LITE0()
             LEANCLR_CASE_BEGIN_LITE0(NewObjInternalCallShort)
             {
-                const auto* ir = reinterpret_cast<const ll::NewObjInternalCall*>(ip);
+                const auto* ir = reinterpret_cast<const ll::NewObjInternalCallShort*>(ip + THREADED_CODE_HEADER_SIZE);
                 const metadata::RtMethodInfo* target_method = get_resolved_data<metadata::RtMethodInfo>(imi, ir->method_idx);
                 TRY_RUN_CLASS_STATIC_CCTOR(target_method->parent);
                 ip = reinterpret_cast<const uint8_t*>(ir + 1);
@@ -3607,7 +3957,7 @@ method_start:
             LEANCLR_CASE_END_LITE0()
             LEANCLR_CASE_BEGIN0(NewObjIntrinsicShort)
             {
-                const auto* ir = reinterpret_cast<const ll::NewObjIntrinsic*>(ip);
+                const auto* ir = reinterpret_cast<const ll::NewObjIntrinsicShort*>(ip + THREADED_CODE_HEADER_SIZE);
                 const metadata::RtMethodInfo* target_method = get_resolved_data<metadata::RtMethodInfo>(imi, ir->method_idx);
                 TRY_RUN_CLASS_STATIC_CCTOR(target_method->parent);
                 ip = reinterpret_cast<const uint8_t*>(ir + 1);
@@ -3642,7 +3992,7 @@ method_start:
             LEANCLR_CASE_END0()
             LEANCLR_CASE_BEGIN_LITE0(LeaveTryWithFinallyShort)
             {
-                const auto* ir = reinterpret_cast<const ll::LeaveTryWithFinally*>(ip);
+                const auto* ir = reinterpret_cast<const ll::LeaveTryWithFinallyShort*>(ip + THREADED_CODE_HEADER_SIZE);
                 assert(ir->finally_clauses_count > 0);
                 assert(ir->first_finally_clause_index < imi->exception_clause_count);
                 const uint8_t* target_ip = ip + ir->target_offset;
@@ -3653,7 +4003,7 @@ method_start:
             LEANCLR_CASE_END_LITE0()
             LEANCLR_CASE_BEGIN_LITE0(LeaveCatchWithFinallyShort)
             {
-                const auto* ir = reinterpret_cast<const ll::LeaveCatchWithFinally*>(ip);
+                const auto* ir = reinterpret_cast<const ll::LeaveCatchWithFinallyShort*>(ip + THREADED_CODE_HEADER_SIZE);
                 assert(ir->finally_clauses_count > 0);
                 assert(ir->first_finally_clause_index < imi->exception_clause_count);
                 vm::RtException* ex = get_exception_in_last_throw_flow(frame, static_cast<uint32_t>(ip - imi->codes));
@@ -3666,7 +4016,7 @@ method_start:
             LEANCLR_CASE_END_LITE0()
             LEANCLR_CASE_BEGIN_LITE0(LeaveCatchWithoutFinallyShort)
             {
-                const auto* ir = reinterpret_cast<const ll::LeaveCatchWithoutFinally*>(ip);
+                const auto* ir = reinterpret_cast<const ll::LeaveCatchWithoutFinallyShort*>(ip + THREADED_CODE_HEADER_SIZE);
                 vm::RtException* ex = get_exception_in_last_throw_flow(frame, static_cast<uint32_t>(ip - imi->codes));
                 pop_throw_flow(ex, frame);
                 ip += ir->target_offset;
@@ -3674,7 +4024,7 @@ method_start:
             LEANCLR_CASE_END_LITE0()
             LEANCLR_CASE_BEGIN_LITE0(EndFilterShort)
             {
-                const auto* ir = reinterpret_cast<const ll::EndFilter*>(ip);
+                const auto* ir = reinterpret_cast<const ll::EndFilterShort*>(ip + THREADED_CODE_HEADER_SIZE);
                 int32_t cond = get_stack_value_at<int32_t>(eval_stack_base, ir->cond);
                 if (cond)
                 {
@@ -3699,15 +4049,147 @@ method_start:
                 goto unwind_exception_handler;
             }
             LEANCLR_CASE_END_LITE0()
+            LEANCLR_CASE_BEGIN0(CheckNullShort)
+            {
+                vm::RtObject* obj = get_stack_value_at<vm::RtObject*>(eval_stack_base, ir->obj);
+                if (!obj)
+                {
+                    RAISE_RUNTIME_ERROR(RtErr::NullReference);
+                }
+            }
+            LEANCLR_CASE_END0()
+            LEANCLR_CASE_BEGIN0(LdsfldU1NoCctorShort)
+            {
+                const metadata::RtFieldInfo* field = get_resolved_data<metadata::RtFieldInfo>(imi, ir->field_idx);
+                const uint8_t* field_addr = get_static_field_address<uint8_t>(field);
+                uint8_t value = *field_addr;
+                set_stack_value_at<int32_t>(eval_stack_base, ir->dst, static_cast<int32_t>(value));
+            }
+            LEANCLR_CASE_END0()
+            LEANCLR_CASE_BEGIN0(LdsfldI4NoCctorShort)
+            {
+                const metadata::RtFieldInfo* field = get_resolved_data<metadata::RtFieldInfo>(imi, ir->field_idx);
+                const int32_t* field_addr = get_static_field_address<int32_t>(field);
+                int32_t value = *field_addr;
+                set_stack_value_at<int32_t>(eval_stack_base, ir->dst, value);
+            }
+            LEANCLR_CASE_END0()
+            LEANCLR_CASE_BEGIN0(LdsfldI8NoCctorShort)
+            {
+                const metadata::RtFieldInfo* field = get_resolved_data<metadata::RtFieldInfo>(imi, ir->field_idx);
+                const int64_t* field_addr = get_static_field_address<int64_t>(field);
+                int64_t value = *field_addr;
+                set_stack_value_at<int64_t>(eval_stack_base, ir->dst, value);
+            }
+            LEANCLR_CASE_END0()
+            LEANCLR_CASE_BEGIN0(LdsfldaNoCctorShort)
+            {
+                const metadata::RtFieldInfo* field = get_resolved_data<metadata::RtFieldInfo>(imi, ir->field_idx);
+                const void* field_addr = get_static_field_address<void>(field);
+                set_stack_value_at(eval_stack_base, ir->dst, field_addr);
+            }
+            LEANCLR_CASE_END0()
+            LEANCLR_CASE_BEGIN0(StsfldI4NoCctorShort)
+            {
+                int32_t value = get_stack_value_at<int32_t>(eval_stack_base, ir->value);
+                const metadata::RtFieldInfo* field = get_resolved_data<metadata::RtFieldInfo>(imi, ir->field_idx);
+                int32_t* field_addr = get_static_field_address<int32_t>(field);
+                *field_addr = value;
+            }
+            LEANCLR_CASE_END0()
+            LEANCLR_CASE_BEGIN0(StsfldI8NoCctorShort)
+            {
+                int64_t value = get_stack_value_at<int64_t>(eval_stack_base, ir->value);
+                const metadata::RtFieldInfo* field = get_resolved_data<metadata::RtFieldInfo>(imi, ir->field_idx);
+                int64_t* field_addr = get_static_field_address<int64_t>(field);
+                *field_addr = value;
+            }
+            LEANCLR_CASE_END0()
+            LEANCLR_CASE_BEGIN_LITE0(CallInterpNoCctorShort)
+            {
+                const auto* ir = reinterpret_cast<const ll::CallInterpNoCctorShort*>(ip + THREADED_CODE_HEADER_SIZE);
+                const metadata::RtMethodInfo* target_method = get_resolved_data<metadata::RtMethodInfo>(imi, ir->method_idx);
+                const uint8_t* next_ip = reinterpret_cast<const uint8_t*>(ir + 1);
+                ENTER_INTERP_FRAME(target_method, ir->frame_base, next_ip);
+            }
+            LEANCLR_CASE_END_LITE0()
+            LEANCLR_CASE_BEGIN0(LdelemI4UncheckedShort)
+            {
+                vm::RtArray* array = get_stack_value_at<vm::RtArray*>(eval_stack_base, ir->arr);
+                assert(vm::Array::get_array_element_size(array) == 4);
+                int32_t index = get_stack_value_at<int32_t>(eval_stack_base, ir->index);
+                int32_t value = vm::Array::get_array_data_at<int32_t>(array, index);
+                set_stack_value_at<int32_t>(eval_stack_base, ir->dst, value);
+            }
+            LEANCLR_CASE_END0()
+            LEANCLR_CASE_BEGIN0(LdelemR4UncheckedShort)
+            {
+                vm::RtArray* array = get_stack_value_at<vm::RtArray*>(eval_stack_base, ir->arr);
+                assert(vm::Array::get_array_element_size(array) == 4);
+                int32_t index = get_stack_value_at<int32_t>(eval_stack_base, ir->index);
+                float value = vm::Array::get_array_data_at<float>(array, index);
+                set_stack_value_at<float>(eval_stack_base, ir->dst, value);
+            }
+            LEANCLR_CASE_END0()
+            LEANCLR_CASE_BEGIN0(LdelemR8UncheckedShort)
+            {
+                vm::RtArray* array = get_stack_value_at<vm::RtArray*>(eval_stack_base, ir->arr);
+                assert(vm::Array::get_array_element_size(array) == 8);
+                int32_t index = get_stack_value_at<int32_t>(eval_stack_base, ir->index);
+                double value = vm::Array::get_array_data_at<double>(array, index);
+                set_stack_value_at<double>(eval_stack_base, ir->dst, value);
+            }
+            LEANCLR_CASE_END0()
+            LEANCLR_CASE_BEGIN0(StelemI4UncheckedShort)
+            {
+                vm::RtArray* array = get_stack_value_at<vm::RtArray*>(eval_stack_base, ir->arr);
+                assert(vm::Array::get_array_element_size(array) == 4);
+                int32_t index = get_stack_value_at<int32_t>(eval_stack_base, ir->index);
+                int32_t value = get_stack_value_at<int32_t>(eval_stack_base, ir->value);
+                vm::Array::set_array_data_at<int32_t>(array, index, value);
+            }
+            LEANCLR_CASE_END0()
+            LEANCLR_CASE_BEGIN0(StelemR4UncheckedShort)
+            {
+                vm::RtArray* array = get_stack_value_at<vm::RtArray*>(eval_stack_base, ir->arr);
+                assert(vm::Array::get_array_element_size(array) == 4);
+                int32_t index = get_stack_value_at<int32_t>(eval_stack_base, ir->index);
+                float value = get_stack_value_at<float>(eval_stack_base, ir->value);
+                vm::Array::set_array_data_at<float>(array, index, value);
+            }
+            LEANCLR_CASE_END0()
+            LEANCLR_CASE_BEGIN0(StelemR8UncheckedShort)
+            {
+                vm::RtArray* array = get_stack_value_at<vm::RtArray*>(eval_stack_base, ir->arr);
+                assert(vm::Array::get_array_element_size(array) == 8);
+                int32_t index = get_stack_value_at<int32_t>(eval_stack_base, ir->index);
+                double value = get_stack_value_at<double>(eval_stack_base, ir->value);
+                vm::Array::set_array_data_at<double>(array, index, value);
+            }
+            LEANCLR_CASE_END0()
+            LEANCLR_CASE_BEGIN0(StfldRefShort)
+            {
+                vm::RtObject* obj = get_stack_value_at<vm::RtObject*>(eval_stack_base, ir->obj);
+                if (!obj)
+                {
+                    RAISE_RUNTIME_ERROR(RtErr::NullReference);
+                }
+                vm::RtObject* value = get_stack_value_at<vm::RtObject*>(eval_stack_base, ir->value);
+                vm::RtObject** field_addr = reinterpret_cast<vm::RtObject**>(reinterpret_cast<uint8_t*>(obj) + ir->offset);
+                gc::GarbageCollector::write_barrier(field_addr, value);
+            }
+            LEANCLR_CASE_END0()
 
             ///}}SHORT_INSTRUCTION_CASES
-            LEANCLR_CASE_BEGIN_LITE0(__UnusedF9)
+            ///{{SUPER_INSTRUCTION_CASES0
+            ///}}SUPER_INSTRUCTION_CASES0
+            LEANCLR_CASE_BEGIN_DISPATCH0(__UnusedFA)
             {
                 assert(false && "Unused opcode");
                 RAISE_RUNTIME_ERROR(RtErr::ExecutionEngine);
             }
             LEANCLR_CASE_END_LITE0()
-            LEANCLR_CASE_BEGIN_LITE0(Prefix1)
+            LEANCLR_CASE_BEGIN_DISPATCH0(Prefix1)
             {
                 LEANCLR_SWITCH1()
                 {
@@ -3856,13 +4338,13 @@ method_start:
                     LEANCLR_CASE_END1()
                     LEANCLR_CASE_BEGIN_LITE1(Br)
                     {
-                        const auto* ir = (ll::Br*)ip;
+                        const auto* ir = (ll::Br*)(ip + THREADED_CODE_HEADER_SIZE);
                         ip = reinterpret_cast<const uint8_t*>(ip + ir->target_offset);
                     }
                     LEANCLR_CASE_END_LITE1()
                     LEANCLR_CASE_BEGIN_LITE1(BrTrueI4)
                     {
-                        const auto* ir = (ll::BrTrueI4*)ip;
+                        const auto* ir = (ll::BrTrueI4*)(ip + THREADED_CODE_HEADER_SIZE);
                         RtStackObject* cond = eval_stack_base + ir->condition;
                         if (cond->i32 != 0)
                         {
@@ -3876,7 +4358,7 @@ method_start:
                     LEANCLR_CASE_END_LITE1()
                     LEANCLR_CASE_BEGIN_LITE1(BrTrueI8)
                     {
-                        const auto* ir = (ll::BrTrueI8*)ip;
+                        const auto* ir = (ll::BrTrueI8*)(ip + THREADED_CODE_HEADER_SIZE);
                         RtStackObject* cond = eval_stack_base + ir->condition;
                         if (cond->i64 != 0)
                         {
@@ -3890,7 +4372,7 @@ method_start:
                     LEANCLR_CASE_END_LITE1()
                     LEANCLR_CASE_BEGIN_LITE1(BrFalseI4)
                     {
-                        const auto* ir = (ll::BrFalseI4*)ip;
+                        const auto* ir = (ll::BrFalseI4*)(ip + THREADED_CODE_HEADER_SIZE);
                         RtStackObject* cond = eval_stack_base + ir->condition;
                         if (cond->i32 == 0)
                         {
@@ -3904,7 +4386,7 @@ method_start:
                     LEANCLR_CASE_END_LITE1()
                     LEANCLR_CASE_BEGIN_LITE1(BrFalseI8)
                     {
-                        const auto* ir = (ll::BrFalseI8*)ip;
+                        const auto* ir = (ll::BrFalseI8*)(ip + THREADED_CODE_HEADER_SIZE);
                         RtStackObject* cond = eval_stack_base + ir->condition;
                         if (cond->i64 == 0)
                         {
@@ -3918,7 +4400,7 @@ method_start:
                     LEANCLR_CASE_END_LITE1()
                     LEANCLR_CASE_BEGIN_LITE1(BeqI4)
                     {
-                        const auto* ir = (ll::BeqI4*)ip;
+                        const auto* ir = (ll::BeqI4*)(ip + THREADED_CODE_HEADER_SIZE);
                         RtStackObject* op1 = eval_stack_base + ir->arg1;
                         RtStackObject* op2 = eval_stack_base + ir->arg2;
                         if (op1->i32 == op2->i32)
@@ -3933,7 +4415,7 @@ method_start:
                     LEANCLR_CASE_END_LITE1()
                     LEANCLR_CASE_BEGIN_LITE1(BeqI8)
                     {
-                        const auto* ir = (ll::BeqI8*)ip;
+                        const auto* ir = (ll::BeqI8*)(ip + THREADED_CODE_HEADER_SIZE);
                         RtStackObject* op1 = eval_stack_base + ir->arg1;
                         RtStackObject* op2 = eval_stack_base + ir->arg2;
                         if (op1->i64 == op2->i64)
@@ -3948,7 +4430,7 @@ method_start:
                     LEANCLR_CASE_END_LITE1()
                     LEANCLR_CASE_BEGIN_LITE1(BeqR4)
                     {
-                        const auto* ir = (ll::BeqR4*)ip;
+                        const auto* ir = (ll::BeqR4*)(ip + THREADED_CODE_HEADER_SIZE);
                         RtStackObject* op1 = eval_stack_base + ir->arg1;
                         RtStackObject* op2 = eval_stack_base + ir->arg2;
                         float left = op1->f32;
@@ -3965,7 +4447,7 @@ method_start:
                     LEANCLR_CASE_END_LITE1()
                     LEANCLR_CASE_BEGIN_LITE1(BeqR8)
                     {
-                        const auto* ir = (ll::BeqR8*)ip;
+                        const auto* ir = (ll::BeqR8*)(ip + THREADED_CODE_HEADER_SIZE);
                         RtStackObject* op1 = eval_stack_base + ir->arg1;
                         RtStackObject* op2 = eval_stack_base + ir->arg2;
                         double left = op1->f64;
@@ -3982,7 +4464,7 @@ method_start:
                     LEANCLR_CASE_END_LITE1()
                     LEANCLR_CASE_BEGIN_LITE1(BgeI4)
                     {
-                        const auto* ir = (ll::BgeI4*)ip;
+                        const auto* ir = (ll::BgeI4*)(ip + THREADED_CODE_HEADER_SIZE);
                         RtStackObject* op1 = eval_stack_base + ir->arg1;
                         RtStackObject* op2 = eval_stack_base + ir->arg2;
                         if (op1->i32 >= op2->i32)
@@ -3997,7 +4479,7 @@ method_start:
                     LEANCLR_CASE_END_LITE1()
                     LEANCLR_CASE_BEGIN_LITE1(BgeI8)
                     {
-                        const auto* ir = (ll::BgeI8*)ip;
+                        const auto* ir = (ll::BgeI8*)(ip + THREADED_CODE_HEADER_SIZE);
                         RtStackObject* op1 = eval_stack_base + ir->arg1;
                         RtStackObject* op2 = eval_stack_base + ir->arg2;
                         if (op1->i64 >= op2->i64)
@@ -4012,7 +4494,7 @@ method_start:
                     LEANCLR_CASE_END_LITE1()
                     LEANCLR_CASE_BEGIN_LITE1(BgeR4)
                     {
-                        const auto* ir = (ll::BgeR4*)ip;
+                        const auto* ir = (ll::BgeR4*)(ip + THREADED_CODE_HEADER_SIZE);
                         RtStackObject* op1 = eval_stack_base + ir->arg1;
                         RtStackObject* op2 = eval_stack_base + ir->arg2;
                         float left = op1->f32;
@@ -4029,7 +4511,7 @@ method_start:
                     LEANCLR_CASE_END_LITE1()
                     LEANCLR_CASE_BEGIN_LITE1(BgeR8)
                     {
-                        const auto* ir = (ll::BgeR8*)ip;
+                        const auto* ir = (ll::BgeR8*)(ip + THREADED_CODE_HEADER_SIZE);
                         RtStackObject* op1 = eval_stack_base + ir->arg1;
                         RtStackObject* op2 = eval_stack_base + ir->arg2;
                         double left = op1->f64;
@@ -4046,7 +4528,7 @@ method_start:
                     LEANCLR_CASE_END_LITE1()
                     LEANCLR_CASE_BEGIN_LITE1(BgtI4)
                     {
-                        const auto* ir = (ll::BgtI4*)ip;
+                        const auto* ir = (ll::BgtI4*)(ip + THREADED_CODE_HEADER_SIZE);
                         RtStackObject* op1 = eval_stack_base + ir->arg1;
                         RtStackObject* op2 = eval_stack_base + ir->arg2;
                         if (op1->i32 > op2->i32)
@@ -4061,7 +4543,7 @@ method_start:
                     LEANCLR_CASE_END_LITE1()
                     LEANCLR_CASE_BEGIN_LITE1(BgtI8)
                     {
-                        const auto* ir = (ll::BgtI8*)ip;
+                        const auto* ir = (ll::BgtI8*)(ip + THREADED_CODE_HEADER_SIZE);
                         RtStackObject* op1 = eval_stack_base + ir->arg1;
                         RtStackObject* op2 = eval_stack_base + ir->arg2;
                         if (op1->i64 > op2->i64)
@@ -4076,7 +4558,7 @@ method_start:
                     LEANCLR_CASE_END_LITE1()
                     LEANCLR_CASE_BEGIN_LITE1(BgtR4)
                     {
-                        const auto* ir = (ll::BgtR4*)ip;
+                        const auto* ir = (ll::BgtR4*)(ip + THREADED_CODE_HEADER_SIZE);
                         RtStackObject* op1 = eval_stack_base + ir->arg1;
                         RtStackObject* op2 = eval_stack_base + ir->arg2;
                         float left = op1->f32;
@@ -4093,7 +4575,7 @@ method_start:
                     LEANCLR_CASE_END_LITE1()
                     LEANCLR_CASE_BEGIN_LITE1(BgtR8)
                     {
-                        const auto* ir = (ll::BgtR8*)ip;
+                        const auto* ir = (ll::BgtR8*)(ip + THREADED_CODE_HEADER_SIZE);
                         RtStackObject* op1 = eval_stack_base + ir->arg1;
                         RtStackObject* op2 = eval_stack_base + ir->arg2;
                         double left = op1->f64;
@@ -4110,7 +4592,7 @@ method_start:
                     LEANCLR_CASE_END_LITE1()
                     LEANCLR_CASE_BEGIN_LITE1(BleI4)
                     {
-                        const auto* ir = (ll::BleI4*)ip;
+                        const auto* ir = (ll::BleI4*)(ip + THREADED_CODE_HEADER_SIZE);
                         RtStackObject* op1 = eval_stack_base + ir->arg1;
                         RtStackObject* op2 = eval_stack_base + ir->arg2;
                         if (op1->i32 <= op2->i32)
@@ -4125,7 +4607,7 @@ method_start:
                     LEANCLR_CASE_END_LITE1()
                     LEANCLR_CASE_BEGIN_LITE1(BleI8)
                     {
-                        const auto* ir = (ll::BleI8*)ip;
+                        const auto* ir = (ll::BleI8*)(ip + THREADED_CODE_HEADER_SIZE);
                         RtStackObject* op1 = eval_stack_base + ir->arg1;
                         RtStackObject* op2 = eval_stack_base + ir->arg2;
                         if (op1->i64 <= op2->i64)
@@ -4140,7 +4622,7 @@ method_start:
                     LEANCLR_CASE_END_LITE1()
                     LEANCLR_CASE_BEGIN_LITE1(BleR4)
                     {
-                        const auto* ir = (ll::BleR4*)ip;
+                        const auto* ir = (ll::BleR4*)(ip + THREADED_CODE_HEADER_SIZE);
                         RtStackObject* op1 = eval_stack_base + ir->arg1;
                         RtStackObject* op2 = eval_stack_base + ir->arg2;
                         float left = op1->f32;
@@ -4157,7 +4639,7 @@ method_start:
                     LEANCLR_CASE_END_LITE1()
                     LEANCLR_CASE_BEGIN_LITE1(BleR8)
                     {
-                        const auto* ir = (ll::BleR8*)ip;
+                        const auto* ir = (ll::BleR8*)(ip + THREADED_CODE_HEADER_SIZE);
                         RtStackObject* op1 = eval_stack_base + ir->arg1;
                         RtStackObject* op2 = eval_stack_base + ir->arg2;
                         double left = op1->f64;
@@ -4174,7 +4656,7 @@ method_start:
                     LEANCLR_CASE_END_LITE1()
                     LEANCLR_CASE_BEGIN_LITE1(BltI4)
                     {
-                        const auto* ir = (ll::BltI4*)ip;
+                        const auto* ir = (ll::BltI4*)(ip + THREADED_CODE_HEADER_SIZE);
                         RtStackObject* op1 = eval_stack_base + ir->arg1;
                         RtStackObject* op2 = eval_stack_base + ir->arg2;
                         if (op1->i32 < op2->i32)
@@ -4189,7 +4671,7 @@ method_start:
                     LEANCLR_CASE_END_LITE1()
                     LEANCLR_CASE_BEGIN_LITE1(BltI8)
                     {
-                        const auto* ir = (ll::BltI8*)ip;
+                        const auto* ir = (ll::BltI8*)(ip + THREADED_CODE_HEADER_SIZE);
                         RtStackObject* op1 = eval_stack_base + ir->arg1;
                         RtStackObject* op2 = eval_stack_base + ir->arg2;
                         if (op1->i64 < op2->i64)
@@ -4204,7 +4686,7 @@ method_start:
                     LEANCLR_CASE_END_LITE1()
                     LEANCLR_CASE_BEGIN_LITE1(BltR4)
                     {
-                        const auto* ir = (ll::BltR4*)ip;
+                        const auto* ir = (ll::BltR4*)(ip + THREADED_CODE_HEADER_SIZE);
                         RtStackObject* op1 = eval_stack_base + ir->arg1;
                         RtStackObject* op2 = eval_stack_base + ir->arg2;
                         float left = op1->f32;
@@ -4221,7 +4703,7 @@ method_start:
                     LEANCLR_CASE_END_LITE1()
                     LEANCLR_CASE_BEGIN_LITE1(BltR8)
                     {
-                        const auto* ir = (ll::BltR8*)ip;
+                        const auto* ir = (ll::BltR8*)(ip + THREADED_CODE_HEADER_SIZE);
                         RtStackObject* op1 = eval_stack_base + ir->arg1;
                         RtStackObject* op2 = eval_stack_base + ir->arg2;
                         double left = op1->f64;
@@ -4238,7 +4720,7 @@ method_start:
                     LEANCLR_CASE_END_LITE1()
                     LEANCLR_CASE_BEGIN_LITE1(BneUnI4)
                     {
-                        const auto* ir = (ll::BneUnI4*)ip;
+                        const auto* ir = (ll::BneUnI4*)(ip + THREADED_CODE_HEADER_SIZE);
                         RtStackObject* op1 = eval_stack_base + ir->arg1;
                         RtStackObject* op2 = eval_stack_base + ir->arg2;
                         if (op1->u32 != op2->u32)
@@ -4253,7 +4735,7 @@ method_start:
                     LEANCLR_CASE_END_LITE1()
                     LEANCLR_CASE_BEGIN_LITE1(BneUnI8)
                     {
-                        const auto* ir = (ll::BneUnI8*)ip;
+                        const auto* ir = (ll::BneUnI8*)(ip + THREADED_CODE_HEADER_SIZE);
                         RtStackObject* op1 = eval_stack_base + ir->arg1;
                         RtStackObject* op2 = eval_stack_base + ir->arg2;
                         if (op1->u64 != op2->u64)
@@ -4268,7 +4750,7 @@ method_start:
                     LEANCLR_CASE_END_LITE1()
                     LEANCLR_CASE_BEGIN_LITE1(BneUnR4)
                     {
-                        const auto* ir = (ll::BneUnR4*)ip;
+                        const auto* ir = (ll::BneUnR4*)(ip + THREADED_CODE_HEADER_SIZE);
                         RtStackObject* op1 = eval_stack_base + ir->arg1;
                         RtStackObject* op2 = eval_stack_base + ir->arg2;
                         float left = op1->f32;
@@ -4285,7 +4767,7 @@ method_start:
                     LEANCLR_CASE_END_LITE1()
                     LEANCLR_CASE_BEGIN_LITE1(BneUnR8)
                     {
-                        const auto* ir = (ll::BneUnR8*)ip;
+                        const auto* ir = (ll::BneUnR8*)(ip + THREADED_CODE_HEADER_SIZE);
                         RtStackObject* op1 = eval_stack_base + ir->arg1;
                         RtStackObject* op2 = eval_stack_base + ir->arg2;
                         double left = op1->f64;
@@ -4302,7 +4784,7 @@ method_start:
                     LEANCLR_CASE_END_LITE1()
                     LEANCLR_CASE_BEGIN_LITE1(BgeUnI4)
                     {
-                        const auto* ir = (ll::BgeUnI4*)ip;
+                        const auto* ir = (ll::BgeUnI4*)(ip + THREADED_CODE_HEADER_SIZE);
                         RtStackObject* op1 = eval_stack_base + ir->arg1;
                         RtStackObject* op2 = eval_stack_base + ir->arg2;
                         if (op1->u32 >= op2->u32)
@@ -4317,7 +4799,7 @@ method_start:
                     LEANCLR_CASE_END_LITE1()
                     LEANCLR_CASE_BEGIN_LITE1(BgeUnI8)
                     {
-                        const auto* ir = (ll::BgeUnI8*)ip;
+                        const auto* ir = (ll::BgeUnI8*)(ip + THREADED_CODE_HEADER_SIZE);
                         RtStackObject* op1 = eval_stack_base + ir->arg1;
                         RtStackObject* op2 = eval_stack_base + ir->arg2;
                         if (op1->u64 >= op2->u64)
@@ -4332,7 +4814,7 @@ method_start:
                     LEANCLR_CASE_END_LITE1()
                     LEANCLR_CASE_BEGIN_LITE1(BgeUnR4)
                     {
-                        const auto* ir = (ll::BgeUnR4*)ip;
+                        const auto* ir = (ll::BgeUnR4*)(ip + THREADED_CODE_HEADER_SIZE);
                         RtStackObject* op1 = eval_stack_base + ir->arg1;
                         RtStackObject* op2 = eval_stack_base + ir->arg2;
                         float left = op1->f32;
@@ -4349,7 +4831,7 @@ method_start:
                     LEANCLR_CASE_END_LITE1()
                     LEANCLR_CASE_BEGIN_LITE1(BgeUnR8)
                     {
-                        const auto* ir = (ll::BgeUnR8*)ip;
+                        const auto* ir = (ll::BgeUnR8*)(ip + THREADED_CODE_HEADER_SIZE);
                         RtStackObject* op1 = eval_stack_base + ir->arg1;
                         RtStackObject* op2 = eval_stack_base + ir->arg2;
                         double left = op1->f64;
@@ -4366,7 +4848,7 @@ method_start:
                     LEANCLR_CASE_END_LITE1()
                     LEANCLR_CASE_BEGIN_LITE1(BgtUnI4)
                     {
-                        const auto* ir = (ll::BgtUnI4*)ip;
+                        const auto* ir = (ll::BgtUnI4*)(ip + THREADED_CODE_HEADER_SIZE);
                         RtStackObject* op1 = eval_stack_base + ir->arg1;
                         RtStackObject* op2 = eval_stack_base + ir->arg2;
                         if (op1->u32 > op2->u32)
@@ -4381,7 +4863,7 @@ method_start:
                     LEANCLR_CASE_END_LITE1()
                     LEANCLR_CASE_BEGIN_LITE1(BgtUnI8)
                     {
-                        const auto* ir = (ll::BgtUnI8*)ip;
+                        const auto* ir = (ll::BgtUnI8*)(ip + THREADED_CODE_HEADER_SIZE);
                         RtStackObject* op1 = eval_stack_base + ir->arg1;
                         RtStackObject* op2 = eval_stack_base + ir->arg2;
                         if (op1->u64 > op2->u64)
@@ -4396,7 +4878,7 @@ method_start:
                     LEANCLR_CASE_END_LITE1()
                     LEANCLR_CASE_BEGIN_LITE1(BgtUnR4)
                     {
-                        const auto* ir = (ll::BgtUnR4*)ip;
+                        const auto* ir = (ll::BgtUnR4*)(ip + THREADED_CODE_HEADER_SIZE);
                         RtStackObject* op1 = eval_stack_base + ir->arg1;
                         RtStackObject* op2 = eval_stack_base + ir->arg2;
                         float left = op1->f32;
@@ -4413,7 +4895,7 @@ method_start:
                     LEANCLR_CASE_END_LITE1()
                     LEANCLR_CASE_BEGIN_LITE1(BgtUnR8)
                     {
-                        const auto* ir = (ll::BgtUnR8*)ip;
+                        const auto* ir = (ll::BgtUnR8*)(ip + THREADED_CODE_HEADER_SIZE);
                         RtStackObject* op1 = eval_stack_base + ir->arg1;
                         RtStackObject* op2 = eval_stack_base + ir->arg2;
                         double left = op1->f64;
@@ -4430,7 +4912,7 @@ method_start:
                     LEANCLR_CASE_END_LITE1()
                     LEANCLR_CASE_BEGIN_LITE1(BleUnI4)
                     {
-                        const auto* ir = (ll::BleUnI4*)ip;
+                        const auto* ir = (ll::BleUnI4*)(ip + THREADED_CODE_HEADER_SIZE);
                         RtStackObject* op1 = eval_stack_base + ir->arg1;
                         RtStackObject* op2 = eval_stack_base + ir->arg2;
                         if (op1->u32 <= op2->u32)
@@ -4445,7 +4927,7 @@ method_start:
                     LEANCLR_CASE_END_LITE1()
                     LEANCLR_CASE_BEGIN_LITE1(BleUnI8)
                     {
-                        const auto* ir = (ll::BleUnI8*)ip;
+                        const auto* ir = (ll::BleUnI8*)(ip + THREADED_CODE_HEADER_SIZE);
                         RtStackObject* op1 = eval_stack_base + ir->arg1;
                         RtStackObject* op2 = eval_stack_base + ir->arg2;
                         if (op1->u64 <= op2->u64)
@@ -4460,7 +4942,7 @@ method_start:
                     LEANCLR_CASE_END_LITE1()
                     LEANCLR_CASE_BEGIN_LITE1(BleUnR4)
                     {
-                        const auto* ir = (ll::BleUnR4*)ip;
+                        const auto* ir = (ll::BleUnR4*)(ip + THREADED_CODE_HEADER_SIZE);
                         RtStackObject* op1 = eval_stack_base + ir->arg1;
                         RtStackObject* op2 = eval_stack_base + ir->arg2;
                         float left = op1->f32;
@@ -4477,7 +4959,7 @@ method_start:
                     LEANCLR_CASE_END_LITE1()
                     LEANCLR_CASE_BEGIN_LITE1(BleUnR8)
                     {
-                        const auto* ir = (ll::BleUnR8*)ip;
+                        const auto* ir = (ll::BleUnR8*)(ip + THREADED_CODE_HEADER_SIZE);
                         RtStackObject* op1 = eval_stack_base + ir->arg1;
                         RtStackObject* op2 = eval_stack_base + ir->arg2;
                         double left = op1->f64;
@@ -4494,7 +4976,7 @@ method_start:
                     LEANCLR_CASE_END_LITE1()
                     LEANCLR_CASE_BEGIN_LITE1(BltUnI4)
                     {
-                        const auto* ir = (ll::BltUnI4*)ip;
+                        const auto* ir = (ll::BltUnI4*)(ip + THREADED_CODE_HEADER_SIZE);
                         RtStackObject* op1 = eval_stack_base + ir->arg1;
                         RtStackObject* op2 = eval_stack_base + ir->arg2;
                         if (op1->u32 < op2->u32)
@@ -4509,7 +4991,7 @@ method_start:
                     LEANCLR_CASE_END_LITE1()
                     LEANCLR_CASE_BEGIN_LITE1(BltUnI8)
                     {
-                        const auto* ir = (ll::BltUnI8*)ip;
+                        const auto* ir = (ll::BltUnI8*)(ip + THREADED_CODE_HEADER_SIZE);
                         RtStackObject* op1 = eval_stack_base + ir->arg1;
                         RtStackObject* op2 = eval_stack_base + ir->arg2;
                         if (op1->u64 < op2->u64)
@@ -4524,7 +5006,7 @@ method_start:
                     LEANCLR_CASE_END_LITE1()
                     LEANCLR_CASE_BEGIN_LITE1(BltUnR4)
                     {
-                        const auto* ir = (ll::BltUnR4*)ip;
+                        const auto* ir = (ll::BltUnR4*)(ip + THREADED_CODE_HEADER_SIZE);
                         RtStackObject* op1 = eval_stack_base + ir->arg1;
                         RtStackObject* op2 = eval_stack_base + ir->arg2;
                         float left = op1->f32;
@@ -4541,7 +5023,7 @@ method_start:
                     LEANCLR_CASE_END_LITE1()
                     LEANCLR_CASE_BEGIN_LITE1(BltUnR8)
                     {
-                        const auto* ir = (ll::BltUnR8*)ip;
+                        const auto* ir = (ll::BltUnR8*)(ip + THREADED_CODE_HEADER_SIZE);
                         RtStackObject* op1 = eval_stack_base + ir->arg1;
                         RtStackObject* op2 = eval_stack_base + ir->arg2;
                         double left = op1->f64;
@@ -4558,7 +5040,7 @@ method_start:
                     LEANCLR_CASE_END_LITE1()
                     LEANCLR_CASE_BEGIN_LITE1(Switch)
                     {
-                        const auto* ir = (ll::Switch*)ip;
+                        const auto* ir = (ll::Switch*)(ip + THREADED_CODE_HEADER_SIZE);
                         RtStackObject* index_obj = eval_stack_base + ir->index;
                         uint32_t idx = index_obj->u32;
                         if (idx < ir->num_targets)
@@ -5322,8 +5804,8 @@ method_start:
                         vm::RtObject* obj = get_stack_value_at<vm::RtObject*>(eval_stack_base, ir->obj);
                         if (obj)
                         {
-                            metadata::RtClass* to_class = get_resolved_data<metadata::RtClass>(imi, ir->klass_idx);
-                            if (!vm::Class::is_assignable_from(obj->klass, to_class))
+                            RtTypeCheckCache* cache = get_resolved_data<RtTypeCheckCache>(imi, ir->klass_idx);
+                            if (!is_instance_of_cached(cache, obj->klass))
                             {
                                 RAISE_RUNTIME_ERROR(RtErr::InvalidCast);
                             }
@@ -5336,8 +5818,8 @@ method_start:
                         vm::RtObject* result;
                         if (obj)
                         {
-                            metadata::RtClass* to_class = get_resolved_data<metadata::RtClass>(imi, ir->klass_idx);
-                            result = vm::Class::is_assignable_from(obj->klass, to_class) ? obj : nullptr;
+                            RtTypeCheckCache* cache = get_resolved_data<RtTypeCheckCache>(imi, ir->klass_idx);
+                            result = is_instance_of_cached(cache, obj->klass) ? obj : nullptr;
                         }
                         else
                         {
@@ -5763,7 +6245,7 @@ method_start:
                             RAISE_RUNTIME_ERROR(RtErr::IndexOutOfRange);
                         }
                         vm::RtObject* value = get_stack_value_at<vm::RtObject*>(eval_stack_base, ir->value);
-                        vm::Array::set_array_data_at<vm::RtObject*>(array, index, value);
+                        gc::GarbageCollector::write_barrier(vm::Array::get_array_element_address<vm::RtObject*>(array, index), value);
                     }
                     LEANCLR_CASE_END1()
                     LEANCLR_CASE_BEGIN1(StelemAnyRef)
@@ -5784,7 +6266,7 @@ method_start:
                         {
                             RAISE_RUNTIME_ERROR(RtErr::ArrayTypeMismatch);
                         }
-                        vm::Array::set_array_data_at<vm::RtObject*>(array, index, value);
+                        gc::GarbageCollector::write_barrier(vm::Array::get_array_element_address<vm::RtObject*>(array, index), value);
                     }
                     LEANCLR_CASE_END1()
                     LEANCLR_CASE_BEGIN1(StelemAnyVal)
@@ -5809,6 +6291,10 @@ method_start:
                         RtStackObject* src = eval_stack_base + ir->value;
                         void* dst_addr = const_cast<void*>(vm::Array::get_array_element_address_with_size_as_ptr_void(array, index, ir->ele_size));
                         std::memcpy(dst_addr, src, ir->ele_size);
+                        if (vm::Class::get_has_references(ele_klass))
+                        {
+                            gc::GarbageCollector::write_barrier_range(dst_addr, ir->ele_size);
+                        }
                     }
                     LEANCLR_CASE_END1()
                     LEANCLR_CASE_BEGIN1(MkRefAny)
@@ -5890,9 +6376,9 @@ method_start:
                         {
                             RAISE_RUNTIME_ERROR(RtErr::NullReference);
                         }
-                        const metadata::RtMethodInfo* method = get_resolved_data<metadata::RtMethodInfo>(imi, ir->method_idx);
-                        assert(method->slot < method->parent->vtable_count);
-                        DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(const metadata::RtMethodInfo*, actual_method, vm::Method::get_virtual_method_impl(obj, method));
+                        RtVirtualCallCache* cache = get_resolved_data<RtVirtualCallCache>(imi, ir->method_idx);
+                        assert(cache->virtual_method->slot < cache->virtual_method->parent->vtable_count);
+                        DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(const metadata::RtMethodInfo*, actual_method, get_virtual_method_impl_cached(cache, obj->klass));
                         set_stack_value_at(eval_stack_base, ir->dst, actual_method);
                     }
                     LEANCLR_CASE_END1()
@@ -6120,6 +6606,7 @@ method_start:
                     {
                         const metadata::RtFieldInfo* field = get_resolved_data<metadata::RtFieldInfo>(imi, ir->field_idx);
                         TRY_RUN_CLASS_STATIC_CCTOR(field->parent);
+                        QUICKEN_IF_CCTOR_FINISHED(field->parent);
                         const uint8_t* field_addr = get_static_field_address<uint8_t>(field);
                         uint8_t value = *field_addr;
                         set_stack_value_at<int32_t>(eval_stack_base, ir->dst, static_cast<int32_t>(value));
@@ -6147,6 +6634,7 @@ method_start:
                     {
                         const metadata::RtFieldInfo* field = get_resolved_data<metadata::RtFieldInfo>(imi, ir->field_idx);
                         TRY_RUN_CLASS_STATIC_CCTOR(field->parent);
+                        QUICKEN_IF_CCTOR_FINISHED(field->parent);
                         const int32_t* field_addr = get_static_field_address<int32_t>(field);
                         int32_t value = *field_addr;
                         set_stack_value_at<int32_t>(eval_stack_base, ir->dst, value);
@@ -6156,6 +6644,7 @@ method_start:
                     {
                         const metadata::RtFieldInfo* field = get_resolved_data<metadata::RtFieldInfo>(imi, ir->field_idx);
                         TRY_RUN_CLASS_STATIC_CCTOR(field->parent);
+                        QUICKEN_IF_CCTOR_FINISHED(field->parent);
                         const int64_t* field_addr = get_static_field_address<int64_t>(field);
                         int64_t value = *field_addr;
                         set_stack_value_at<int64_t>(eval_stack_base, ir->dst, value);
@@ -6175,6 +6664,7 @@ method_start:
                         const metadata::RtFieldInfo* field = get_resolved_data<metadata::RtFieldInfo>(imi, ir->field_idx);
                         metadata::RtClass* klass = field->parent;
                         TRY_RUN_CLASS_STATIC_CCTOR(klass);
+                        QUICKEN_IF_CCTOR_FINISHED(klass);
                         const void* field_addr = get_static_field_address<void>(field);
                         set_stack_value_at(eval_stack_base, ir->dst, field_addr);
                     }
@@ -6209,6 +6699,7 @@ method_start:
                         const metadata::RtFieldInfo* field = get_resolved_data<metadata::RtFieldInfo>(imi, ir->field_idx);
                         metadata::RtClass* klass = field->parent;
                         TRY_RUN_CLASS_STATIC_CCTOR(klass);
+                        QUICKEN_IF_CCTOR_FINISHED(klass);
                         int32_t* field_addr = get_static_field_address<int32_t>(field);
                         *field_addr = value;
                     }
@@ -6219,6 +6710,7 @@ method_start:
                         const metadata::RtFieldInfo* field = get_resolved_data<metadata::RtFieldInfo>(imi, ir->field_idx);
                         metadata::RtClass* klass = field->parent;
                         TRY_RUN_CLASS_STATIC_CCTOR(klass);
+                        QUICKEN_IF_CCTOR_FINISHED(klass);
                         int64_t* field_addr = get_static_field_address<int64_t>(field);
                         *field_addr = value;
                     }
@@ -6258,11 +6750,16 @@ method_start:
                     LEANCLR_CASE_END1()
                     LEANCLR_CASE_BEGIN_LITE1(CallInterp)
                     {
-                        const auto* ir = reinterpret_cast<const ll::CallInterp*>(ip);
+                        const auto* ir = reinterpret_cast<const ll::CallInterp*>(ip + THREADED_CODE_HEADER_SIZE);
                         const metadata::RtMethodInfo* target_method = get_resolved_data<metadata::RtMethodInfo>(imi, ir->method_idx);
                         if (vm::Method::is_static(target_method))
                         {
                             TRY_RUN_CLASS_STATIC_CCTOR(target_method->parent);
+                            QUICKEN_IF_CCTOR_FINISHED(target_method->parent);
+                        }
+                        else
+                        {
+                            quicken_to_no_cctor_opcode(ip);
                         }
                         const uint8_t* next_ip = reinterpret_cast<const uint8_t*>(ir + 1);
                         ENTER_INTERP_FRAME(target_method, ir->frame_base, next_ip);
@@ -6270,15 +6767,14 @@ method_start:
                     LEANCLR_CASE_END_LITE1()
                     LEANCLR_CASE_BEGIN_LITE1(CallVirtInterp)
                     {
-                        const auto* ir = reinterpret_cast<const ll::CallVirtInterp*>(ip);
+                        const auto* ir = reinterpret_cast<const ll::CallVirtInterp*>(ip + THREADED_CODE_HEADER_SIZE);
                         vm::RtObject* obj = get_stack_value_at<vm::RtObject*>(eval_stack_base, ir->frame_base);
                         if (!obj)
                         {
                             RAISE_RUNTIME_ERROR(RtErr::NullReference);
                         }
-                        const metadata::RtMethodInfo* original_method = get_resolved_data<metadata::RtMethodInfo>(imi, ir->method_idx);
-                        DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(const metadata::RtMethodInfo*, actual_method,
-                                                                vm::Method::get_virtual_method_impl(obj, original_method));
+                        RtVirtualCallCache* cache = get_resolved_data<RtVirtualCallCache>(imi, ir->method_idx);
+                        DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(const metadata::RtMethodInfo*, actual_method, get_virtual_method_impl_cached(cache, obj->klass));
                         if (vm::Class::is_value_type(actual_method->parent))
                         {
                             set_stack_value_at(eval_stack_base, ir->frame_base, obj + 1);
@@ -6295,9 +6791,18 @@ method_start:
                         }
                     }
                     LEANCLR_CASE_END_LITE1()
+                    LEANCLR_CASE_BEGIN1(CheckNull)
+                    {
+                        vm::RtObject* obj = get_stack_value_at<vm::RtObject*>(eval_stack_base, ir->obj);
+                        if (!obj)
+                        {
+                            RAISE_RUNTIME_ERROR(RtErr::NullReference);
+                        }
+                    }
+                    LEANCLR_CASE_END1()
                     LEANCLR_CASE_BEGIN_LITE1(CallInternalCall)
                     {
-                        const auto* ir = reinterpret_cast<const ll::CallInternalCall*>(ip);
+                        const auto* ir = reinterpret_cast<const ll::CallInternalCall*>(ip + THREADED_CODE_HEADER_SIZE);
                         const metadata::RtMethodInfo* target_method = get_resolved_data<metadata::RtMethodInfo>(imi, ir->method_idx);
                         if (vm::Method::is_static(target_method))
                         {
@@ -6310,7 +6815,7 @@ method_start:
                     LEANCLR_CASE_END_LITE1()
                     LEANCLR_CASE_BEGIN_LITE1(CallIntrinsic)
                     {
-                        const auto* ir = reinterpret_cast<const ll::CallIntrinsic*>(ip);
+                        const auto* ir = reinterpret_cast<const ll::CallIntrinsic*>(ip + THREADED_CODE_HEADER_SIZE);
                         const metadata::RtMethodInfo* target_method = get_resolved_data<metadata::RtMethodInfo>(imi, ir->method_idx);
                         if (vm::Method::is_static(target_method))
                         {
@@ -6323,7 +6828,7 @@ method_start:
                     LEANCLR_CASE_END_LITE1()
                     LEANCLR_CASE_BEGIN_LITE1(CallPInvoke)
                     {
-                        const auto* ir = reinterpret_cast<const ll::CallPInvoke*>(ip);
+                        const auto* ir = reinterpret_cast<const ll::CallPInvoke*>(ip + THREADED_CODE_HEADER_SIZE);
                         const metadata::RtMethodInfo* target_method = get_resolved_data<metadata::RtMethodInfo>(imi, ir->method_idx);
                         if (vm::Method::is_static(target_method))
                         {
@@ -6336,7 +6841,7 @@ method_start:
                     LEANCLR_CASE_END_LITE1()
                     LEANCLR_CASE_BEGIN_LITE1(CallRuntimeImplemented)
                     {
-                        const auto* ir = reinterpret_cast<const ll::CallRuntimeImplemented*>(ip);
+                        const auto* ir = reinterpret_cast<const ll::CallRuntimeImplemented*>(ip + THREADED_CODE_HEADER_SIZE);
                         const metadata::RtMethodInfo* target_method = get_resolved_data<metadata::RtMethodInfo>(imi, ir->method_idx);
                         if (vm::Method::is_static(target_method))
                         {
@@ -6349,7 +6854,7 @@ method_start:
                     LEANCLR_CASE_END_LITE1()
                     LEANCLR_CASE_BEGIN_LITE1(CalliInterp)
                     {
-                        const auto* ir = reinterpret_cast<const ll::CalliInterp*>(ip);
+                        const auto* ir = reinterpret_cast<const ll::CalliInterp*>(ip + THREADED_CODE_HEADER_SIZE);
                         const metadata::RtMethodSig* method_sig = get_resolved_data<const metadata::RtMethodSig>(imi, ir->method_sig_idx);
                         const uint8_t* next_ip = reinterpret_cast<const uint8_t*>(ir + 1);
                         const metadata::RtMethodInfo* target_method = get_stack_value_at<const metadata::RtMethodInfo*>(eval_stack_base, ir->method_idx);
@@ -6380,7 +6885,7 @@ method_start:
                     LEANCLR_CASE_END1()
                     LEANCLR_CASE_BEGIN_LITE1(NewObjInterp)
                     {
-                        const auto* ir = reinterpret_cast<const ll::NewObjInterp*>(ip);
+                        const auto* ir = reinterpret_cast<const ll::NewObjInterp*>(ip + THREADED_CODE_HEADER_SIZE);
                         const metadata::RtMethodInfo* ctor = get_resolved_data<metadata::RtMethodInfo>(imi, ir->method_idx);
                         metadata::RtClass* klass = ctor->parent;
                         TRY_RUN_CLASS_STATIC_CCTOR(klass);
@@ -6393,7 +6898,7 @@ method_start:
                     LEANCLR_CASE_END_LITE1()
                     LEANCLR_CASE_BEGIN_LITE1(NewValueTypeInterp)
                     {
-                        const auto* ir = reinterpret_cast<const ll::NewValueTypeInterp*>(ip);
+                        const auto* ir = reinterpret_cast<const ll::NewValueTypeInterp*>(ip + THREADED_CODE_HEADER_SIZE);
                         const metadata::RtMethodInfo* ctor = get_resolved_data<metadata::RtMethodInfo>(imi, ir->method_idx);
                         metadata::RtClass* klass = ctor->parent;
                         RtStackObject* original_frame_base = eval_stack_base + ir->frame_base;
@@ -6408,7 +6913,7 @@ method_start:
                     LEANCLR_CASE_END_LITE1()
                     LEANCLR_CASE_BEGIN_LITE1(NewObjInternalCall)
                     {
-                        const auto* ir = reinterpret_cast<const ll::NewObjInternalCall*>(ip);
+                        const auto* ir = reinterpret_cast<const ll::NewObjInternalCall*>(ip + THREADED_CODE_HEADER_SIZE);
                         const metadata::RtMethodInfo* target_method = get_resolved_data<metadata::RtMethodInfo>(imi, ir->method_idx);
                         TRY_RUN_CLASS_STATIC_CCTOR(target_method->parent);
                         ip = reinterpret_cast<const uint8_t*>(ir + 1);
@@ -6419,7 +6924,7 @@ method_start:
                     LEANCLR_CASE_END_LITE1()
                     LEANCLR_CASE_BEGIN1(NewObjIntrinsic)
                     {
-                        const auto* ir = reinterpret_cast<const ll::NewObjIntrinsic*>(ip);
+                        const auto* ir = reinterpret_cast<const ll::NewObjIntrinsic*>(ip + THREADED_CODE_HEADER_SIZE);
                         const metadata::RtMethodInfo* target_method = get_resolved_data<metadata::RtMethodInfo>(imi, ir->method_idx);
                         TRY_RUN_CLASS_STATIC_CCTOR(target_method->parent);
                         ip = reinterpret_cast<const uint8_t*>(ir + 1);
@@ -6454,7 +6959,7 @@ method_start:
                     LEANCLR_CASE_END1()
                     LEANCLR_CASE_BEGIN_LITE1(LeaveTryWithFinally)
                     {
-                        const auto* ir = reinterpret_cast<const ll::LeaveTryWithFinally*>(ip);
+                        const auto* ir = reinterpret_cast<const ll::LeaveTryWithFinally*>(ip + THREADED_CODE_HEADER_SIZE);
                         assert(ir->finally_clauses_count > 0);
                         assert(ir->first_finally_clause_index < imi->exception_clause_count);
                         const uint8_t* target_ip = ip + ir->target_offset;
@@ -6465,7 +6970,7 @@ method_start:
                     LEANCLR_CASE_END_LITE1()
                     LEANCLR_CASE_BEGIN_LITE1(LeaveCatchWithFinally)
                     {
-                        const auto* ir = reinterpret_cast<const ll::LeaveCatchWithFinally*>(ip);
+                        const auto* ir = reinterpret_cast<const ll::LeaveCatchWithFinally*>(ip + THREADED_CODE_HEADER_SIZE);
                         assert(ir->finally_clauses_count > 0);
                         assert(ir->first_finally_clause_index < imi->exception_clause_count);
                         vm::RtException* ex = get_exception_in_last_throw_flow(frame, static_cast<uint32_t>(ip - imi->codes));
@@ -6478,7 +6983,7 @@ method_start:
                     LEANCLR_CASE_END_LITE1()
                     LEANCLR_CASE_BEGIN_LITE1(LeaveCatchWithoutFinally)
                     {
-                        const auto* ir = reinterpret_cast<const ll::LeaveCatchWithoutFinally*>(ip);
+                        const auto* ir = reinterpret_cast<const ll::LeaveCatchWithoutFinally*>(ip + THREADED_CODE_HEADER_SIZE);
                         vm::RtException* ex = get_exception_in_last_throw_flow(frame, static_cast<uint32_t>(ip - imi->codes));
                         pop_throw_flow(ex, frame);
                         ip += ir->target_offset;
@@ -6486,7 +6991,7 @@ method_start:
                     LEANCLR_CASE_END_LITE1()
                     LEANCLR_CASE_BEGIN_LITE1(EndFilter)
                     {
-                        const auto* ir = reinterpret_cast<const ll::EndFilter*>(ip);
+                        const auto* ir = reinterpret_cast<const ll::EndFilter*>(ip + THREADED_CODE_HEADER_SIZE);
                         int32_t cond = get_stack_value_at<int32_t>(eval_stack_base, ir->cond);
                         if (cond)
                         {
@@ -6511,17 +7016,47 @@ method_start:
                         goto unwind_exception_handler;
                     }
                     LEANCLR_CASE_END_LITE1()
-#if !LEANCLR_USE_COMPUTED_GOTO_DISPATCHER
-                default:
-                {
-                    assert(false && "Invalid opcode");
-                    RAISE_RUNTIME_ERROR(RtErr::ExecutionEngine);
-                }
+                    LEANCLR_CASE_BEGIN1(StfldRef)
+                    {
+                        vm::RtObject* obj = get_stack_value_at<vm::RtObject*>(eval_stack_base, ir->obj);
+                        if (!obj)
+                        {
+                            RAISE_RUNTIME_ERROR(RtErr::NullReference);
+                        }
+                        vm::RtObject* value = get_stack_value_at<vm::RtObject*>(eval_stack_base, ir->value);
+                        vm::RtObject** field_addr = reinterpret_cast<vm::RtObject**>(reinterpret_cast<uint8_t*>(obj) + ir->offset);
+                        gc::GarbageCollector::write_barrier(field_addr, value);
+                    }
+                    LEANCLR_CASE_END1()
+                    LEANCLR_CASE_BEGIN1(CpObjRef)
+                    {
+                        RtStackObject* dst_obj = eval_stack_base + ir->dst;
+                        RtStackObject* src_obj = eval_stack_base + ir->src;
+                        vm::RtObject** dst_addr = reinterpret_cast<vm::RtObject**>(dst_obj->ptr);
+                        vm::RtObject* const* src_addr = reinterpret_cast<vm::RtObject* const*>(src_obj->cptr);
+                        gc::GarbageCollector::write_barrier(dst_addr, *src_addr);
+                    }
+                    LEANCLR_CASE_END1()
+                    LEANCLR_CASE_BEGIN1(StIndRefShort)
+                    {
+                        vm::RtObject* value = get_stack_value_at<vm::RtObject*>(eval_stack_base, ir->src);
+                        vm::RtObject** dst_addr = get_stack_value_at<vm::RtObject**>(eval_stack_base, ir->dst);
+                        gc::GarbageCollector::write_barrier(dst_addr, value);
+                    }
+                    LEANCLR_CASE_END1()
+                    ///{{SUPER_INSTRUCTION_CASES1
+                    ///}}SUPER_INSTRUCTION_CASES1
+#if !LEANCLR_USE_COMPUTED_GOTO_DISPATCHER
+                default:
+                {
+                    assert(false && "Invalid opcode");
+                    RAISE_RUNTIME_ERROR(RtErr::ExecutionEngine);
+                }
 #endif
                 }
             }
             LEANCLR_CASE_END_LITE0()
-            LEANCLR_CASE_BEGIN_LITE0(Prefix2)
+            LEANCLR_CASE_BEGIN_DISPATCH0(Prefix2)
             {
                 LEANCLR_SWITCH2()
                 {
@@ -6870,6 +7405,345 @@ method_start:
                         set_stack_value_at<int32_t>(eval_stack_base, ir->dst, hash);
                     }
                     LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(LdsfldU1NoCctor)
+                    {
+                        const metadata::RtFieldInfo* field = get_resolved_data<metadata::RtFieldInfo>(imi, ir->field_idx);
+                        const uint8_t* field_addr = get_static_field_address<uint8_t>(field);
+                        uint8_t value = *field_addr;
+                        set_stack_value_at<int32_t>(eval_stack_base, ir->dst, static_cast<int32_t>(value));
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(LdsfldI4NoCctor)
+                    {
+                        const metadata::RtFieldInfo* field = get_resolved_data<metadata::RtFieldInfo>(imi, ir->field_idx);
+                        const int32_t* field_addr = get_static_field_address<int32_t>(field);
+                        int32_t value = *field_addr;
+                        set_stack_value_at<int32_t>(eval_stack_base, ir->dst, value);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(LdsfldI8NoCctor)
+                    {
+                        const metadata::RtFieldInfo* field = get_resolved_data<metadata::RtFieldInfo>(imi, ir->field_idx);
+                        const int64_t* field_addr = get_static_field_address<int64_t>(field);
+                        int64_t value = *field_addr;
+                        set_stack_value_at<int64_t>(eval_stack_base, ir->dst, value);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(LdsfldaNoCctor)
+                    {
+                        const metadata::RtFieldInfo* field = get_resolved_data<metadata::RtFieldInfo>(imi, ir->field_idx);
+                        const void* field_addr = get_static_field_address<void>(field);
+                        set_stack_value_at(eval_stack_base, ir->dst, field_addr);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(StsfldI4NoCctor)
+                    {
+                        int32_t value = get_stack_value_at<int32_t>(eval_stack_base, ir->value);
+                        const metadata::RtFieldInfo* field = get_resolved_data<metadata::RtFieldInfo>(imi, ir->field_idx);
+                        int32_t* field_addr = get_static_field_address<int32_t>(field);
+                        *field_addr = value;
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(StsfldI8NoCctor)
+                    {
+                        int64_t value = get_stack_value_at<int64_t>(eval_stack_base, ir->value);
+                        const metadata::RtFieldInfo* field = get_resolved_data<metadata::RtFieldInfo>(imi, ir->field_idx);
+                        int64_t* field_addr = get_static_field_address<int64_t>(field);
+                        *field_addr = value;
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN_LITE2(CallInterpNoCctor)
+                    {
+                        const auto* ir = reinterpret_cast<const ll::CallInterpNoCctor*>(ip + THREADED_CODE_HEADER_SIZE);
+                        const metadata::RtMethodInfo* target_method = get_resolved_data<metadata::RtMethodInfo>(imi, ir->method_idx);
+                        const uint8_t* next_ip = reinterpret_cast<const uint8_t*>(ir + 1);
+                        ENTER_INTERP_FRAME(target_method, ir->frame_base, next_ip);
+                    }
+                    LEANCLR_CASE_END_LITE2()
+                    LEANCLR_CASE_BEGIN2(CountBackEdge)
+                    {
+                        ++const_cast<metadata::RtMethodInfo*>(frame->method)->back_edge_count;
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(LdelemaUnchecked)
+                    {
+                        vm::RtArray* array = get_stack_value_at<vm::RtArray*>(eval_stack_base, ir->arr);
+                        int32_t index = get_stack_value_at<int32_t>(eval_stack_base, ir->index);
+                        metadata::RtClass* arr_klass = array->klass;
+                        metadata::RtClass* element_klass = vm::Class::get_array_element_class(arr_klass);
+                        metadata::RtClass* check_klass = get_resolved_data<metadata::RtClass>(imi, ir->ele_klass_idx);
+                        if (!vm::Class::is_pointer_element_compatible_with(element_klass, check_klass))
+                        {
+                            RAISE_RUNTIME_ERROR(RtErr::ArrayTypeMismatch);
+                        }
+                        const void* element_addr = vm::Array::get_array_element_address_as_ptr_void(array, index);
+                        set_stack_value_at(eval_stack_base, ir->dst, element_addr);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(LdelemaReadOnlyUnchecked)
+                    {
+                        vm::RtArray* array = get_stack_value_at<vm::RtArray*>(eval_stack_base, ir->arr);
+                        int32_t index = get_stack_value_at<int32_t>(eval_stack_base, ir->index);
+                        const void* element_addr = vm::Array::get_array_element_address_as_ptr_void(array, index);
+                        set_stack_value_at(eval_stack_base, ir->dst, element_addr);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(LdelemI1Unchecked)
+                    {
+                        vm::RtArray* array = get_stack_value_at<vm::RtArray*>(eval_stack_base, ir->arr);
+                        assert(vm::Array::get_array_element_size(array) == 1);
+                        int32_t index = get_stack_value_at<int32_t>(eval_stack_base, ir->index);
+                        int8_t value = vm::Array::get_array_data_at<int8_t>(array, index);
+                        set_stack_value_at<int32_t>(eval_stack_base, ir->dst, static_cast<int32_t>(value));
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(LdelemU1Unchecked)
+                    {
+                        vm::RtArray* array = get_stack_value_at<vm::RtArray*>(eval_stack_base, ir->arr);
+                        assert(vm::Array::get_array_element_size(array) == 1);
+                        int32_t index = get_stack_value_at<int32_t>(eval_stack_base, ir->index);
+                        uint8_t value = vm::Array::get_array_data_at<uint8_t>(array, index);
+                        set_stack_value_at<int32_t>(eval_stack_base, ir->dst, static_cast<int32_t>(value));
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(LdelemI2Unchecked)
+                    {
+                        vm::RtArray* array = get_stack_value_at<vm::RtArray*>(eval_stack_base, ir->arr);
+                        assert(vm::Array::get_array_element_size(array) == 2);
+                        int32_t index = get_stack_value_at<int32_t>(eval_stack_base, ir->index);
+                        int16_t value = vm::Array::get_array_data_at<int16_t>(array, index);
+                        set_stack_value_at<int32_t>(eval_stack_base, ir->dst, static_cast<int32_t>(value));
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(LdelemU2Unchecked)
+                    {
+                        vm::RtArray* array = get_stack_value_at<vm::RtArray*>(eval_stack_base, ir->arr);
+                        assert(vm::Array::get_array_element_size(array) == 2);
+                        int32_t index = get_stack_value_at<int32_t>(eval_stack_base, ir->index);
+                        uint16_t value = vm::Array::get_array_data_at<uint16_t>(array, index);
+                        set_stack_value_at<int32_t>(eval_stack_base, ir->dst, static_cast<int32_t>(value));
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(LdelemI4Unchecked)
+                    {
+                        vm::RtArray* array = get_stack_value_at<vm::RtArray*>(eval_stack_base, ir->arr);
+                        assert(vm::Array::get_array_element_size(array) == 4);
+                        int32_t index = get_stack_value_at<int32_t>(eval_stack_base, ir->index);
+                        int32_t value = vm::Array::get_array_data_at<int32_t>(array, index);
+                        set_stack_value_at<int32_t>(eval_stack_base, ir->dst, value);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(LdelemI8Unchecked)
+                    {
+                        vm::RtArray* array = get_stack_value_at<vm::RtArray*>(eval_stack_base, ir->arr);
+                        assert(vm::Array::get_array_element_size(array) == 8);
+                        int32_t index = get_stack_value_at<int32_t>(eval_stack_base, ir->index);
+                        int64_t value = vm::Array::get_array_data_at<int64_t>(array, index);
+                        set_stack_value_at<int64_t>(eval_stack_base, ir->dst, value);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(LdelemIUnchecked)
+                    {
+                        vm::RtArray* array = get_stack_value_at<vm::RtArray*>(eval_stack_base, ir->arr);
+                        assert(vm::Array::get_array_element_size(array) == PTR_SIZE);
+                        int32_t index = get_stack_value_at<int32_t>(eval_stack_base, ir->index);
+                        intptr_t value = vm::Array::get_array_data_at<intptr_t>(array, index);
+                        set_stack_value_at<intptr_t>(eval_stack_base, ir->dst, value);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(LdelemR4Unchecked)
+                    {
+                        vm::RtArray* array = get_stack_value_at<vm::RtArray*>(eval_stack_base, ir->arr);
+                        assert(vm::Array::get_array_element_size(array) == 4);
+                        int32_t index = get_stack_value_at<int32_t>(eval_stack_base, ir->index);
+                        float value = vm::Array::get_array_data_at<float>(array, index);
+                        set_stack_value_at<float>(eval_stack_base, ir->dst, value);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(LdelemR8Unchecked)
+                    {
+                        vm::RtArray* array = get_stack_value_at<vm::RtArray*>(eval_stack_base, ir->arr);
+                        assert(vm::Array::get_array_element_size(array) == 8);
+                        int32_t index = get_stack_value_at<int32_t>(eval_stack_base, ir->index);
+                        double value = vm::Array::get_array_data_at<double>(array, index);
+                        set_stack_value_at<double>(eval_stack_base, ir->dst, value);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(LdelemRefUnchecked)
+                    {
+                        vm::RtArray* array = get_stack_value_at<vm::RtArray*>(eval_stack_base, ir->arr);
+                        assert(vm::Array::get_array_element_size(array) == PTR_SIZE);
+                        int32_t index = get_stack_value_at<int32_t>(eval_stack_base, ir->index);
+                        vm::RtObject* value = vm::Array::get_array_data_at<vm::RtObject*>(array, index);
+                        set_stack_value_at<vm::RtObject*>(eval_stack_base, ir->dst, value);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(StelemI1Unchecked)
+                    {
+                        vm::RtArray* array = get_stack_value_at<vm::RtArray*>(eval_stack_base, ir->arr);
+                        assert(vm::Array::get_array_element_size(array) == 1);
+                        int32_t index = get_stack_value_at<int32_t>(eval_stack_base, ir->index);
+                        int8_t value = get_stack_value_at<int8_t>(eval_stack_base, ir->value);
+                        vm::Array::set_array_data_at<int8_t>(array, index, value);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(StelemI2Unchecked)
+                    {
+                        vm::RtArray* array = get_stack_value_at<vm::RtArray*>(eval_stack_base, ir->arr);
+                        assert(vm::Array::get_array_element_size(array) == 2);
+                        int32_t index = get_stack_value_at<int32_t>(eval_stack_base, ir->index);
+                        int16_t value = get_stack_value_at<int16_t>(eval_stack_base, ir->value);
+                        vm::Array::set_array_data_at<int16_t>(array, index, value);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(StelemI4Unchecked)
+                    {
+                        vm::RtArray* array = get_stack_value_at<vm::RtArray*>(eval_stack_base, ir->arr);
+                        assert(vm::Array::get_array_element_size(array) == 4);
+                        int32_t index = get_stack_value_at<int32_t>(eval_stack_base, ir->index);
+                        int32_t value = get_stack_value_at<int32_t>(eval_stack_base, ir->value);
+                        vm::Array::set_array_data_at<int32_t>(array, index, value);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(StelemI8Unchecked)
+                    {
+                        vm::RtArray* array = get_stack_value_at<vm::RtArray*>(eval_stack_base, ir->arr);
+                        assert(vm::Array::get_array_element_size(array) == 8);
+                        int32_t index = get_stack_value_at<int32_t>(eval_stack_base, ir->index);
+                        int64_t value = get_stack_value_at<int64_t>(eval_stack_base, ir->value);
+                        vm::Array::set_array_data_at<int64_t>(array, index, value);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(StelemIUnchecked)
+                    {
+                        vm::RtArray* array = get_stack_value_at<vm::RtArray*>(eval_stack_base, ir->arr);
+                        assert(vm::Array::get_array_element_size(array) == PTR_SIZE);
+                        int32_t index = get_stack_value_at<int32_t>(eval_stack_base, ir->index);
+                        intptr_t value = get_stack_value_at<intptr_t>(eval_stack_base, ir->value);
+                        vm::Array::set_array_data_at<intptr_t>(array, index, value);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(StelemR4Unchecked)
+                    {
+                        vm::RtArray* array = get_stack_value_at<vm::RtArray*>(eval_stack_base, ir->arr);
+                        assert(vm::Array::get_array_element_size(array) == 4);
+                        int32_t index = get_stack_value_at<int32_t>(eval_stack_base, ir->index);
+                        float value = get_stack_value_at<float>(eval_stack_base, ir->value);
+                        vm::Array::set_array_data_at<float>(array, index, value);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(StelemR8Unchecked)
+                    {
+                        vm::RtArray* array = get_stack_value_at<vm::RtArray*>(eval_stack_base, ir->arr);
+                        assert(vm::Array::get_array_element_size(array) == 8);
+                        int32_t index = get_stack_value_at<int32_t>(eval_stack_base, ir->index);
+                        double value = get_stack_value_at<double>(eval_stack_base, ir->value);
+                        vm::Array::set_array_data_at<double>(array, index, value);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN_LITE2(InvokeDelegate)
+                    {
+                        // A single-cast delegate to an interpreted method enters the target's frame in place of the
+                        // Invoke call, with the args rearranged the way Delegate::invoke_delegate_invoker does.
+                        const auto* ir = reinterpret_cast<const ll::InvokeDelegate*>(ip + THREADED_CODE_HEADER_SIZE);
+                        const metadata::RtMethodInfo* invoke_method = get_resolved_data<metadata::RtMethodInfo>(imi, ir->method_idx);
+                        RtStackObject* frame_base = eval_stack_base + ir->frame_base;
+                        vm::RtMulticastDelegate* del = get_stack_value_at<vm::RtMulticastDelegate*>(eval_stack_base, ir->frame_base);
+                        if (!del)
+                        {
+                            RAISE_RUNTIME_ERROR(RtErr::NullReference);
+                        }
+                        const metadata::RtMethodInfo* target_method = del->dele.method;
+                        if (!del->deles && target_method->invoker_type == metadata::RtInvokerType::Interpreter)
+                        {
+                            vm::RtObject* target_obj = del->dele.target;
+                            const size_t param_stack_object_size = invoke_method->total_arg_stack_object_size - 1;
+                            switch (static_cast<int32_t>(invoke_method->parameter_count) - static_cast<int32_t>(target_method->parameter_count))
+                            {
+                            case 0:
+                            {
+                                if (vm::Method::is_instance(target_method))
+                                {
+                                    if (!target_obj)
+                                    {
+                                        RAISE_RUNTIME_ERROR(RtErr::NullReference);
+                                    }
+                                    // closed instance, the target replaces the delegate as this
+                                    set_stack_value_at(eval_stack_base, ir->frame_base,
+                                                       vm::Class::is_value_type(target_method->parent) ? target_obj + 1 : target_obj);
+                                }
+                                else
+                                {
+                                    // open static, the args move over the delegate
+                                    TRY_RUN_CLASS_STATIC_CCTOR(target_method->parent);
+                                    std::memmove(frame_base, frame_base + 1, param_stack_object_size * sizeof(RtStackObject));
+                                }
+                                break;
+                            }
+                            case 1:
+                            {
+                                // open instance, the first arg is this
+                                if (!get_stack_value_at<vm::RtObject*>(eval_stack_base, ir->frame_base + 1))
+                                {
+                                    RAISE_RUNTIME_ERROR(RtErr::NullReference);
+                                }
+                                std::memmove(frame_base, frame_base + 1, param_stack_object_size * sizeof(RtStackObject));
+                                break;
+                            }
+                            case -1:
+                            {
+                                // closed static, the target is the first arg
+                                TRY_RUN_CLASS_STATIC_CCTOR(target_method->parent);
+                                set_stack_value_at(eval_stack_base, ir->frame_base, target_obj);
+                                break;
+                            }
+                            default:
+                                RAISE_RUNTIME_ERROR(RtErr::ExecutionEngine);
+                            }
+                            ENTER_INTERP_FRAME(target_method, ir->frame_base, reinterpret_cast<const uint8_t*>(ir + 1));
+                        }
+                        ip = reinterpret_cast<const uint8_t*>(ir + 1);
+                        HANDLE_RAISE_RUNTIME_ERROR_VOID(invoke_method->invoke_method_ptr(invoke_method->method_ptr, invoke_method, frame_base, frame_base));
+                    }
+                    LEANCLR_CASE_END_LITE2()
+                    LEANCLR_CASE_BEGIN2(StfldAnyRef)
+                    {
+                        vm::RtObject* obj = get_stack_value_at<vm::RtObject*>(eval_stack_base, ir->obj);
+                        if (!obj)
+                        {
+                            RAISE_RUNTIME_ERROR(RtErr::NullReference);
+                        }
+                        RtStackObject* src = eval_stack_base + ir->value;
+                        uint8_t* field_addr = reinterpret_cast<uint8_t*>(obj) + ir->offset;
+                        std::memcpy(field_addr, src, ir->size);
+                        gc::GarbageCollector::write_barrier_range(field_addr, ir->size);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(StIndRef)
+                    {
+                        vm::RtObject* value = get_stack_value_at<vm::RtObject*>(eval_stack_base, ir->src);
+                        vm::RtObject** dst_addr = get_stack_value_at<vm::RtObject**>(eval_stack_base, ir->dst);
+                        gc::GarbageCollector::write_barrier(dst_addr, value);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(CpObjAnyRef)
+                    {
+                        RtStackObject* dst_obj = eval_stack_base + ir->dst;
+                        RtStackObject* src_obj = eval_stack_base + ir->src;
+                        std::memcpy(dst_obj->ptr, src_obj->cptr, ir->size);
+                        gc::GarbageCollector::write_barrier_range(dst_obj->ptr, ir->size);
+                    }
+                    LEANCLR_CASE_END2()
+                    LEANCLR_CASE_BEGIN2(StObjAnyRef)
+                    {
+                        RtStackObject* addr_obj = eval_stack_base + ir->addr;
+                        RtStackObject* src = eval_stack_base + ir->src;
+                        std::memcpy(addr_obj->ptr, src, ir->size);
+                        gc::GarbageCollector::write_barrier_range(addr_obj->ptr, ir->size);
+                    }
+                    LEANCLR_CASE_END2()
+                    ///{{SUPER_INSTRUCTION_CASES2
+                    ///}}SUPER_INSTRUCTION_CASES2
 #if !LEANCLR_USE_COMPUTED_GOTO_DISPATCHER
                 default:
                 {
@@ -6880,7 +7754,7 @@ method_start:
                 }
             }
             LEANCLR_CASE_END_LITE0()
-            LEANCLR_CASE_BEGIN_LITE0(Prefix3)
+            LEANCLR_CASE_BEGIN_DISPATCH0(Prefix3)
             {
                 LEANCLR_SWITCH3()
                 {
@@ -8035,6 +8909,33 @@ method_start:
                         std::memmove(dst_addr, src_addr, ir->size);
                     }
                     LEANCLR_CASE_END3()
+                    LEANCLR_CASE_BEGIN3(StfldRefLarge)
+                    {
+                        vm::RtObject* obj = get_stack_value_at<vm::RtObject*>(eval_stack_base, ir->obj);
+                        if (!obj)
+                        {
+                            RAISE_RUNTIME_ERROR(RtErr::NullReference);
+                        }
+                        vm::RtObject* value = get_stack_value_at<vm::RtObject*>(eval_stack_base, ir->value);
+                        vm::RtObject** field_addr = reinterpret_cast<vm::RtObject**>(reinterpret_cast<uint8_t*>(obj) + ir->offset);
+                        gc::GarbageCollector::write_barrier(field_addr, value);
+                    }
+                    LEANCLR_CASE_END3()
+                    LEANCLR_CASE_BEGIN3(StfldAnyRefLarge)
+                    {
+                        vm::RtObject* obj = get_stack_value_at<vm::RtObject*>(eval_stack_base, ir->obj);
+                        if (!obj)
+                        {
+                            RAISE_RUNTIME_ERROR(RtErr::NullReference);
+                        }
+                        const uint8_t* src_addr = reinterpret_cast<const uint8_t*>(eval_stack_base + ir->value);
+                        uint8_t* dst_addr = reinterpret_cast<uint8_t*>(obj) + ir->offset;
+                        std::memmove(dst_addr, src_addr, ir->size);
+                        gc::GarbageCollector::write_barrier_range(dst_addr, ir->size);
+                    }
+                    LEANCLR_CASE_END3()
+                    ///{{SUPER_INSTRUCTION_CASES3
+                    ///}}SUPER_INSTRUCTION_CASES3
 #if !LEANCLR_USE_COMPUTED_GOTO_DISPATCHER
                 default:
                 {
@@ -8045,7 +8946,7 @@ method_start:
                 }
             }
             LEANCLR_CASE_END_LITE0()
-            LEANCLR_CASE_BEGIN_LITE0(Prefix4)
+            LEANCLR_CASE_BEGIN_DISPATCH0(Prefix4)
             {
                 LEANCLR_SWITCH4()
                 {
@@ -8066,6 +8967,8 @@ method_start:
                         RAISE_RUNTIME_ERROR(RtErr::ExecutionEngine);
                     }
                     LEANCLR_CASE_END4()
+                    ///{{SUPER_INSTRUCTION_CASES4
+                    ///}}SUPER_INSTRUCTION_CASES4
 #if !LEANCLR_USE_COMPUTED_GOTO_DISPATCHER
                 default:
                 {
@@ -8076,7 +8979,7 @@ method_start:
                 }
             }
             LEANCLR_CASE_END_LITE0()
-            LEANCLR_CASE_BEGIN_LITE0(Prefix5)
+            LEANCLR_CASE_BEGIN_DISPATCH0(Prefix5)
             {
                 assert(false && "Not implemented");
                 RAISE_RUNTIME_ERROR(RtErr::ExecutionEngine);
@@ -8097,25 +9000,28 @@ unwind_exception_handler:
     while (true)
     {
         RtStackObject* const eval_stack_base = frame->eval_stack_base;
-        const RtInterpMethodInfo* const imi = frame->method->interp_data;
+        const RtInterpMethodInfo* const imi = frame->imi;
         ExceptionFlow* cur_flow = peek_top_exception_flow();
         assert(cur_flow);
         const RtInterpExceptionClause* clauses = imi->exception_clauses;
-        size_t clause_count = imi->exception_clause_count;
         if (cur_flow->throw_flow)
         {
             auto& data = cur_flow->throw_data;
             vm::RtException* ex = data.ex;
             uint32_t throw_ip_offset = static_cast<uint32_t>(reinterpret_cast<const uint8_t*>(data.ip) - imi->codes);
             bool handled = false;
-            for (size_t i = data.next_search_clause_idx; i < clause_count; ++i)
+            // only the clauses whose try block covers the throw offset are candidates, in clause order
+            const RtInterpExceptionRange* range = InterpDefs::find_exception_range(imi, throw_ip_offset);
+            const size_t range_clause_count = range ? range->clause_count : 0;
+            for (size_t j = 0; j < range_clause_count; ++j)
             {
-                data.next_search_clause_idx = static_cast<size_t>(i + 1);
-                const RtInterpExceptionClause* clause = &clauses[i];
-                if (!clause->is_in_try_block(throw_ip_offset))
+                const size_t i = imi->exception_range_clause_indices[range->first_clause_index_pos + j];
+                if (i < data.next_search_clause_idx)
                 {
                     continue;
                 }
+                data.next_search_clause_idx = static_cast<size_t>(i + 1);
+                const RtInterpExceptionClause* clause = &clauses[i];
 
                 switch (clause->flags)
                 {
@@ -8180,18 +9086,22 @@ unwind_exception_handler:
                 uint32_t src_ip_offset = static_cast<uint32_t>(reinterpret_cast<const uint8_t*>(data.src_ip) - imi->codes);
                 uint32_t target_ip_offset = static_cast<uint32_t>(reinterpret_cast<const uint8_t*>(data.target_ip) - imi->codes);
                 const RtInterpExceptionClause* next_finally_clause = nullptr;
-                for (size_t i = data.next_search_clause_idx; i < clause_count; ++i)
+                // the enclosing finally chain of the leave is the finally clauses covering the source but not the target
+                const RtInterpExceptionRange* range = InterpDefs::find_exception_range(imi, src_ip_offset);
+                assert(range);
+                for (size_t j = 0; j < range->clause_count; ++j)
                 {
+                    const size_t i = imi->exception_range_clause_indices[range->first_clause_index_pos + j];
+                    if (i < data.next_search_clause_idx)
+                    {
+                        continue;
+                    }
+                    data.next_search_clause_idx = static_cast<uint32_t>(i + 1);
                     const RtInterpExceptionClause* clause = &clauses[i];
-                    if (clause->try_begin_offset <= src_ip_offset && src_ip_offset < clause->try_end_offset)
+                    if (clause->flags == metadata::RtILExceptionClauseType::Finally && !clause->is_in_try_block(target_ip_offset))
                     {
-                        data.next_search_clause_idx = static_cast<uint32_t>(i + 1);
-                        if (clause->flags == metadata::RtILExceptionClauseType::Finally && clause->is_in_try_block(src_ip_offset) &&
-                            !clause->is_in_try_block(target_ip_offset))
-                        {
-                            next_finally_clause = clause;
-                            break;
-                        }
+                        next_finally_clause = clause;
+                        break;
                     }
                 }
                 assert(next_finally_clause);
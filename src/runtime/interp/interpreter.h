@@ -8,8 +8,21 @@ namespace leanclr::interp
 class Interpreter
 {
   public:
+    // Export the handlers of the direct-threaded dispatcher, before any method is transformed
+    static void initialize();
+#if LEANCLR_USE_DIRECT_THREADED_DISPATCHER
+    // Write the handler offset of the instruction following the header at `codes` into the header
+    static void thread_instruction(uint8_t* codes);
+    static const int32_t* get_threaded_handler_offsets(size_t& count);
+#endif
     // Execute method by method info and parameters
     static RtResult<const RtInterpMethodInfo*> init_interpreter_method(const metadata::RtMethodInfo* method);
+    // Count an invocation of a method running unoptimized code and re-transform it with optimizations once it is hot
+    static RtResult<const RtInterpMethodInfo*> tier_up_interpreter_method_if_hot(const metadata::RtMethodInfo* method);
+    // Largest number of bytes a single method transformation took from the reusable transform arena
+    static size_t get_transform_arena_high_water_mark();
+    // Mark the exceptions of the throw flows in progress
+    static void mark_roots();
     static RtResult<const interp::RtStackObject*> execute(const metadata::RtMethodInfo* method, const interp::RtStackObject* params);
 };
 } // namespace leanclr::interp
@@ -0,0 +1,934 @@
+#include <cstring>
+
+#include "ir_cache.h"
+#include "code_cache.h"
+#include "ll_opcodes.h"
+#include "interpreter.h"
+#include "metadata/module_def.h"
+#include "metadata/metadata_cache.h"
+#include "utils/binary_reader.h"
+#include "utils/hashmap.h"
+#include "utils/rt_vector.h"
+#include "vm/assembly.h"
+#include "vm/class.h"
+#include "vm/field.h"
+#include "vm/generic_method.h"
+#include "vm/method.h"
+#include "vm/rt_string.h"
+#include "vm/settings.h"
+
+namespace leanclr::interp
+{
+
+// Cache layout, in native byte order:
+//   IrCacheHeader
+//   referenced assembly names, each a u32 length followed by the NUL-terminated name and the MVID of the assembly
+//   method index, an IrCacheMethodEntry per method
+//   method records
+// Metadata references inside records name their assembly by its index in the referenced assembly names. The cache is only
+// used while every referenced assembly still has the MVID it had when the cache was written.
+
+constexpr uint32_t IR_CACHE_MAGIC = 0x4352494C; // "LIRC"
+constexpr uint32_t IR_CACHE_FORMAT_VERSION = 2;
+constexpr size_t IR_CACHE_MVID_SIZE = 16;
+constexpr uint8_t IR_CACHE_NO_GENERIC_INST = 0xFF;
+
+struct IrCacheHeader
+{
+    uint32_t magic;
+    uint32_t version_hash;
+    uint8_t mvid[IR_CACHE_MVID_SIZE];
+    uint32_t assembly_ref_count;
+    uint32_t method_count;
+};
+
+struct IrCacheMethodEntry
+{
+    uint32_t token;
+    // offset of the record from the first record
+    uint32_t offset;
+};
+
+// Methods recorded for one assembly. Records are encoded when the method is transformed, before the interpreter quickens its codes.
+struct IrCacheModuleRecords
+{
+    utils::Vector<metadata::RtModuleDef*> assembly_refs;
+    utils::HashMap<uint32_t, utils::Vector<uint8_t>> methods;
+};
+
+// Cache of one assembly as returned by the loader.
+struct IrCacheLoadedModule
+{
+    const uint8_t* records;
+    size_t records_size;
+    utils::Vector<metadata::RtModuleDef*> assembly_refs;
+    utils::HashMap<uint32_t, uint32_t> method_offsets;
+};
+
+static utils::HashMap<metadata::RtModuleDef*, IrCacheModuleRecords*> s_module_records;
+// nullptr for assemblies without a usable cache
+static utils::HashMap<metadata::RtModuleDef*, IrCacheLoadedModule*> s_loaded_modules;
+
+static uint32_t hash_bytes(uint32_t hash, const void* data, size_t size)
+{
+    // FNV-1a
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    for (size_t i = 0; i < size; ++i)
+    {
+        hash = (hash ^ bytes[i]) * 16777619u;
+    }
+    return hash;
+}
+
+// Cached codes are only valid for the opcode numbering, word size and object header of the runtime that wrote them.
+static uint32_t get_runtime_version_hash()
+{
+    static uint32_t s_hash = 0;
+    if (s_hash == 0)
+    {
+        uint32_t hash = 2166136261u;
+        hash = hash_bytes(hash, &IR_CACHE_FORMAT_VERSION, sizeof(IR_CACHE_FORMAT_VERSION));
+        const uint32_t pointer_size = sizeof(void*);
+        hash = hash_bytes(hash, &pointer_size, sizeof(pointer_size));
+        // field offsets in the codes include the header
+        hash = hash_bytes(hash, &vm::RT_OBJECT_HEADER_SIZE, sizeof(vm::RT_OBJECT_HEADER_SIZE));
+        for (size_t i = 0; i < static_cast<size_t>(ll::OpCodeEnum::__Count); ++i)
+        {
+            const char* name = ll::OpCodes::get_opcode_name(static_cast<ll::OpCodeEnum>(i));
+            hash = hash_bytes(hash, name, std::strlen(name) + 1);
+        }
+#if LEANCLR_USE_DIRECT_THREADED_DISPATCHER
+        // threaded codes embed handler offsets, which change with every build of the dispatcher
+        size_t handler_count;
+        const int32_t* handler_offsets = Interpreter::get_threaded_handler_offsets(handler_count);
+        hash = hash_bytes(hash, handler_offsets, handler_count * sizeof(int32_t));
+#endif
+        s_hash = hash == 0 ? 1 : hash;
+    }
+    return s_hash;
+}
+
+static bool read_module_mvid(metadata::RtModuleDef* mod, uint8_t* mvid)
+{
+    const metadata::CliImage& image = mod->get_cli_image();
+    std::optional<metadata::RowModule> row = image.read_module(1);
+    const metadata::CliHeap& guid_heap = image.get_guid_heap();
+    if (!row || row->mvid == 0 || static_cast<size_t>(row->mvid) * IR_CACHE_MVID_SIZE > guid_heap.size)
+    {
+        return false;
+    }
+    std::memcpy(mvid, guid_heap.data + (row->mvid - 1) * IR_CACHE_MVID_SIZE, IR_CACHE_MVID_SIZE);
+    return true;
+}
+
+// Only method definitions of the assembly itself are keyed; methods of generic instances and arrays are always transformed.
+static bool is_cacheable_method(metadata::RtModuleDef* mod, const metadata::RtMethodInfo* method)
+{
+    metadata::RtClass* klass = method->parent;
+    return method->token != 0 && !method->generic_method && klass->image == mod && !vm::Class::is_generic_inst(klass) &&
+           !vm::Class::is_array_or_szarray(klass);
+}
+
+class IrCacheWriter
+{
+  public:
+    void write_u8(uint8_t value)
+    {
+        _data.push_back(value);
+    }
+
+    void write_u16(uint16_t value)
+    {
+        write_bytes(&value, sizeof(value));
+    }
+
+    void write_u32(uint32_t value)
+    {
+        write_bytes(&value, sizeof(value));
+    }
+
+    void write_bytes(const void* data, size_t size)
+    {
+        _data.push_range(static_cast<const uint8_t*>(data), size);
+    }
+
+    const utils::Vector<uint8_t>& get_data() const
+    {
+        return _data;
+    }
+
+  private:
+    utils::Vector<uint8_t> _data;
+};
+
+class IrCacheEncoder
+{
+  public:
+    IrCacheEncoder(metadata::RtModuleDef* mod, IrCacheModuleRecords* records, IrCacheWriter& writer) : _mod(mod), _records(records), _writer(writer)
+    {
+    }
+
+    bool encode_method_info(const RtInterpMethodInfo* imi, const RtResolvedDataSource* sources, size_t count)
+    {
+        _writer.write_u32(static_cast<uint32_t>(count));
+        for (size_t i = 0; i < count; ++i)
+        {
+            if (!encode_resolved_data(sources[i]))
+            {
+                return false;
+            }
+        }
+
+        _writer.write_u8(imi->exception_clause_count);
+        for (size_t i = 0; i < imi->exception_clause_count; ++i)
+        {
+            const RtInterpExceptionClause& clause = imi->exception_clauses[i];
+            _writer.write_u8(static_cast<uint8_t>(clause.flags));
+            _writer.write_u32(clause.try_begin_offset);
+            _writer.write_u32(clause.try_end_offset);
+            _writer.write_u32(clause.handler_begin_offset);
+            _writer.write_u32(clause.handler_end_offset);
+            _writer.write_u32(clause.filter_begin_offset);
+            _writer.write_u8(clause.ex_klass ? 1 : 0);
+            if (clause.ex_klass && !encode_class(clause.ex_klass))
+            {
+                return false;
+            }
+        }
+
+        _writer.write_u8(imi->optimized ? 1 : 0);
+        _writer.write_u8(imi->init_locals ? 1 : 0);
+        _writer.write_u16(imi->total_arg_and_local_stack_object_size);
+        _writer.write_u16(imi->max_stack_object_size);
+        _writer.write_u32(imi->code_size);
+        _writer.write_bytes(imi->codes, imi->code_size);
+        return true;
+    }
+
+  private:
+    metadata::RtModuleDef* _mod;
+    IrCacheModuleRecords* _records;
+    IrCacheWriter& _writer;
+
+    void encode_module(metadata::RtModuleDef* mod)
+    {
+        utils::Vector<metadata::RtModuleDef*>& refs = _records->assembly_refs;
+        size_t index = 0;
+        while (index < refs.size() && refs[index] != mod)
+        {
+            ++index;
+        }
+        if (index == refs.size())
+        {
+            refs.push_back(mod);
+        }
+        _writer.write_u16(static_cast<uint16_t>(index));
+    }
+
+    void encode_gid(uint32_t gid)
+    {
+        encode_module(metadata::RtModuleDef::get_module_by_id(metadata::RtMetadata::decode_module_id_from_gid(gid)));
+        _writer.write_u32(metadata::RtMetadata::decode_rid_from_gid(gid));
+    }
+
+    bool encode_generic_inst(const metadata::RtGenericInst* inst)
+    {
+        if (!inst)
+        {
+            _writer.write_u8(IR_CACHE_NO_GENERIC_INST);
+            return true;
+        }
+        _writer.write_u8(inst->generic_arg_count);
+        for (uint8_t i = 0; i < inst->generic_arg_count; ++i)
+        {
+            if (!encode_typesig(inst->generic_args[i]))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool encode_typesig(const metadata::RtTypeSig* typesig)
+    {
+        if (!typesig->is_canonized())
+        {
+            return false;
+        }
+        _writer.write_u8(static_cast<uint8_t>(typesig->ele_type));
+        _writer.write_u8(typesig->by_ref);
+        switch (typesig->ele_type)
+        {
+        case metadata::RtElementType::Void:
+        case metadata::RtElementType::Boolean:
+        case metadata::RtElementType::Char:
+        case metadata::RtElementType::I1:
+        case metadata::RtElementType::U1:
+        case metadata::RtElementType::I2:
+        case metadata::RtElementType::U2:
+        case metadata::RtElementType::I4:
+        case metadata::RtElementType::U4:
+        case metadata::RtElementType::I8:
+        case metadata::RtElementType::U8:
+        case metadata::RtElementType::R4:
+        case metadata::RtElementType::R8:
+        case metadata::RtElementType::String:
+        case metadata::RtElementType::TypedByRef:
+        case metadata::RtElementType::I:
+        case metadata::RtElementType::U:
+        case metadata::RtElementType::Object:
+            return true;
+        case metadata::RtElementType::Class:
+        case metadata::RtElementType::ValueType:
+            encode_gid(typesig->data.type_def_gid);
+            return true;
+        case metadata::RtElementType::GenericInst:
+            encode_gid(typesig->data.generic_class->base_type_def_gid);
+            return typesig->data.generic_class->class_inst && encode_generic_inst(typesig->data.generic_class->class_inst);
+        case metadata::RtElementType::Ptr:
+        case metadata::RtElementType::SZArray:
+            return encode_typesig(typesig->data.element_type);
+        case metadata::RtElementType::Array:
+        {
+            const metadata::RtArrayType* array_type = typesig->data.array_type;
+            if (array_type->num_sizes != 0 || array_type->num_bounds != 0)
+            {
+                return false;
+            }
+            _writer.write_u8(array_type->rank);
+            return encode_typesig(array_type->ele_type);
+        }
+        default:
+            return false;
+        }
+    }
+
+    bool encode_class(metadata::RtClass* klass)
+    {
+        return encode_typesig(vm::Class::get_by_val_type_sig(klass));
+    }
+
+    bool encode_method(const metadata::RtMethodInfo* method)
+    {
+        const metadata::RtGenericMethod* generic_method = method->generic_method;
+        if (generic_method)
+        {
+            _writer.write_u8(1);
+            encode_gid(generic_method->base_method_gid);
+            return encode_generic_inst(generic_method->generic_context.class_inst) && encode_generic_inst(generic_method->generic_context.method_inst);
+        }
+        _writer.write_u8(0);
+        if (!encode_class(method->parent))
+        {
+            return false;
+        }
+        _writer.write_u32(static_cast<uint32_t>(vm::Method::get_method_index_in_class(method)));
+        return true;
+    }
+
+    bool encode_field(const metadata::RtFieldInfo* field)
+    {
+        if (!encode_class(field->parent))
+        {
+            return false;
+        }
+        _writer.write_u32(static_cast<uint32_t>(field - field->parent->fields));
+        return true;
+    }
+
+    bool encode_resolved_data(const RtResolvedDataSource& data)
+    {
+        _writer.write_u8(static_cast<uint8_t>(data.kind));
+        switch (data.kind)
+        {
+        case RtResolvedDataKind::Class:
+            return encode_class(static_cast<metadata::RtClass*>(const_cast<void*>(data.source)));
+        case RtResolvedDataKind::Method:
+            return encode_method(static_cast<const metadata::RtMethodInfo*>(data.source));
+        case RtResolvedDataKind::Field:
+        case RtResolvedDataKind::FieldRvaData:
+            return encode_field(static_cast<const metadata::RtFieldInfo*>(data.source));
+        case RtResolvedDataKind::TypeSig:
+            return encode_typesig(static_cast<const metadata::RtTypeSig*>(data.source));
+        case RtResolvedDataKind::UserString:
+        {
+            vm::RtString* str = static_cast<vm::RtString*>(const_cast<void*>(data.source));
+            // the empty string is shared rather than cached per index; the first byte of the #US heap is always an empty entry
+            uint32_t index = 0;
+            if (vm::String::get_length(str) != 0 && !_mod->find_user_string_index(str, index))
+            {
+                return false;
+            }
+            _writer.write_u32(index);
+            return true;
+        }
+        case RtResolvedDataKind::VirtualCallCache:
+            return encode_method(static_cast<const RtVirtualCallCache*>(data.source)->virtual_method);
+        case RtResolvedDataKind::TypeCheckCache:
+            return encode_class(static_cast<const RtTypeCheckCache*>(data.source)->klass);
+        default:
+            return false;
+        }
+    }
+};
+
+class IrCacheDecoder
+{
+  public:
+    IrCacheDecoder(metadata::RtModuleDef* mod, IrCacheLoadedModule* loaded, utils::BinaryReader& reader) : _mod(mod), _loaded(loaded), _reader(reader)
+    {
+    }
+
+    RtResult<const RtInterpMethodInfo*> decode_method_info()
+    {
+        MethodCodePool code_pool(_mod);
+        alloc::MemPool& pool = code_pool.get();
+        RtInterpMethodInfo* imi = pool.malloc_any_zeroed<RtInterpMethodInfo>();
+
+        uint32_t resolved_data_count;
+        RET_ERR_ON_FAIL(read_u32(resolved_data_count));
+        if (resolved_data_count > 0)
+        {
+            const void** resolved_datas = pool.calloc_any<const void*>(resolved_data_count);
+            for (uint32_t i = 0; i < resolved_data_count; ++i)
+            {
+                uint8_t kind;
+                RET_ERR_ON_FAIL(read_u8(kind));
+                DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(const void*, source, decode_resolved_data_source(static_cast<RtResolvedDataKind>(kind)));
+                UNWRAP_OR_RET_ERR_ON_FAIL(resolved_datas[i], create_resolved_data(pool, static_cast<RtResolvedDataKind>(kind), source));
+            }
+            imi->resolved_datas = resolved_datas;
+        }
+
+        uint8_t clause_count;
+        RET_ERR_ON_FAIL(read_u8(clause_count));
+        if (clause_count > 0)
+        {
+            RtInterpExceptionClause* clauses = pool.calloc_any<RtInterpExceptionClause>(clause_count);
+            for (uint8_t i = 0; i < clause_count; ++i)
+            {
+                RtInterpExceptionClause& clause = clauses[i];
+                uint8_t flags;
+                uint8_t has_klass;
+                RET_ERR_ON_FAIL(read_u8(flags));
+                clause.flags = static_cast<metadata::RtILExceptionClauseType>(flags);
+                RET_ERR_ON_FAIL(read_u32(clause.try_begin_offset));
+                RET_ERR_ON_FAIL(read_u32(clause.try_end_offset));
+                RET_ERR_ON_FAIL(read_u32(clause.handler_begin_offset));
+                RET_ERR_ON_FAIL(read_u32(clause.handler_end_offset));
+                RET_ERR_ON_FAIL(read_u32(clause.filter_begin_offset));
+                RET_ERR_ON_FAIL(read_u8(has_klass));
+                if (has_klass)
+                {
+                    UNWRAP_OR_RET_ERR_ON_FAIL(clause.ex_klass, decode_class());
+                }
+            }
+            imi->exception_clauses = clauses;
+            imi->exception_clause_count = clause_count;
+            InterpDefs::build_exception_ranges(imi, pool);
+        }
+
+        uint8_t optimized;
+        uint8_t init_locals;
+        RET_ERR_ON_FAIL(read_u8(optimized));
+        RET_ERR_ON_FAIL(read_u8(init_locals));
+        imi->optimized = optimized != 0;
+        imi->init_locals = init_locals != 0;
+        RET_ERR_ON_FAIL(read_u16(imi->total_arg_and_local_stack_object_size));
+        RET_ERR_ON_FAIL(read_u16(imi->max_stack_object_size));
+        RET_ERR_ON_FAIL(read_u32(imi->code_size));
+        // codes are quickened in place, so they are copied out of the read-only cache
+        uint8_t* codes = pool.calloc_any<uint8_t>(imi->code_size);
+        if (!_reader.try_read_bytes(codes, imi->code_size))
+        {
+            RET_ERR(RtErr::BadImageFormat);
+        }
+        imi->codes = codes;
+        code_pool.release_to(imi);
+        RET_OK(imi);
+    }
+
+    // Checks that the resolved datas and exception classes of a freshly encoded record decode back to the same metadata.
+    bool verify_method_info(const RtInterpMethodInfo* imi, const RtResolvedDataSource* sources, size_t count)
+    {
+        uint32_t resolved_data_count;
+        if (read_u32(resolved_data_count).is_err() || resolved_data_count != count)
+        {
+            return false;
+        }
+        for (size_t i = 0; i < count; ++i)
+        {
+            uint8_t kind;
+            if (read_u8(kind).is_err())
+            {
+                return false;
+            }
+            auto ret = decode_resolved_data_source(static_cast<RtResolvedDataKind>(kind));
+            if (ret.is_err() || !is_same_source(sources[i], ret.unwrap()))
+            {
+                return false;
+            }
+        }
+        uint8_t clause_count;
+        if (read_u8(clause_count).is_err())
+        {
+            return false;
+        }
+        for (uint8_t i = 0; i < clause_count; ++i)
+        {
+            uint8_t has_klass;
+            if (!_reader.try_advance(1 + 5 * sizeof(uint32_t)) || read_u8(has_klass).is_err())
+            {
+                return false;
+            }
+            if (has_klass)
+            {
+                auto ret = decode_class();
+                if (ret.is_err() || ret.unwrap() != imi->exception_clauses[i].ex_klass)
+                {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+  private:
+    metadata::RtModuleDef* _mod;
+    IrCacheLoadedModule* _loaded;
+    utils::BinaryReader& _reader;
+
+    static bool is_same_source(const RtResolvedDataSource& expected, const void* decoded)
+    {
+        switch (expected.kind)
+        {
+        case RtResolvedDataKind::VirtualCallCache:
+            return static_cast<const RtVirtualCallCache*>(expected.source)->virtual_method == decoded;
+        case RtResolvedDataKind::TypeCheckCache:
+            return static_cast<const RtTypeCheckCache*>(expected.source)->klass == decoded;
+        default:
+            return expected.source == decoded;
+        }
+    }
+
+    RtResultVoid read_u8(uint8_t& value)
+    {
+        if (!_reader.try_read_byte(value))
+        {
+            RET_ERR(RtErr::BadImageFormat);
+        }
+        RET_VOID_OK();
+    }
+
+    RtResultVoid read_u16(uint16_t& value)
+    {
+        if (!_reader.try_read_any(value))
+        {
+            RET_ERR(RtErr::BadImageFormat);
+        }
+        RET_VOID_OK();
+    }
+
+    RtResultVoid read_u32(uint32_t& value)
+    {
+        if (!_reader.try_read_any(value))
+        {
+            RET_ERR(RtErr::BadImageFormat);
+        }
+        RET_VOID_OK();
+    }
+
+    RtResult<metadata::RtModuleDef*> decode_module()
+    {
+        uint16_t index;
+        RET_ERR_ON_FAIL(read_u16(index));
+        if (index >= _loaded->assembly_refs.size())
+        {
+            RET_ERR(RtErr::BadImageFormat);
+        }
+        RET_OK(_loaded->assembly_refs[index]);
+    }
+
+    RtResult<uint32_t> decode_gid(uint32_t max_rid)
+    {
+        DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(metadata::RtModuleDef*, mod, decode_module());
+        uint32_t rid;
+        RET_ERR_ON_FAIL(read_u32(rid));
+        if (rid == 0 || rid > max_rid)
+        {
+            RET_ERR(RtErr::BadImageFormat);
+        }
+        RET_OK(metadata::RtMetadata::encode_gid_by_rid(*mod, rid));
+    }
+
+    RtResult<const metadata::RtGenericInst*> decode_generic_inst()
+    {
+        uint8_t count;
+        RET_ERR_ON_FAIL(read_u8(count));
+        if (count == IR_CACHE_NO_GENERIC_INST)
+        {
+            RET_OK(static_cast<const metadata::RtGenericInst*>(nullptr));
+        }
+        utils::Vector<const metadata::RtTypeSig*> args;
+        for (uint8_t i = 0; i < count; ++i)
+        {
+            DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(const metadata::RtTypeSig*, arg, decode_typesig());
+            args.push_back(arg);
+        }
+        return metadata::MetadataCache::get_pooled_generic_inst(args.data(), count);
+    }
+
+    RtResult<const metadata::RtTypeSig*> decode_typesig()
+    {
+        uint8_t ele_type_value;
+        uint8_t by_ref;
+        RET_ERR_ON_FAIL(read_u8(ele_type_value));
+        RET_ERR_ON_FAIL(read_u8(by_ref));
+        const metadata::RtElementType ele_type = static_cast<metadata::RtElementType>(ele_type_value);
+        switch (ele_type)
+        {
+        case metadata::RtElementType::Class:
+        case metadata::RtElementType::ValueType:
+        {
+            DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(metadata::RtModuleDef*, mod, decode_module());
+            uint32_t rid;
+            RET_ERR_ON_FAIL(read_u32(rid));
+            if (rid == 0 || rid > mod->get_class_count())
+            {
+                RET_ERR(RtErr::BadImageFormat);
+            }
+            return by_ref ? mod->get_type_def_by_ref_typesig(rid) : mod->get_type_def_by_val_typesig(rid);
+        }
+        case metadata::RtElementType::GenericInst:
+        {
+            DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(metadata::RtModuleDef*, mod, decode_module());
+            uint32_t rid;
+            RET_ERR_ON_FAIL(read_u32(rid));
+            if (rid == 0 || rid > mod->get_class_count())
+            {
+                RET_ERR(RtErr::BadImageFormat);
+            }
+            DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(const metadata::RtGenericInst*, class_inst, decode_generic_inst());
+            if (!class_inst)
+            {
+                RET_ERR(RtErr::BadImageFormat);
+            }
+            const metadata::RtGenericClass* generic_class =
+                metadata::MetadataCache::get_pooled_generic_class(metadata::RtMetadata::encode_gid_by_rid(*mod, rid), class_inst);
+            RET_OK(by_ref ? &generic_class->by_ref_type_sig : &generic_class->by_val_type_sig);
+        }
+        case metadata::RtElementType::Ptr:
+        {
+            DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(const metadata::RtTypeSig*, element_type, decode_typesig());
+            return metadata::MetadataCache::get_pooled_ptr_typesig_by_element_typesig(element_type, by_ref != 0);
+        }
+        case metadata::RtElementType::SZArray:
+        {
+            DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(const metadata::RtTypeSig*, element_type, decode_typesig());
+            return metadata::MetadataCache::get_pooled_szarray_typesig_by_element_typesig(element_type, by_ref != 0);
+        }
+        case metadata::RtElementType::Array:
+        {
+            uint8_t rank;
+            RET_ERR_ON_FAIL(read_u8(rank));
+            DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(const metadata::RtTypeSig*, element_type, decode_typesig());
+            return metadata::MetadataCache::get_pooled_array_typesig_by_element_typesig(element_type, rank, by_ref != 0);
+        }
+        default:
+        {
+            metadata::RtTypeSig typesig = {};
+            typesig.ele_type = ele_type;
+            typesig.by_ref = by_ref != 0;
+            return metadata::MetadataCache::get_pooled_typesig(typesig);
+        }
+        }
+    }
+
+    RtResult<metadata::RtClass*> decode_class()
+    {
+        DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(const metadata::RtTypeSig*, typesig, decode_typesig());
+        return vm::Class::get_class_from_typesig(typesig);
+    }
+
+    RtResult<const metadata::RtMethodInfo*> decode_method()
+    {
+        uint8_t is_generic_method;
+        RET_ERR_ON_FAIL(read_u8(is_generic_method));
+        if (is_generic_method)
+        {
+            DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(metadata::RtModuleDef*, mod, decode_module());
+            uint32_t rid;
+            RET_ERR_ON_FAIL(read_u32(rid));
+            if (rid == 0 || rid > mod->get_method_count())
+            {
+                RET_ERR(RtErr::BadImageFormat);
+            }
+            DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(const metadata::RtMethodInfo*, base_method, mod->get_method_by_rid(rid));
+            DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(const metadata::RtGenericInst*, class_inst, decode_generic_inst());
+            DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(const metadata::RtGenericInst*, method_inst, decode_generic_inst());
+            return vm::GenericMethod::get_method(base_method, class_inst, method_inst);
+        }
+        DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(metadata::RtClass*, klass, decode_class());
+        uint32_t index;
+        RET_ERR_ON_FAIL(read_u32(index));
+        RET_ERR_ON_FAIL(vm::Class::initialize_methods(klass));
+        if (index >= klass->method_count)
+        {
+            RET_ERR(RtErr::BadImageFormat);
+        }
+        RET_OK(klass->methods[index]);
+    }
+
+    RtResult<const metadata::RtFieldInfo*> decode_field()
+    {
+        DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(metadata::RtClass*, klass, decode_class());
+        uint32_t index;
+        RET_ERR_ON_FAIL(read_u32(index));
+        RET_ERR_ON_FAIL(vm::Class::initialize_fields(klass));
+        if (index >= klass->field_count)
+        {
+            RET_ERR(RtErr::BadImageFormat);
+        }
+        RET_OK(klass->fields + index);
+    }
+
+    RtResult<const void*> decode_resolved_data_source(RtResolvedDataKind kind)
+    {
+        switch (kind)
+        {
+        case RtResolvedDataKind::Class:
+        case RtResolvedDataKind::TypeCheckCache:
+        {
+            DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(metadata::RtClass*, klass, decode_class());
+            RET_OK(static_cast<const void*>(klass));
+        }
+        case RtResolvedDataKind::Method:
+        case RtResolvedDataKind::VirtualCallCache:
+        {
+            DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(const metadata::RtMethodInfo*, method, decode_method());
+            RET_OK(static_cast<const void*>(method));
+        }
+        case RtResolvedDataKind::Field:
+        case RtResolvedDataKind::FieldRvaData:
+        {
+            DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(const metadata::RtFieldInfo*, field, decode_field());
+            RET_OK(static_cast<const void*>(field));
+        }
+        case RtResolvedDataKind::TypeSig:
+        {
+            DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(const metadata::RtTypeSig*, typesig, decode_typesig());
+            RET_OK(static_cast<const void*>(typesig));
+        }
+        case RtResolvedDataKind::UserString:
+        {
+            uint32_t index;
+            RET_ERR_ON_FAIL(read_u32(index));
+            DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(vm::RtString*, str, _mod->get_user_string(index));
+            RET_OK(static_cast<const void*>(str));
+        }
+        default:
+            RET_ERR(RtErr::BadImageFormat);
+        }
+    }
+
+    RtResult<const void*> create_resolved_data(alloc::MemPool& pool, RtResolvedDataKind kind, const void* source)
+    {
+        switch (kind)
+        {
+        case RtResolvedDataKind::FieldRvaData:
+        {
+            DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(const uint8_t*, rva_data, vm::Field::get_field_rva_data(static_cast<const metadata::RtFieldInfo*>(source)));
+            RET_OK(static_cast<const void*>(rva_data));
+        }
+        case RtResolvedDataKind::VirtualCallCache:
+        {
+            RtVirtualCallCache* cache = pool.malloc_any_zeroed<RtVirtualCallCache>();
+            cache->virtual_method = static_cast<const metadata::RtMethodInfo*>(source);
+            RET_OK(static_cast<const void*>(cache));
+        }
+        case RtResolvedDataKind::TypeCheckCache:
+        {
+            RtTypeCheckCache* cache = pool.malloc_any_zeroed<RtTypeCheckCache>();
+            InterpDefs::init_type_check_cache(cache, static_cast<metadata::RtClass*>(const_cast<void*>(source)));
+            RET_OK(static_cast<const void*>(cache));
+        }
+        default:
+            RET_OK(source);
+        }
+    }
+};
+
+static IrCacheLoadedModule* load_module_cache(metadata::RtModuleDef* mod)
+{
+    utils::ConstByteSpan data = vm::Settings::get_ir_cache_loader()(mod->get_name_no_ext());
+    utils::BinaryReader reader(data.data(), data.size());
+    IrCacheHeader header;
+    uint8_t mvid[IR_CACHE_MVID_SIZE];
+    if (!reader.try_read_any(header) || header.magic != IR_CACHE_MAGIC || header.version_hash != get_runtime_version_hash() ||
+        !read_module_mvid(mod, mvid) || std::memcmp(header.mvid, mvid, IR_CACHE_MVID_SIZE) != 0)
+    {
+        return nullptr;
+    }
+
+    IrCacheLoadedModule* loaded = new IrCacheLoadedModule();
+    bool valid = true;
+    for (uint32_t i = 0; valid && i < header.assembly_ref_count; ++i)
+    {
+        uint32_t length;
+        const char* name;
+        const uint8_t* ref_mvid;
+        valid = reader.try_read_u32(length) && reader.try_peek_any_ptr_range<char>(length + 1, name) && name[length] == 0 &&
+                reader.try_advance(length + 1) && reader.try_peek_any_ptr_range<uint8_t>(IR_CACHE_MVID_SIZE, ref_mvid) &&
+                reader.try_advance(IR_CACHE_MVID_SIZE);
+        if (!valid)
+        {
+            break;
+        }
+        // a rebuilt dependency may have moved the tokens, field offsets or methods the records refer to
+        auto ret_ass = vm::Assembly::load_by_name(name);
+        valid = ret_ass.is_ok() && read_module_mvid(ret_ass.unwrap()->mod, mvid) && std::memcmp(ref_mvid, mvid, IR_CACHE_MVID_SIZE) == 0;
+        loaded->assembly_refs.push_back(valid ? ret_ass.unwrap()->mod : nullptr);
+    }
+    for (uint32_t i = 0; valid && i < header.method_count; ++i)
+    {
+        IrCacheMethodEntry entry;
+        valid = reader.try_read_any(entry);
+        if (!valid)
+        {
+            break;
+        }
+        loaded->method_offsets.insert({entry.token, entry.offset});
+    }
+    if (!valid)
+    {
+        delete loaded;
+        return nullptr;
+    }
+    loaded->records = reader.get_current_ptr();
+    loaded->records_size = data.size() - reader.get_position();
+    return loaded;
+}
+
+bool IrCache::is_recording()
+{
+    return vm::Settings::get_ir_cache_writer() != nullptr;
+}
+
+void IrCache::record_method(metadata::RtModuleDef* mod, const metadata::RtMethodInfo* method, const RtInterpMethodInfo* imi,
+                            const RtResolvedDataSource* resolved_data_sources, size_t resolved_data_count)
+{
+    if (!is_cacheable_method(mod, method))
+    {
+        return;
+    }
+    IrCacheModuleRecords*& records = s_module_records[mod];
+    if (!records)
+    {
+        records = new IrCacheModuleRecords();
+        records->assembly_refs.push_back(mod);
+    }
+
+    IrCacheWriter writer;
+    IrCacheEncoder encoder(mod, records, writer);
+    if (!encoder.encode_method_info(imi, resolved_data_sources, resolved_data_count))
+    {
+        return;
+    }
+
+    // metadata that does not decode back to the same pointer, e.g. a type handle that is not the canonical typesig of its class,
+    // would silently change behavior, so such methods are left out
+    IrCacheLoadedModule refs;
+    refs.assembly_refs = records->assembly_refs;
+    const utils::Vector<uint8_t>& data = writer.get_data();
+    utils::BinaryReader reader(data.data(), data.size());
+    IrCacheDecoder decoder(mod, &refs, reader);
+    if (!decoder.verify_method_info(imi, resolved_data_sources, resolved_data_count))
+    {
+        return;
+    }
+    records->methods[method->token] = data;
+}
+
+const RtInterpMethodInfo* IrCache::load_method(const metadata::RtMethodInfo* method)
+{
+    metadata::RtModuleDef* mod = method->parent->image;
+    if (is_recording() || !vm::Settings::get_ir_cache_loader() || !is_cacheable_method(mod, method))
+    {
+        return nullptr;
+    }
+    auto loaded_it = s_loaded_modules.find(mod);
+    if (loaded_it == s_loaded_modules.end())
+    {
+        loaded_it = s_loaded_modules.insert({mod, load_module_cache(mod)}).first;
+    }
+    IrCacheLoadedModule* loaded = loaded_it->second;
+    if (!loaded)
+    {
+        return nullptr;
+    }
+    auto it = loaded->method_offsets.find(method->token);
+    if (it == loaded->method_offsets.end() || it->second >= loaded->records_size)
+    {
+        return nullptr;
+    }
+    utils::BinaryReader reader(loaded->records + it->second, loaded->records_size - it->second);
+    IrCacheDecoder decoder(mod, loaded, reader);
+    auto ret = decoder.decode_method_info();
+    return ret.is_ok() ? ret.unwrap() : nullptr;
+}
+
+RtResultVoid IrCache::save()
+{
+    vm::IrCacheWriterFunc write_cache = vm::Settings::get_ir_cache_writer();
+    if (!write_cache)
+    {
+        RET_VOID_OK();
+    }
+    for (const auto& module_records : s_module_records)
+    {
+        metadata::RtModuleDef* mod = module_records.first;
+        const IrCacheModuleRecords* records = module_records.second;
+
+        IrCacheHeader header = {};
+        header.magic = IR_CACHE_MAGIC;
+        header.version_hash = get_runtime_version_hash();
+        if (!read_module_mvid(mod, header.mvid))
+        {
+            RET_ERR(RtErr::BadImageFormat);
+        }
+        header.assembly_ref_count = static_cast<uint32_t>(records->assembly_refs.size());
+        header.method_count = static_cast<uint32_t>(records->methods.size());
+
+        IrCacheWriter writer;
+        writer.write_bytes(&header, sizeof(header));
+        for (size_t i = 0; i < records->assembly_refs.size(); ++i)
+        {
+            const char* name = records->assembly_refs[i]->get_name_no_ext();
+            const uint32_t length = static_cast<uint32_t>(std::strlen(name));
+            writer.write_u32(length);
+            writer.write_bytes(name, length + 1);
+            uint8_t mvid[IR_CACHE_MVID_SIZE];
+            if (!read_module_mvid(records->assembly_refs[i], mvid))
+            {
+                RET_ERR(RtErr::BadImageFormat);
+            }
+            writer.write_bytes(mvid, IR_CACHE_MVID_SIZE);
+        }
+        uint32_t offset = 0;
+        for (const auto& method : records->methods)
+        {
+            IrCacheMethodEntry entry = {method.first, offset};
+            writer.write_bytes(&entry, sizeof(entry));
+            offset += static_cast<uint32_t>(method.second.size());
+        }
+        for (const auto& method : records->methods)
+        {
+            writer.write_bytes(method.second.data(), method.second.size());
+        }
+        const utils::Vector<uint8_t>& data = writer.get_data();
+        write_cache(mod->get_name_no_ext(), data.data(), data.size());
+    }
+    RET_VOID_OK();
+}
+
+} // namespace leanclr::interp
@@ -0,0 +1,21 @@
+#pragma once
+
+#include "interp_defs.h"
+
+namespace leanclr::interp
+{
+// Persistent cache of transformed methods, one per assembly, keyed by the module MVID and a hash of the LL opcode set.
+// While an IR cache writer is set in vm::Settings every transformed method is recorded, with its resolved datas encoded as
+// metadata references, and save() hands the caches to the writer. Otherwise methods are restored from the caches returned
+// by the IR cache loader instead of being transformed.
+class IrCache
+{
+  public:
+    static bool is_recording();
+    static void record_method(metadata::RtModuleDef* mod, const metadata::RtMethodInfo* method, const RtInterpMethodInfo* imi,
+                              const RtResolvedDataSource* resolved_data_sources, size_t resolved_data_count);
+    // Returns nullptr when the method is not cached or the cache of its assembly does not match the loaded assembly or runtime.
+    static const RtInterpMethodInfo* load_method(const metadata::RtMethodInfo* method);
+    static RtResultVoid save();
+};
+} // namespace leanclr::interp
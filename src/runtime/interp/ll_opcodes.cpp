@@ -9,6 +9,716 @@ size_t OpCodes::get_switch_instruction_size(const GeneralInst& inst)
     return sizeof(Switch) + sizeof(int32_t) * (inst.get_switch_targets().count);
 }
 
+const char* OpCodes::s_opnames[static_cast<size_t>(OpCodeEnum::__Count)] = {
+    //{{LOW_LEVEL_OPCODE_NAMES
+    "Illegal",
+    "Nop",
+    "InitLocals1Short",
+    "InitLocals2Short",
+    "InitLocals3Short",
+    "InitLocals4Short",
+    "InitLocals",
+    "InitLocalsShort",
+    "Arglist",
+    "LdLocI1",
+    "LdLocU1",
+    "LdLocI2",
+    "LdLocU2",
+    "LdLocI4",
+    "LdLocI8",
+    "LdLocAny",
+    "LdLocI1Short",
+    "LdLocU1Short",
+    "LdLocI2Short",
+    "LdLocU2Short",
+    "LdLocI4Short",
+    "LdLocI8Short",
+    "LdLocAnyShort",
+    "LdLoca",
+    "LdLocaShort",
+    "StLocI1",
+    "StLocI2",
+    "StLocI4",
+    "StLocI8",
+    "StLocAny",
+    "StLocI1Short",
+    "StLocI2Short",
+    "StLocI4Short",
+    "StLocI8Short",
+    "StLocAnyShort",
+    "LdNull",
+    "LdNullShort",
+    "LdcI4I2",
+    "LdcI4I2Short",
+    "LdcI4I4",
+    "LdcI4I4Short",
+    "LdcI8I2",
+    "LdcI8I2Short",
+    "LdcI8I4",
+    "LdcI8I4Short",
+    "LdcI8I8",
+    "LdcI8I8Short",
+    "LdStr",
+    "LdStrShort",
+    "Br",
+    "BrShort",
+    "BrTrueI4",
+    "BrTrueI4Short",
+    "BrTrueI8",
+    "BrTrueI8Short",
+    "BrFalseI4",
+    "BrFalseI4Short",
+    "BrFalseI8",
+    "BrFalseI8Short",
+    "BeqI4",
+    "BeqI8",
+    "BeqR4",
+    "BeqR8",
+    "BeqI4Short",
+    "BeqI8Short",
+    "BgeI4",
+    "BgeI8",
+    "BgeR4",
+    "BgeR8",
+    "BgeI4Short",
+    "BgeI8Short",
+    "BgtI4",
+    "BgtI8",
+    "BgtR4",
+    "BgtR8",
+    "BgtI4Short",
+    "BgtI8Short",
+    "BleI4",
+    "BleI8",
+    "BleR4",
+    "BleR8",
+    "BleI4Short",
+    "BleI8Short",
+    "BltI4",
+    "BltI8",
+    "BltR4",
+    "BltR8",
+    "BltI4Short",
+    "BltI8Short",
+    "BneUnI4",
+    "BneUnI8",
+    "BneUnR4",
+    "BneUnR8",
+    "BneUnI4Short",
+    "BneUnI8Short",
+    "BgeUnI4",
+    "BgeUnI8",
+    "BgeUnR4",
+    "BgeUnR8",
+    "BgeUnI4Short",
+    "BgeUnI8Short",
+    "BgtUnI4",
+    "BgtUnI8",
+    "BgtUnR4",
+    "BgtUnR8",
+    "BgtUnI4Short",
+    "BgtUnI8Short",
+    "BleUnI4",
+    "BleUnI8",
+    "BleUnR4",
+    "BleUnR8",
+    "BleUnI4Short",
+    "BleUnI8Short",
+    "BltUnI4",
+    "BltUnI8",
+    "BltUnR4",
+    "BltUnR8",
+    "BltUnI4Short",
+    "BltUnI8Short",
+    "Switch",
+    "LdIndI1",
+    "LdIndI1Short",
+    "LdIndU1",
+    "LdIndU1Short",
+    "LdIndI2",
+    "LdIndI2Short",
+    "LdIndI2Unaligned",
+    "LdIndU2",
+    "LdIndU2Short",
+    "LdIndU2Unaligned",
+    "LdIndI4",
+    "LdIndI4Short",
+    "LdIndI4Unaligned",
+    "LdIndI8",
+    "LdIndI8Short",
+    "LdIndI8Unaligned",
+    "StIndI1",
+    "StIndI1Short",
+    "StIndI2",
+    "StIndI2Short",
+    "StIndI2Unaligned",
+    "StIndI4",
+    "StIndI4Short",
+    "StIndI4Unaligned",
+    "StIndI8",
+    "StIndI8Short",
+    "StIndI8Unaligned",
+    "StIndI8I4",
+    "StIndI8I4Short",
+    "StIndI8I4Unaligned",
+    "StIndI8U4",
+    "StIndI8U4Short",
+    "StIndI8U4Unaligned",
+    "AddI4",
+    "AddI8",
+    "AddR4",
+    "AddR8",
+    "AddI4Short",
+    "AddI8Short",
+    "AddR4Short",
+    "AddR8Short",
+    "SubI4",
+    "SubI8",
+    "SubR4",
+    "SubR8",
+    "SubI4Short",
+    "SubI8Short",
+    "SubR4Short",
+    "SubR8Short",
+    "MulI4",
+    "MulI8",
+    "MulR4",
+    "MulR8",
+    "MulI4Short",
+    "MulI8Short",
+    "MulR4Short",
+    "MulR8Short",
+    "DivI4",
+    "DivI8",
+    "DivR4",
+    "DivR8",
+    "DivI4Short",
+    "DivI8Short",
+    "DivR4Short",
+    "DivR8Short",
+    "DivUnI4",
+    "DivUnI8",
+    "DivUnI4Short",
+    "DivUnI8Short",
+    "RemI4",
+    "RemI8",
+    "RemR4",
+    "RemR8",
+    "RemI4Short",
+    "RemI8Short",
+    "RemR4Short",
+    "RemR8Short",
+    "RemUnI4",
+    "RemUnI8",
+    "RemUnI4Short",
+    "RemUnI8Short",
+    "AndI4",
+    "AndI8",
+    "AndI4Short",
+    "AndI8Short",
+    "OrI4",
+    "OrI8",
+    "OrI4Short",
+    "OrI8Short",
+    "XorI4",
+    "XorI8",
+    "XorI4Short",
+    "XorI8Short",
+    "ShlI4",
+    "ShlI8",
+    "ShlI4Short",
+    "ShrI4",
+    "ShrI8",
+    "ShrI4Short",
+    "ShrUnI4",
+    "ShrUnI8",
+    "ShrUnI4Short",
+    "NegI4",
+    "NegI8",
+    "NegR4",
+    "NegR8",
+    "NegI4Short",
+    "NegI8Short",
+    "NegR4Short",
+    "NegR8Short",
+    "NotI4",
+    "NotI8",
+    "NotI4Short",
+    "NotI8Short",
+    "AddOvfI4",
+    "AddOvfI8",
+    "AddOvfUnI4",
+    "AddOvfUnI8",
+    "MulOvfI4",
+    "MulOvfI8",
+    "MulOvfUnI4",
+    "MulOvfUnI8",
+    "SubOvfI4",
+    "SubOvfI8",
+    "SubOvfUnI4",
+    "SubOvfUnI8",
+    "ConvI1I4",
+    "ConvI1I8",
+    "ConvI1R4",
+    "ConvI1R8",
+    "ConvI1I4Short",
+    "ConvI1I8Short",
+    "ConvI1R4Short",
+    "ConvI1R8Short",
+    "ConvU1I4",
+    "ConvU1I8",
+    "ConvU1R4",
+    "ConvU1R8",
+    "ConvU1I4Short",
+    "ConvU1I8Short",
+    "ConvU1R4Short",
+    "ConvU1R8Short",
+    "ConvI2I4",
+    "ConvI2I8",
+    "ConvI2R4",
+    "ConvI2R8",
+    "ConvI2I4Short",
+    "ConvI2I8Short",
+    "ConvI2R4Short",
+    "ConvI2R8Short",
+    "ConvU2I4",
+    "ConvU2I8",
+    "ConvU2R4",
+    "ConvU2R8",
+    "ConvU2I4Short",
+    "ConvU2I8Short",
+    "ConvU2R4Short",
+    "ConvU2R8Short",
+    "ConvI4I8",
+    "ConvI4R4",
+    "ConvI4R8",
+    "ConvI4I8Short",
+    "ConvI4R4Short",
+    "ConvI4R8Short",
+    "ConvU4I8",
+    "ConvU4R4",
+    "ConvU4R8",
+    "ConvU4I8Short",
+    "ConvU4R4Short",
+    "ConvU4R8Short",
+    "ConvI8I4",
+    "ConvI8U4",
+    "ConvI8R4",
+    "ConvI8R8",
+    "ConvI8I4Short",
+    "ConvI8R4Short",
+    "ConvI8R8Short",
+    "ConvU8I4",
+    "ConvU8R4",
+    "ConvU8R8",
+    "ConvR4I4",
+    "ConvR4I8",
+    "ConvR4R8",
+    "ConvR4I4Short",
+    "ConvR4I8Short",
+    "ConvR4R8Short",
+    "ConvR8I4",
+    "ConvR8I8",
+    "ConvR8R4",
+    "ConvR8I4Short",
+    "ConvR8I8Short",
+    "ConvR8R4Short",
+    "ConvOvfI1I4",
+    "ConvOvfI1I8",
+    "ConvOvfI1R4",
+    "ConvOvfI1R8",
+    "ConvOvfU1I4",
+    "ConvOvfU1I8",
+    "ConvOvfU1R4",
+    "ConvOvfU1R8",
+    "ConvOvfI2I4",
+    "ConvOvfI2I8",
+    "ConvOvfI2R4",
+    "ConvOvfI2R8",
+    "ConvOvfU2I4",
+    "ConvOvfU2I8",
+    "ConvOvfU2R4",
+    "ConvOvfU2R8",
+    "ConvOvfI4I8",
+    "ConvOvfI4R4",
+    "ConvOvfI4R8",
+    "ConvOvfU4I4",
+    "ConvOvfU4I8",
+    "ConvOvfU4R4",
+    "ConvOvfU4R8",
+    "ConvOvfI8R4",
+    "ConvOvfI8R8",
+    "ConvOvfU8I4",
+    "ConvOvfU8I8",
+    "ConvOvfU8R4",
+    "ConvOvfU8R8",
+    "ConvOvfI1UnI4",
+    "ConvOvfI1UnI8",
+    "ConvOvfI1UnR4",
+    "ConvOvfI1UnR8",
+    "ConvOvfU1UnI4",
+    "ConvOvfU1UnI8",
+    "ConvOvfU1UnR4",
+    "ConvOvfU1UnR8",
+    "ConvOvfI2UnI4",
+    "ConvOvfI2UnI8",
+    "ConvOvfI2UnR4",
+    "ConvOvfI2UnR8",
+    "ConvOvfU2UnI4",
+    "ConvOvfU2UnI8",
+    "ConvOvfU2UnR4",
+    "ConvOvfU2UnR8",
+    "ConvOvfI4UnI4",
+    "ConvOvfI4UnI8",
+    "ConvOvfI4UnR4",
+    "ConvOvfI4UnR8",
+    "ConvOvfU4UnI8",
+    "ConvOvfU4UnR4",
+    "ConvOvfU4UnR8",
+    "ConvOvfI8UnI8",
+    "ConvOvfI8UnR4",
+    "ConvOvfI8UnR8",
+    "ConvOvfU8UnR4",
+    "ConvOvfU8UnR8",
+    "CeqI4",
+    "CeqI8",
+    "CeqR4",
+    "CeqR8",
+    "CeqI4Short",
+    "CeqI8Short",
+    "CeqR4Short",
+    "CeqR8Short",
+    "CgtI4",
+    "CgtI8",
+    "CgtR4",
+    "CgtR8",
+    "CgtI4Short",
+    "CgtI8Short",
+    "CgtUnI4",
+    "CgtUnI8",
+    "CgtUnR4",
+    "CgtUnR8",
+    "CgtUnI4Short",
+    "CgtUnI8Short",
+    "CltI4",
+    "CltI8",
+    "CltR4",
+    "CltR8",
+    "CltI4Short",
+    "CltI8Short",
+    "CltUnI4",
+    "CltUnI8",
+    "CltUnR4",
+    "CltUnR8",
+    "CltUnI4Short",
+    "CltUnI8Short",
+    "InitObjI1",
+    "InitObjI1Short",
+    "InitObjI2",
+    "InitObjI2Short",
+    "InitObjI2Unaligned",
+    "InitObjI4",
+    "InitObjI4Short",
+    "InitObjI4Unaligned",
+    "InitObjI8",
+    "InitObjI8Short",
+    "InitObjI8Unaligned",
+    "InitObjAny",
+    "InitObjAnyShort",
+    "CpObjI1",
+    "CpObjI1Short",
+    "CpObjI2",
+    "CpObjI2Short",
+    "CpObjI4",
+    "CpObjI4Short",
+    "CpObjI8",
+    "CpObjI8Short",
+    "CpObjAny",
+    "CpObjAnyShort",
+    "LdObjAny",
+    "LdObjAnyShort",
+    "StObjAny",
+    "StObjAnyShort",
+    "CastClass",
+    "CastClassShort",
+    "IsInst",
+    "IsInstShort",
+    "Box",
+    "BoxShort",
+    "Unbox",
+    "UnboxShort",
+    "UnboxAny",
+    "UnboxAnyShort",
+    "NewArr",
+    "NewArrShort",
+    "LdLen",
+    "LdLenShort",
+    "Ldelema",
+    "LdelemaShort",
+    "LdelemaReadOnly",
+    "LdelemI1",
+    "LdelemI1Short",
+    "LdelemU1",
+    "LdelemU1Short",
+    "LdelemI2",
+    "LdelemI2Short",
+    "LdelemU2",
+    "LdelemU2Short",
+    "LdelemI4",
+    "LdelemI4Short",
+    "LdelemI8",
+    "LdelemI8Short",
+    "LdelemI",
+    "LdelemIShort",
+    "LdelemR4",
+    "LdelemR4Short",
+    "LdelemR8",
+    "LdelemR8Short",
+    "LdelemRef",
+    "LdelemRefShort",
+    "LdelemAnyRef",
+    "LdelemAnyRefShort",
+    "LdelemAnyVal",
+    "LdelemAnyValShort",
+    "StelemI1",
+    "StelemI1Short",
+    "StelemI2",
+    "StelemI2Short",
+    "StelemI4",
+    "StelemI4Short",
+    "StelemI8",
+    "StelemI8Short",
+    "StelemI",
+    "StelemIShort",
+    "StelemR4",
+    "StelemR4Short",
+    "StelemR8",
+    "StelemR8Short",
+    "StelemRef",
+    "StelemRefShort",
+    "StelemAnyRef",
+    "StelemAnyRefShort",
+    "StelemAnyVal",
+    "StelemAnyValShort",
+    "MkRefAny",
+    "RefAnyVal",
+    "RefAnyType",
+    "LdToken",
+    "CkfiniteR4",
+    "CkfiniteR8",
+    "LocAlloc",
+    "InitBlk",
+    "CpBlk",
+    "Ldftn",
+    "LdftnShort",
+    "Ldvirtftn",
+    "LdvirtftnShort",
+    "LdfldI1",
+    "LdfldI1Short",
+    "LdfldI1Large",
+    "LdfldU1",
+    "LdfldU1Short",
+    "LdfldU1Large",
+    "LdfldI2",
+    "LdfldI2Short",
+    "LdfldI2Large",
+    "LdfldI2Unaligned",
+    "LdfldU2",
+    "LdfldU2Short",
+    "LdfldU2Large",
+    "LdfldU2Unaligned",
+    "LdfldI4",
+    "LdfldI4Short",
+    "LdfldI4Large",
+    "LdfldI4Unaligned",
+    "LdfldI8",
+    "LdfldI8Short",
+    "LdfldI8Large",
+    "LdfldI8Unaligned",
+    "LdfldAny",
+    "LdfldAnyShort",
+    "LdfldAnyLarge",
+    "LdvfldI1",
+    "LdvfldI1Short",
+    "LdvfldI1Large",
+    "LdvfldU1",
+    "LdvfldU1Short",
+    "LdvfldU1Large",
+    "LdvfldI2",
+    "LdvfldI2Short",
+    "LdvfldI2Large",
+    "LdvfldI2Unaligned",
+    "LdvfldU2",
+    "LdvfldU2Short",
+    "LdvfldU2Large",
+    "LdvfldU2Unaligned",
+    "LdvfldI4",
+    "LdvfldI4Short",
+    "LdvfldI4Large",
+    "LdvfldI4Unaligned",
+    "LdvfldI8",
+    "LdvfldI8Short",
+    "LdvfldI8Large",
+    "LdvfldI8Unaligned",
+    "LdvfldAny",
+    "LdvfldAnyShort",
+    "LdvfldAnyLarge",
+    "Ldflda",
+    "LdfldaShort",
+    "LdfldaLarge",
+    "StfldI1",
+    "StfldI1Short",
+    "StfldI1Large",
+    "StfldI2",
+    "StfldI2Short",
+    "StfldI2Large",
+    "StfldI2Unaligned",
+    "StfldI4",
+    "StfldI4Short",
+    "StfldI4Large",
+    "StfldI4Unaligned",
+    "StfldI8",
+    "StfldI8Short",
+    "StfldI8Large",
+    "StfldI8Unaligned",
+    "StfldAny",
+    "StfldAnyShort",
+    "StfldAnyLarge",
+    "LdsfldI1",
+    "LdsfldI1Short",
+    "LdsfldU1",
+    "LdsfldU1Short",
+    "LdsfldI2",
+    "LdsfldI2Short",
+    "LdsfldU2",
+    "LdsfldU2Short",
+    "LdsfldI4",
+    "LdsfldI4Short",
+    "LdsfldI8",
+    "LdsfldI8Short",
+    "LdsfldAny",
+    "LdsfldAnyShort",
+    "Ldsflda",
+    "LdsfldaShort",
+    "LdsfldRvaData",
+    "LdsfldRvaDataShort",
+    "StsfldI1",
+    "StsfldI1Short",
+    "StsfldI2",
+    "StsfldI2Short",
+    "StsfldI4",
+    "StsfldI4Short",
+    "StsfldI8",
+    "StsfldI8Short",
+    "StsfldAny",
+    "StsfldAnyShort",
+    "RetVoid",
+    "RetVoidShort",
+    "RetI4",
+    "RetI8",
+    "RetAny",
+    "RetI4Short",
+    "RetI8Short",
+    "RetAnyShort",
+    "RetNopShort",
+    "CallInterp",
+    "CallInterpShort",
+    "CallVirtInterp",
+    "CallVirtInterpShort",
+    "CallInternalCall",
+    "CallInternalCallShort",
+    "CallIntrinsic",
+    "CallIntrinsicShort",
+    "CallPInvoke",
+    "CallPInvokeShort",
+    "CallRuntimeImplemented",
+    "CallRuntimeImplementedShort",
+    "CalliInterp",
+    "CalliInterpShort",
+    "BoxRefInplace",
+    "BoxRefInplaceShort",
+    "NewObjInterp",
+    "NewObjInterpShort",
+    "NewValueTypeInterp",
+    "NewValueTypeInterpShort",
+    "NewObjInternalCall",
+    "NewObjInternalCallShort",
+    "NewObjIntrinsic",
+    "NewObjIntrinsicShort",
+    "Throw",
+    "ThrowShort",
+    "Rethrow",
+    "RethrowShort",
+    "LeaveTryWithFinally",
+    "LeaveTryWithFinallyShort",
+    "LeaveCatchWithFinally",
+    "LeaveCatchWithFinallyShort",
+    "LeaveCatchWithoutFinally",
+    "LeaveCatchWithoutFinallyShort",
+    "EndFilter",
+    "EndFilterShort",
+    "EndFinally",
+    "EndFinallyShort",
+    "EndFault",
+    "EndFaultShort",
+    "CheckNull",
+    "CheckNullShort",
+    "GetEnumLongHashCode",
+    "LdsfldU1NoCctor",
+    "LdsfldU1NoCctorShort",
+    "LdsfldI4NoCctor",
+    "LdsfldI4NoCctorShort",
+    "LdsfldI8NoCctor",
+    "LdsfldI8NoCctorShort",
+    "LdsfldaNoCctor",
+    "LdsfldaNoCctorShort",
+    "StsfldI4NoCctor",
+    "StsfldI4NoCctorShort",
+    "StsfldI8NoCctor",
+    "StsfldI8NoCctorShort",
+    "CallInterpNoCctor",
+    "CallInterpNoCctorShort",
+    "CountBackEdge",
+    "LdelemaUnchecked",
+    "LdelemaReadOnlyUnchecked",
+    "LdelemI1Unchecked",
+    "LdelemU1Unchecked",
+    "LdelemI2Unchecked",
+    "LdelemU2Unchecked",
+    "LdelemI4Unchecked",
+    "LdelemI4UncheckedShort",
+    "LdelemI8Unchecked",
+    "LdelemIUnchecked",
+    "LdelemR4Unchecked",
+    "LdelemR4UncheckedShort",
+    "LdelemR8Unchecked",
+    "LdelemR8UncheckedShort",
+    "LdelemRefUnchecked",
+    "StelemI1Unchecked",
+    "StelemI2Unchecked",
+    "StelemI4Unchecked",
+    "StelemI4UncheckedShort",
+    "StelemI8Unchecked",
+    "StelemIUnchecked",
+    "StelemR4Unchecked",
+    "StelemR4UncheckedShort",
+    "StelemR8Unchecked",
+    "StelemR8UncheckedShort",
+    "InvokeDelegate",
+    "StfldRef",
+    "StfldRefShort",
+    "StfldRefLarge",
+    "StfldAnyRef",
+    "StfldAnyRefLarge",
+    "StIndRef",
+    "StIndRefShort",
+    "CpObjRef",
+    "CpObjAnyRef",
+    "StObjAnyRef",
+
+    //}}LOW_LEVEL_OPCODE_NAMES
+};
+
 size_t OpCodes::s_opsizes[static_cast<size_t>(OpCodeEnum::__Count)] = {
     //{{LOW_LEVEL_INSTRUCTION_SIZES
     sizeof(Illegal),
@@ -661,7 +1371,60 @@ size_t OpCodes::s_opsizes[static_cast<size_t>(OpCodeEnum::__Count)] = {
     sizeof(EndFinallyShort),
     sizeof(EndFault),
     sizeof(EndFaultShort),
+    sizeof(CheckNull),
+    sizeof(CheckNullShort),
     sizeof(GetEnumLongHashCode),
+    sizeof(LdsfldU1NoCctor),
+    sizeof(LdsfldU1NoCctorShort),
+    sizeof(LdsfldI4NoCctor),
+    sizeof(LdsfldI4NoCctorShort),
+    sizeof(LdsfldI8NoCctor),
+    sizeof(LdsfldI8NoCctorShort),
+    sizeof(LdsfldaNoCctor),
+    sizeof(LdsfldaNoCctorShort),
+    sizeof(StsfldI4NoCctor),
+    sizeof(StsfldI4NoCctorShort),
+    sizeof(StsfldI8NoCctor),
+    sizeof(StsfldI8NoCctorShort),
+    sizeof(CallInterpNoCctor),
+    sizeof(CallInterpNoCctorShort),
+    sizeof(CountBackEdge),
+    sizeof(LdelemaUnchecked),
+    sizeof(LdelemaReadOnlyUnchecked),
+    sizeof(LdelemI1Unchecked),
+    sizeof(LdelemU1Unchecked),
+    sizeof(LdelemI2Unchecked),
+    sizeof(LdelemU2Unchecked),
+    sizeof(LdelemI4Unchecked),
+    sizeof(LdelemI4UncheckedShort),
+    sizeof(LdelemI8Unchecked),
+    sizeof(LdelemIUnchecked),
+    sizeof(LdelemR4Unchecked),
+    sizeof(LdelemR4UncheckedShort),
+    sizeof(LdelemR8Unchecked),
+    sizeof(LdelemR8UncheckedShort),
+    sizeof(LdelemRefUnchecked),
+    sizeof(StelemI1Unchecked),
+    sizeof(StelemI2Unchecked),
+    sizeof(StelemI4Unchecked),
+    sizeof(StelemI4UncheckedShort),
+    sizeof(StelemI8Unchecked),
+    sizeof(StelemIUnchecked),
+    sizeof(StelemR4Unchecked),
+    sizeof(StelemR4UncheckedShort),
+    sizeof(StelemR8Unchecked),
+    sizeof(StelemR8UncheckedShort),
+    sizeof(InvokeDelegate),
+    sizeof(StfldRef),
+    sizeof(StfldRefShort),
+    sizeof(StfldRefLarge),
+    sizeof(StfldAnyRef),
+    sizeof(StfldAnyRefLarge),
+    sizeof(StIndRef),
+    sizeof(StIndRefShort),
+    sizeof(CpObjRef),
+    sizeof(CpObjAnyRef),
+    sizeof(StObjAnyRef),
 
     //}}LOW_LEVEL_INSTRUCTION_SIZESS
 };
@@ -6600,6 +7363,21 @@ uint8_t* OpCodes::write_instruction_to_data(uint8_t* codes, const GeneralInst& i
         ir->__code = 234;
         return codes + sizeof(EndFaultShort);
     }
+    case OpCodeEnum::CheckNull:
+    {
+        auto ir = (CheckNull*)codes;
+        ir->__prefix = 251;
+        ir->__code = 250;
+        ir->obj = (uint16_t)inst.get_var_src_eval_stack_idx();
+        return codes + sizeof(CheckNull);
+    }
+    case OpCodeEnum::CheckNullShort:
+    {
+        auto ir = (CheckNullShort*)codes;
+        ir->__code = 235;
+        ir->obj = (uint8_t)inst.get_var_src_eval_stack_idx();
+        return codes + sizeof(CheckNullShort);
+    }
     case OpCodeEnum::GetEnumLongHashCode:
     {
         auto ir = (GetEnumLongHashCode*)codes;
@@ -6609,12 +7387,1988 @@ uint8_t* OpCodes::write_instruction_to_data(uint8_t* codes, const GeneralInst& i
         ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
         return codes + sizeof(GetEnumLongHashCode);
     }
-
-    //}}LOW_LEVEL_INSTRUCTION_WRITE_TO_DATA_DATA
-    default:
-        assert(false && "Unhandled opcode in write_instruction_to_data");
-        return nullptr;
+    case OpCodeEnum::LdsfldU1NoCctor:
+    {
+        auto ir = (LdsfldU1NoCctor*)codes;
+        ir->__prefix = 252;
+        ir->__code = 51;
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        ir->field_idx = (uint16_t)inst.get_resolved_data_index();
+        return codes + sizeof(LdsfldU1NoCctor);
+    }
+    case OpCodeEnum::LdsfldU1NoCctorShort:
+    {
+        auto ir = (LdsfldU1NoCctorShort*)codes;
+        ir->__code = 236;
+        ir->dst = (uint8_t)inst.get_var_dst_eval_stack_idx();
+        ir->field_idx = (uint8_t)inst.get_resolved_data_index();
+        return codes + sizeof(LdsfldU1NoCctorShort);
+    }
+    case OpCodeEnum::LdsfldI4NoCctor:
+    {
+        auto ir = (LdsfldI4NoCctor*)codes;
+        ir->__prefix = 252;
+        ir->__code = 52;
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        ir->field_idx = (uint16_t)inst.get_resolved_data_index();
+        return codes + sizeof(LdsfldI4NoCctor);
+    }
+    case OpCodeEnum::LdsfldI4NoCctorShort:
+    {
+        auto ir = (LdsfldI4NoCctorShort*)codes;
+        ir->__code = 237;
+        ir->dst = (uint8_t)inst.get_var_dst_eval_stack_idx();
+        ir->field_idx = (uint8_t)inst.get_resolved_data_index();
+        return codes + sizeof(LdsfldI4NoCctorShort);
+    }
+    case OpCodeEnum::LdsfldI8NoCctor:
+    {
+        auto ir = (LdsfldI8NoCctor*)codes;
+        ir->__prefix = 252;
+        ir->__code = 53;
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        ir->field_idx = (uint16_t)inst.get_resolved_data_index();
+        return codes + sizeof(LdsfldI8NoCctor);
+    }
+    case OpCodeEnum::LdsfldI8NoCctorShort:
+    {
+        auto ir = (LdsfldI8NoCctorShort*)codes;
+        ir->__code = 238;
+        ir->dst = (uint8_t)inst.get_var_dst_eval_stack_idx();
+        ir->field_idx = (uint8_t)inst.get_resolved_data_index();
+        return codes + sizeof(LdsfldI8NoCctorShort);
+    }
+    case OpCodeEnum::LdsfldaNoCctor:
+    {
+        auto ir = (LdsfldaNoCctor*)codes;
+        ir->__prefix = 252;
+        ir->__code = 54;
+        ir->field_idx = (uint16_t)inst.get_resolved_data_index();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(LdsfldaNoCctor);
+    }
+    case OpCodeEnum::LdsfldaNoCctorShort:
+    {
+        auto ir = (LdsfldaNoCctorShort*)codes;
+        ir->__code = 239;
+        ir->field_idx = (uint8_t)inst.get_resolved_data_index();
+        ir->dst = (uint8_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(LdsfldaNoCctorShort);
+    }
+    case OpCodeEnum::StsfldI4NoCctor:
+    {
+        auto ir = (StsfldI4NoCctor*)codes;
+        ir->__prefix = 252;
+        ir->__code = 55;
+        ir->field_idx = (uint16_t)inst.get_resolved_data_index();
+        ir->value = (uint16_t)inst.get_var_arg1_eval_stack_idx();
+        return codes + sizeof(StsfldI4NoCctor);
+    }
+    case OpCodeEnum::StsfldI4NoCctorShort:
+    {
+        auto ir = (StsfldI4NoCctorShort*)codes;
+        ir->__code = 240;
+        ir->field_idx = (uint8_t)inst.get_resolved_data_index();
+        ir->value = (uint8_t)inst.get_var_arg1_eval_stack_idx();
+        return codes + sizeof(StsfldI4NoCctorShort);
+    }
+    case OpCodeEnum::StsfldI8NoCctor:
+    {
+        auto ir = (StsfldI8NoCctor*)codes;
+        ir->__prefix = 252;
+        ir->__code = 56;
+        ir->field_idx = (uint16_t)inst.get_resolved_data_index();
+        ir->value = (uint16_t)inst.get_var_arg1_eval_stack_idx();
+        return codes + sizeof(StsfldI8NoCctor);
+    }
+    case OpCodeEnum::StsfldI8NoCctorShort:
+    {
+        auto ir = (StsfldI8NoCctorShort*)codes;
+        ir->__code = 241;
+        ir->field_idx = (uint8_t)inst.get_resolved_data_index();
+        ir->value = (uint8_t)inst.get_var_arg1_eval_stack_idx();
+        return codes + sizeof(StsfldI8NoCctorShort);
+    }
+    case OpCodeEnum::CallInterpNoCctor:
+    {
+        auto ir = (CallInterpNoCctor*)codes;
+        ir->__prefix = 252;
+        ir->__code = 57;
+        ir->method_idx = (uint16_t)inst.get_resolved_data_index();
+        ir->frame_base = (uint16_t)inst.get_frame_base();
+        return codes + sizeof(CallInterpNoCctor);
+    }
+    case OpCodeEnum::CallInterpNoCctorShort:
+    {
+        auto ir = (CallInterpNoCctorShort*)codes;
+        ir->__code = 242;
+        ir->method_idx = (uint8_t)inst.get_resolved_data_index();
+        ir->frame_base = (uint8_t)inst.get_frame_base();
+        return codes + sizeof(CallInterpNoCctorShort);
+    }
+    case OpCodeEnum::CountBackEdge:
+    {
+        auto ir = (CountBackEdge*)codes;
+        ir->__prefix = 252;
+        ir->__code = 58;
+        return codes + sizeof(CountBackEdge);
+    }
+    case OpCodeEnum::LdelemaUnchecked:
+    {
+        auto ir = (LdelemaUnchecked*)codes;
+        ir->__prefix = 252;
+        ir->__code = 59;
+        ir->arr = (uint16_t)inst.get_var_arg1_eval_stack_idx();
+        ir->index = (uint16_t)inst.get_var_arg2_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        ir->ele_klass_idx = (uint16_t)inst.get_resolved_data_index();
+        return codes + sizeof(LdelemaUnchecked);
+    }
+    case OpCodeEnum::LdelemaReadOnlyUnchecked:
+    {
+        auto ir = (LdelemaReadOnlyUnchecked*)codes;
+        ir->__prefix = 252;
+        ir->__code = 60;
+        ir->arr = (uint16_t)inst.get_var_arg1_eval_stack_idx();
+        ir->index = (uint16_t)inst.get_var_arg2_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(LdelemaReadOnlyUnchecked);
+    }
+    case OpCodeEnum::LdelemI1Unchecked:
+    {
+        auto ir = (LdelemI1Unchecked*)codes;
+        ir->__prefix = 252;
+        ir->__code = 61;
+        ir->arr = (uint16_t)inst.get_var_arg1_eval_stack_idx();
+        ir->index = (uint16_t)inst.get_var_arg2_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(LdelemI1Unchecked);
+    }
+    case OpCodeEnum::LdelemU1Unchecked:
+    {
+        auto ir = (LdelemU1Unchecked*)codes;
+        ir->__prefix = 252;
+        ir->__code = 62;
+        ir->arr = (uint16_t)inst.get_var_arg1_eval_stack_idx();
+        ir->index = (uint16_t)inst.get_var_arg2_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(LdelemU1Unchecked);
+    }
+    case OpCodeEnum::LdelemI2Unchecked:
+    {
+        auto ir = (LdelemI2Unchecked*)codes;
+        ir->__prefix = 252;
+        ir->__code = 63;
+        ir->arr = (uint16_t)inst.get_var_arg1_eval_stack_idx();
+        ir->index = (uint16_t)inst.get_var_arg2_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(LdelemI2Unchecked);
+    }
+    case OpCodeEnum::LdelemU2Unchecked:
+    {
+        auto ir = (LdelemU2Unchecked*)codes;
+        ir->__prefix = 252;
+        ir->__code = 64;
+        ir->arr = (uint16_t)inst.get_var_arg1_eval_stack_idx();
+        ir->index = (uint16_t)inst.get_var_arg2_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(LdelemU2Unchecked);
+    }
+    case OpCodeEnum::LdelemI4Unchecked:
+    {
+        auto ir = (LdelemI4Unchecked*)codes;
+        ir->__prefix = 252;
+        ir->__code = 65;
+        ir->arr = (uint16_t)inst.get_var_arg1_eval_stack_idx();
+        ir->index = (uint16_t)inst.get_var_arg2_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(LdelemI4Unchecked);
+    }
+    case OpCodeEnum::LdelemI4UncheckedShort:
+    {
+        auto ir = (LdelemI4UncheckedShort*)codes;
+        ir->__code = 243;
+        ir->arr = (uint8_t)inst.get_var_arg1_eval_stack_idx();
+        ir->index = (uint8_t)inst.get_var_arg2_eval_stack_idx();
+        ir->dst = (uint8_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(LdelemI4UncheckedShort);
+    }
+    case OpCodeEnum::LdelemI8Unchecked:
+    {
+        auto ir = (LdelemI8Unchecked*)codes;
+        ir->__prefix = 252;
+        ir->__code = 66;
+        ir->arr = (uint16_t)inst.get_var_arg1_eval_stack_idx();
+        ir->index = (uint16_t)inst.get_var_arg2_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(LdelemI8Unchecked);
+    }
+    case OpCodeEnum::LdelemIUnchecked:
+    {
+        auto ir = (LdelemIUnchecked*)codes;
+        ir->__prefix = 252;
+        ir->__code = 67;
+        ir->arr = (uint16_t)inst.get_var_arg1_eval_stack_idx();
+        ir->index = (uint16_t)inst.get_var_arg2_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(LdelemIUnchecked);
+    }
+    case OpCodeEnum::LdelemR4Unchecked:
+    {
+        auto ir = (LdelemR4Unchecked*)codes;
+        ir->__prefix = 252;
+        ir->__code = 68;
+        ir->arr = (uint16_t)inst.get_var_arg1_eval_stack_idx();
+        ir->index = (uint16_t)inst.get_var_arg2_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(LdelemR4Unchecked);
+    }
+    case OpCodeEnum::LdelemR4UncheckedShort:
+    {
+        auto ir = (LdelemR4UncheckedShort*)codes;
+        ir->__code = 244;
+        ir->arr = (uint8_t)inst.get_var_arg1_eval_stack_idx();
+        ir->index = (uint8_t)inst.get_var_arg2_eval_stack_idx();
+        ir->dst = (uint8_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(LdelemR4UncheckedShort);
+    }
+    case OpCodeEnum::LdelemR8Unchecked:
+    {
+        auto ir = (LdelemR8Unchecked*)codes;
+        ir->__prefix = 252;
+        ir->__code = 69;
+        ir->arr = (uint16_t)inst.get_var_arg1_eval_stack_idx();
+        ir->index = (uint16_t)inst.get_var_arg2_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(LdelemR8Unchecked);
+    }
+    case OpCodeEnum::LdelemR8UncheckedShort:
+    {
+        auto ir = (LdelemR8UncheckedShort*)codes;
+        ir->__code = 245;
+        ir->arr = (uint8_t)inst.get_var_arg1_eval_stack_idx();
+        ir->index = (uint8_t)inst.get_var_arg2_eval_stack_idx();
+        ir->dst = (uint8_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(LdelemR8UncheckedShort);
+    }
+    case OpCodeEnum::LdelemRefUnchecked:
+    {
+        auto ir = (LdelemRefUnchecked*)codes;
+        ir->__prefix = 252;
+        ir->__code = 70;
+        ir->arr = (uint16_t)inst.get_var_arg1_eval_stack_idx();
+        ir->index = (uint16_t)inst.get_var_arg2_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(LdelemRefUnchecked);
+    }
+    case OpCodeEnum::StelemI1Unchecked:
+    {
+        auto ir = (StelemI1Unchecked*)codes;
+        ir->__prefix = 252;
+        ir->__code = 71;
+        ir->arr = (uint16_t)inst.get_var_arg1_eval_stack_idx();
+        ir->index = (uint16_t)inst.get_var_arg2_eval_stack_idx();
+        ir->value = (uint16_t)inst.get_var_arg3_eval_stack_idx();
+        return codes + sizeof(StelemI1Unchecked);
+    }
+    case OpCodeEnum::StelemI2Unchecked:
+    {
+        auto ir = (StelemI2Unchecked*)codes;
+        ir->__prefix = 252;
+        ir->__code = 72;
+        ir->arr = (uint16_t)inst.get_var_arg1_eval_stack_idx();
+        ir->index = (uint16_t)inst.get_var_arg2_eval_stack_idx();
+        ir->value = (uint16_t)inst.get_var_arg3_eval_stack_idx();
+        return codes + sizeof(StelemI2Unchecked);
+    }
+    case OpCodeEnum::StelemI4Unchecked:
+    {
+        auto ir = (StelemI4Unchecked*)codes;
+        ir->__prefix = 252;
+        ir->__code = 73;
+        ir->arr = (uint16_t)inst.get_var_arg1_eval_stack_idx();
+        ir->index = (uint16_t)inst.get_var_arg2_eval_stack_idx();
+        ir->value = (uint16_t)inst.get_var_arg3_eval_stack_idx();
+        return codes + sizeof(StelemI4Unchecked);
+    }
+    case OpCodeEnum::StelemI4UncheckedShort:
+    {
+        auto ir = (StelemI4UncheckedShort*)codes;
+        ir->__code = 246;
+        ir->arr = (uint8_t)inst.get_var_arg1_eval_stack_idx();
+        ir->index = (uint8_t)inst.get_var_arg2_eval_stack_idx();
+        ir->value = (uint8_t)inst.get_var_arg3_eval_stack_idx();
+        return codes + sizeof(StelemI4UncheckedShort);
+    }
+    case OpCodeEnum::StelemI8Unchecked:
+    {
+        auto ir = (StelemI8Unchecked*)codes;
+        ir->__prefix = 252;
+        ir->__code = 74;
+        ir->arr = (uint16_t)inst.get_var_arg1_eval_stack_idx();
+        ir->index = (uint16_t)inst.get_var_arg2_eval_stack_idx();
+        ir->value = (uint16_t)inst.get_var_arg3_eval_stack_idx();
+        return codes + sizeof(StelemI8Unchecked);
+    }
+    case OpCodeEnum::StelemIUnchecked:
+    {
+        auto ir = (StelemIUnchecked*)codes;
+        ir->__prefix = 252;
+        ir->__code = 75;
+        ir->arr = (uint16_t)inst.get_var_arg1_eval_stack_idx();
+        ir->index = (uint16_t)inst.get_var_arg2_eval_stack_idx();
+        ir->value = (uint16_t)inst.get_var_arg3_eval_stack_idx();
+        return codes + sizeof(StelemIUnchecked);
+    }
+    case OpCodeEnum::StelemR4Unchecked:
+    {
+        auto ir = (StelemR4Unchecked*)codes;
+        ir->__prefix = 252;
+        ir->__code = 76;
+        ir->arr = (uint16_t)inst.get_var_arg1_eval_stack_idx();
+        ir->index = (uint16_t)inst.get_var_arg2_eval_stack_idx();
+        ir->value = (uint16_t)inst.get_var_arg3_eval_stack_idx();
+        return codes + sizeof(StelemR4Unchecked);
+    }
+    case OpCodeEnum::StelemR4UncheckedShort:
+    {
+        auto ir = (StelemR4UncheckedShort*)codes;
+        ir->__code = 247;
+        ir->arr = (uint8_t)inst.get_var_arg1_eval_stack_idx();
+        ir->index = (uint8_t)inst.get_var_arg2_eval_stack_idx();
+        ir->value = (uint8_t)inst.get_var_arg3_eval_stack_idx();
+        return codes + sizeof(StelemR4UncheckedShort);
+    }
+    case OpCodeEnum::StelemR8Unchecked:
+    {
+        auto ir = (StelemR8Unchecked*)codes;
+        ir->__prefix = 252;
+        ir->__code = 77;
+        ir->arr = (uint16_t)inst.get_var_arg1_eval_stack_idx();
+        ir->index = (uint16_t)inst.get_var_arg2_eval_stack_idx();
+        ir->value = (uint16_t)inst.get_var_arg3_eval_stack_idx();
+        return codes + sizeof(StelemR8Unchecked);
+    }
+    case OpCodeEnum::StelemR8UncheckedShort:
+    {
+        auto ir = (StelemR8UncheckedShort*)codes;
+        ir->__code = 248;
+        ir->arr = (uint8_t)inst.get_var_arg1_eval_stack_idx();
+        ir->index = (uint8_t)inst.get_var_arg2_eval_stack_idx();
+        ir->value = (uint8_t)inst.get_var_arg3_eval_stack_idx();
+        return codes + sizeof(StelemR8UncheckedShort);
+    }
+    case OpCodeEnum::InvokeDelegate:
+    {
+        auto ir = (InvokeDelegate*)codes;
+        ir->__prefix = 252;
+        ir->__code = 78;
+        ir->method_idx = (uint16_t)inst.get_resolved_data_index();
+        ir->frame_base = (uint16_t)inst.get_frame_base();
+        return codes + sizeof(InvokeDelegate);
+    }
+    case OpCodeEnum::StfldRef:
+    {
+        auto ir = (StfldRef*)codes;
+        ir->__prefix = 251;
+        ir->__code = 251;
+        ir->obj = (uint16_t)inst.get_var_arg1_eval_stack_idx();
+        ir->value = (uint16_t)inst.get_var_arg2_eval_stack_idx();
+        ir->offset = (uint16_t)inst.get_field_offset();
+        return codes + sizeof(StfldRef);
+    }
+    case OpCodeEnum::StfldRefShort:
+    {
+        auto ir = (StfldRefShort*)codes;
+        ir->__code = 249;
+        ir->obj = (uint8_t)inst.get_var_arg1_eval_stack_idx();
+        ir->value = (uint8_t)inst.get_var_arg2_eval_stack_idx();
+        ir->offset = (uint8_t)inst.get_field_offset();
+        return codes + sizeof(StfldRefShort);
+    }
+    case OpCodeEnum::StfldRefLarge:
+    {
+        auto ir = (StfldRefLarge*)codes;
+        ir->__prefix = 253;
+        ir->__code = 112;
+        ir->obj = (uint16_t)inst.get_var_arg1_eval_stack_idx();
+        ir->value = (uint16_t)inst.get_var_arg2_eval_stack_idx();
+        ir->offset = (uint32_t)inst.get_field_offset();
+        return codes + sizeof(StfldRefLarge);
+    }
+    case OpCodeEnum::StfldAnyRef:
+    {
+        auto ir = (StfldAnyRef*)codes;
+        ir->__prefix = 252;
+        ir->__code = 79;
+        ir->obj = (uint16_t)inst.get_var_arg1_eval_stack_idx();
+        ir->value = (uint16_t)inst.get_var_arg2_eval_stack_idx();
+        ir->offset = (uint16_t)inst.get_field_offset();
+        ir->size = (uint16_t)inst.get_field_size();
+        return codes + sizeof(StfldAnyRef);
+    }
+    case OpCodeEnum::StfldAnyRefLarge:
+    {
+        auto ir = (StfldAnyRefLarge*)codes;
+        ir->__prefix = 253;
+        ir->__code = 113;
+        ir->obj = (uint16_t)inst.get_var_arg1_eval_stack_idx();
+        ir->value = (uint16_t)inst.get_var_arg2_eval_stack_idx();
+        ir->offset = (uint32_t)inst.get_field_offset();
+        ir->size = (uint32_t)inst.get_field_size();
+        return codes + sizeof(StfldAnyRefLarge);
+    }
+    case OpCodeEnum::StIndRef:
+    {
+        auto ir = (StIndRef*)codes;
+        ir->__prefix = 252;
+        ir->__code = 80;
+        ir->src = (uint16_t)inst.get_var_src_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(StIndRef);
+    }
+    case OpCodeEnum::StIndRefShort:
+    {
+        auto ir = (StIndRefShort*)codes;
+        ir->__prefix = 251;
+        ir->__code = 252;
+        ir->src = (uint8_t)inst.get_var_src_eval_stack_idx();
+        ir->dst = (uint8_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(StIndRefShort);
+    }
+    case OpCodeEnum::CpObjRef:
+    {
+        auto ir = (CpObjRef*)codes;
+        ir->__prefix = 251;
+        ir->__code = 253;
+        ir->src = (uint16_t)inst.get_var_src_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        return codes + sizeof(CpObjRef);
+    }
+    case OpCodeEnum::CpObjAnyRef:
+    {
+        auto ir = (CpObjAnyRef*)codes;
+        ir->__prefix = 252;
+        ir->__code = 81;
+        ir->src = (uint16_t)inst.get_var_src_eval_stack_idx();
+        ir->dst = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        ir->size = (uint16_t)inst.get_size();
+        return codes + sizeof(CpObjAnyRef);
+    }
+    case OpCodeEnum::StObjAnyRef:
+    {
+        auto ir = (StObjAnyRef*)codes;
+        ir->__prefix = 252;
+        ir->__code = 82;
+        ir->src = (uint16_t)inst.get_var_src_eval_stack_idx();
+        ir->addr = (uint16_t)inst.get_var_dst_eval_stack_idx();
+        ir->size = (uint16_t)inst.get_size();
+        return codes + sizeof(StObjAnyRef);
+    }
+
+    //}}LOW_LEVEL_INSTRUCTION_WRITE_TO_DATA_DATA
+    default:
+        assert(false && "Unhandled opcode in write_instruction_to_data");
+        return nullptr;
+    }
+}
+
+static bool fit_u8(size_t value)
+{
+    return value <= UINT8_MAX;
+}
+
+static bool fit_i8(intptr_t value)
+{
+    return value >= INT8_MIN && value <= INT8_MAX;
+}
+
+OpCodeEnum OpCodes::get_short_opcode(const GeneralInst& inst)
+{
+    switch (inst.get_opcode())
+    {
+    //{{LOW_LEVEL_SHORT_INSTRUCTION_SELECT
+    case OpCodeEnum::InitLocals:
+        if (fit_u8(inst.get_locals_offset()) && fit_u8(inst.get_size()))
+        {
+            return OpCodeEnum::InitLocalsShort;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::LdLocI1:
+        if (fit_u8(inst.get_var_src_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::LdLocI1Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::LdLocU1:
+        if (fit_u8(inst.get_var_src_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::LdLocU1Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::LdLocI2:
+        if (fit_u8(inst.get_var_src_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::LdLocI2Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::LdLocU2:
+        if (fit_u8(inst.get_var_src_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::LdLocU2Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::LdLocI4:
+        if (fit_u8(inst.get_var_src_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::LdLocI4Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::LdLocI8:
+        if (fit_u8(inst.get_var_src_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::LdLocI8Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::LdLocAny:
+        if (fit_u8(inst.get_var_src_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()) && fit_u8(inst.get_size()))
+        {
+            return OpCodeEnum::LdLocAnyShort;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::LdLoca:
+        if (fit_u8(inst.get_var_src_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::LdLocaShort;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::StLocI1:
+        if (fit_u8(inst.get_var_src_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::StLocI1Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::StLocI2:
+        if (fit_u8(inst.get_var_src_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::StLocI2Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::StLocI4:
+        if (fit_u8(inst.get_var_src_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::StLocI4Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::StLocI8:
+        if (fit_u8(inst.get_var_src_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::StLocI8Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::StLocAny:
+        if (fit_u8(inst.get_var_src_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()) && fit_u8(inst.get_size()))
+        {
+            return OpCodeEnum::StLocAnyShort;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::LdNull:
+        if (fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::LdNullShort;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::LdcI4I2:
+        if (fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::LdcI4I2Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::LdcI4I4:
+        if (fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::LdcI4I4Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::LdcI8I2:
+        if (fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::LdcI8I2Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::LdcI8I4:
+        if (fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::LdcI8I4Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::LdcI8I8:
+        if (fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::LdcI8I8Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::LdStr:
+        if (fit_u8(inst.get_resolved_data_index()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::LdStrShort;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::Br:
+        if (fit_i8(inst.get_branch_target_offset()))
+        {
+            return OpCodeEnum::BrShort;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::BrTrueI4:
+        if (fit_u8(inst.get_var_src_eval_stack_idx()) && fit_i8(inst.get_branch_target_offset()))
+        {
+            return OpCodeEnum::BrTrueI4Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::BrTrueI8:
+        if (fit_u8(inst.get_var_src_eval_stack_idx()) && fit_i8(inst.get_branch_target_offset()))
+        {
+            return OpCodeEnum::BrTrueI8Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::BrFalseI4:
+        if (fit_u8(inst.get_var_src_eval_stack_idx()) && fit_i8(inst.get_branch_target_offset()))
+        {
+            return OpCodeEnum::BrFalseI4Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::BrFalseI8:
+        if (fit_u8(inst.get_var_src_eval_stack_idx()) && fit_i8(inst.get_branch_target_offset()))
+        {
+            return OpCodeEnum::BrFalseI8Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::BeqI4:
+        if (fit_u8(inst.get_var_arg1_eval_stack_idx()) && fit_u8(inst.get_var_arg2_eval_stack_idx()) && fit_i8(inst.get_branch_target_offset()))
+        {
+            return OpCodeEnum::BeqI4Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::BeqI8:
+        if (fit_u8(inst.get_var_arg1_eval_stack_idx()) && fit_u8(inst.get_var_arg2_eval_stack_idx()) && fit_i8(inst.get_branch_target_offset()))
+        {
+            return OpCodeEnum::BeqI8Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::BgeI4:
+        if (fit_u8(inst.get_var_arg1_eval_stack_idx()) && fit_u8(inst.get_var_arg2_eval_stack_idx()) && fit_i8(inst.get_branch_target_offset()))
+        {
+            return OpCodeEnum::BgeI4Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::BgeI8:
+        if (fit_u8(inst.get_var_arg1_eval_stack_idx()) && fit_u8(inst.get_var_arg2_eval_stack_idx()) && fit_i8(inst.get_branch_target_offset()))
+        {
+            return OpCodeEnum::BgeI8Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::BgtI4:
+        if (fit_u8(inst.get_var_arg1_eval_stack_idx()) && fit_u8(inst.get_var_arg2_eval_stack_idx()) && fit_i8(inst.get_branch_target_offset()))
+        {
+            return OpCodeEnum::BgtI4Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::BgtI8:
+        if (fit_u8(inst.get_var_arg1_eval_stack_idx()) && fit_u8(inst.get_var_arg2_eval_stack_idx()) && fit_i8(inst.get_branch_target_offset()))
+        {
+            return OpCodeEnum::BgtI8Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::BleI4:
+        if (fit_u8(inst.get_var_arg1_eval_stack_idx()) && fit_u8(inst.get_var_arg2_eval_stack_idx()) && fit_i8(inst.get_branch_target_offset()))
+        {
+            return OpCodeEnum::BleI4Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::BleI8:
+        if (fit_u8(inst.get_var_arg1_eval_stack_idx()) && fit_u8(inst.get_var_arg2_eval_stack_idx()) && fit_i8(inst.get_branch_target_offset()))
+        {
+            return OpCodeEnum::BleI8Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::BltI4:
+        if (fit_u8(inst.get_var_arg1_eval_stack_idx()) && fit_u8(inst.get_var_arg2_eval_stack_idx()) && fit_i8(inst.get_branch_target_offset()))
+        {
+            return OpCodeEnum::BltI4Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::BltI8:
+        if (fit_u8(inst.get_var_arg1_eval_stack_idx()) && fit_u8(inst.get_var_arg2_eval_stack_idx()) && fit_i8(inst.get_branch_target_offset()))
+        {
+            return OpCodeEnum::BltI8Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::BneUnI4:
+        if (fit_u8(inst.get_var_arg1_eval_stack_idx()) && fit_u8(inst.get_var_arg2_eval_stack_idx()) && fit_i8(inst.get_branch_target_offset()))
+        {
+            return OpCodeEnum::BneUnI4Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::BneUnI8:
+        if (fit_u8(inst.get_var_arg1_eval_stack_idx()) && fit_u8(inst.get_var_arg2_eval_stack_idx()) && fit_i8(inst.get_branch_target_offset()))
+        {
+            return OpCodeEnum::BneUnI8Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::BgeUnI4:
+        if (fit_u8(inst.get_var_arg1_eval_stack_idx()) && fit_u8(inst.get_var_arg2_eval_stack_idx()) && fit_i8(inst.get_branch_target_offset()))
+        {
+            return OpCodeEnum::BgeUnI4Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::BgeUnI8:
+        if (fit_u8(inst.get_var_arg1_eval_stack_idx()) && fit_u8(inst.get_var_arg2_eval_stack_idx()) && fit_i8(inst.get_branch_target_offset()))
+        {
+            return OpCodeEnum::BgeUnI8Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::BgtUnI4:
+        if (fit_u8(inst.get_var_arg1_eval_stack_idx()) && fit_u8(inst.get_var_arg2_eval_stack_idx()) && fit_i8(inst.get_branch_target_offset()))
+        {
+            return OpCodeEnum::BgtUnI4Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::BgtUnI8:
+        if (fit_u8(inst.get_var_arg1_eval_stack_idx()) && fit_u8(inst.get_var_arg2_eval_stack_idx()) && fit_i8(inst.get_branch_target_offset()))
+        {
+            return OpCodeEnum::BgtUnI8Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::BleUnI4:
+        if (fit_u8(inst.get_var_arg1_eval_stack_idx()) && fit_u8(inst.get_var_arg2_eval_stack_idx()) && fit_i8(inst.get_branch_target_offset()))
+        {
+            return OpCodeEnum::BleUnI4Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::BleUnI8:
+        if (fit_u8(inst.get_var_arg1_eval_stack_idx()) && fit_u8(inst.get_var_arg2_eval_stack_idx()) && fit_i8(inst.get_branch_target_offset()))
+        {
+            return OpCodeEnum::BleUnI8Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::BltUnI4:
+        if (fit_u8(inst.get_var_arg1_eval_stack_idx()) && fit_u8(inst.get_var_arg2_eval_stack_idx()) && fit_i8(inst.get_branch_target_offset()))
+        {
+            return OpCodeEnum::BltUnI4Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::BltUnI8:
+        if (fit_u8(inst.get_var_arg1_eval_stack_idx()) && fit_u8(inst.get_var_arg2_eval_stack_idx()) && fit_i8(inst.get_branch_target_offset()))
+        {
+            return OpCodeEnum::BltUnI8Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::AddI4:
+        if (fit_u8(inst.get_var_arg1_eval_stack_idx()) && fit_u8(inst.get_var_arg2_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::AddI4Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::AddI8:
+        if (fit_u8(inst.get_var_arg1_eval_stack_idx()) && fit_u8(inst.get_var_arg2_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::AddI8Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::AddR4:
+        if (fit_u8(inst.get_var_arg1_eval_stack_idx()) && fit_u8(inst.get_var_arg2_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::AddR4Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::AddR8:
+        if (fit_u8(inst.get_var_arg1_eval_stack_idx()) && fit_u8(inst.get_var_arg2_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::AddR8Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::SubI4:
+        if (fit_u8(inst.get_var_arg1_eval_stack_idx()) && fit_u8(inst.get_var_arg2_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::SubI4Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::SubI8:
+        if (fit_u8(inst.get_var_arg1_eval_stack_idx()) && fit_u8(inst.get_var_arg2_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::SubI8Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::SubR4:
+        if (fit_u8(inst.get_var_arg1_eval_stack_idx()) && fit_u8(inst.get_var_arg2_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::SubR4Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::SubR8:
+        if (fit_u8(inst.get_var_arg1_eval_stack_idx()) && fit_u8(inst.get_var_arg2_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::SubR8Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::MulI4:
+        if (fit_u8(inst.get_var_arg1_eval_stack_idx()) && fit_u8(inst.get_var_arg2_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::MulI4Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::MulI8:
+        if (fit_u8(inst.get_var_arg1_eval_stack_idx()) && fit_u8(inst.get_var_arg2_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::MulI8Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::MulR4:
+        if (fit_u8(inst.get_var_arg1_eval_stack_idx()) && fit_u8(inst.get_var_arg2_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::MulR4Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::MulR8:
+        if (fit_u8(inst.get_var_arg1_eval_stack_idx()) && fit_u8(inst.get_var_arg2_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::MulR8Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::DivI4:
+        if (fit_u8(inst.get_var_arg1_eval_stack_idx()) && fit_u8(inst.get_var_arg2_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::DivI4Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::DivI8:
+        if (fit_u8(inst.get_var_arg1_eval_stack_idx()) && fit_u8(inst.get_var_arg2_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::DivI8Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::DivR4:
+        if (fit_u8(inst.get_var_arg1_eval_stack_idx()) && fit_u8(inst.get_var_arg2_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::DivR4Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::DivR8:
+        if (fit_u8(inst.get_var_arg1_eval_stack_idx()) && fit_u8(inst.get_var_arg2_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::DivR8Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::DivUnI4:
+        if (fit_u8(inst.get_var_arg1_eval_stack_idx()) && fit_u8(inst.get_var_arg2_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::DivUnI4Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::DivUnI8:
+        if (fit_u8(inst.get_var_arg1_eval_stack_idx()) && fit_u8(inst.get_var_arg2_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::DivUnI8Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::RemI4:
+        if (fit_u8(inst.get_var_arg1_eval_stack_idx()) && fit_u8(inst.get_var_arg2_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::RemI4Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::RemI8:
+        if (fit_u8(inst.get_var_arg1_eval_stack_idx()) && fit_u8(inst.get_var_arg2_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::RemI8Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::RemR4:
+        if (fit_u8(inst.get_var_arg1_eval_stack_idx()) && fit_u8(inst.get_var_arg2_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::RemR4Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::RemR8:
+        if (fit_u8(inst.get_var_arg1_eval_stack_idx()) && fit_u8(inst.get_var_arg2_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::RemR8Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::RemUnI4:
+        if (fit_u8(inst.get_var_arg1_eval_stack_idx()) && fit_u8(inst.get_var_arg2_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::RemUnI4Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::RemUnI8:
+        if (fit_u8(inst.get_var_arg1_eval_stack_idx()) && fit_u8(inst.get_var_arg2_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::RemUnI8Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::AndI4:
+        if (fit_u8(inst.get_var_arg1_eval_stack_idx()) && fit_u8(inst.get_var_arg2_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::AndI4Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::AndI8:
+        if (fit_u8(inst.get_var_arg1_eval_stack_idx()) && fit_u8(inst.get_var_arg2_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::AndI8Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::OrI4:
+        if (fit_u8(inst.get_var_arg1_eval_stack_idx()) && fit_u8(inst.get_var_arg2_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::OrI4Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::OrI8:
+        if (fit_u8(inst.get_var_arg1_eval_stack_idx()) && fit_u8(inst.get_var_arg2_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::OrI8Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::XorI4:
+        if (fit_u8(inst.get_var_arg1_eval_stack_idx()) && fit_u8(inst.get_var_arg2_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::XorI4Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::XorI8:
+        if (fit_u8(inst.get_var_arg1_eval_stack_idx()) && fit_u8(inst.get_var_arg2_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::XorI8Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::ShlI4:
+        if (fit_u8(inst.get_var_arg1_eval_stack_idx()) && fit_u8(inst.get_var_arg2_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::ShlI4Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::ShrI4:
+        if (fit_u8(inst.get_var_arg1_eval_stack_idx()) && fit_u8(inst.get_var_arg2_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::ShrI4Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::ShrUnI4:
+        if (fit_u8(inst.get_var_arg1_eval_stack_idx()) && fit_u8(inst.get_var_arg2_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::ShrUnI4Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::NegI4:
+        if (fit_u8(inst.get_var_src_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::NegI4Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::NegI8:
+        if (fit_u8(inst.get_var_src_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::NegI8Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::NegR4:
+        if (fit_u8(inst.get_var_src_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::NegR4Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::NegR8:
+        if (fit_u8(inst.get_var_src_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::NegR8Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::NotI4:
+        if (fit_u8(inst.get_var_src_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::NotI4Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::NotI8:
+        if (fit_u8(inst.get_var_src_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::NotI8Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::ConvI1I4:
+        if (fit_u8(inst.get_var_src_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::ConvI1I4Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::ConvI1I8:
+        if (fit_u8(inst.get_var_src_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::ConvI1I8Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::ConvI1R4:
+        if (fit_u8(inst.get_var_src_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::ConvI1R4Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::ConvI1R8:
+        if (fit_u8(inst.get_var_src_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::ConvI1R8Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::ConvU1I4:
+        if (fit_u8(inst.get_var_src_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::ConvU1I4Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::ConvU1I8:
+        if (fit_u8(inst.get_var_src_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::ConvU1I8Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::ConvU1R4:
+        if (fit_u8(inst.get_var_src_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::ConvU1R4Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::ConvU1R8:
+        if (fit_u8(inst.get_var_src_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::ConvU1R8Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::ConvI2I4:
+        if (fit_u8(inst.get_var_src_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::ConvI2I4Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::ConvI2I8:
+        if (fit_u8(inst.get_var_src_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::ConvI2I8Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::ConvI2R4:
+        if (fit_u8(inst.get_var_src_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::ConvI2R4Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::ConvI2R8:
+        if (fit_u8(inst.get_var_src_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::ConvI2R8Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::ConvU2I4:
+        if (fit_u8(inst.get_var_src_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::ConvU2I4Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::ConvU2I8:
+        if (fit_u8(inst.get_var_src_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::ConvU2I8Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::ConvU2R4:
+        if (fit_u8(inst.get_var_src_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::ConvU2R4Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::ConvU2R8:
+        if (fit_u8(inst.get_var_src_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::ConvU2R8Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::ConvI4I8:
+        if (fit_u8(inst.get_var_src_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::ConvI4I8Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::ConvI4R4:
+        if (fit_u8(inst.get_var_src_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::ConvI4R4Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::ConvI4R8:
+        if (fit_u8(inst.get_var_src_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::ConvI4R8Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::ConvU4I8:
+        if (fit_u8(inst.get_var_src_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::ConvU4I8Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::ConvU4R4:
+        if (fit_u8(inst.get_var_src_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::ConvU4R4Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::ConvU4R8:
+        if (fit_u8(inst.get_var_src_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::ConvU4R8Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::ConvI8I4:
+        if (fit_u8(inst.get_var_src_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::ConvI8I4Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::ConvI8R4:
+        if (fit_u8(inst.get_var_src_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::ConvI8R4Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::ConvI8R8:
+        if (fit_u8(inst.get_var_src_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::ConvI8R8Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::ConvR4I4:
+        if (fit_u8(inst.get_var_src_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::ConvR4I4Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::ConvR4I8:
+        if (fit_u8(inst.get_var_src_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::ConvR4I8Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::ConvR4R8:
+        if (fit_u8(inst.get_var_src_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::ConvR4R8Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::ConvR8I4:
+        if (fit_u8(inst.get_var_src_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::ConvR8I4Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::ConvR8I8:
+        if (fit_u8(inst.get_var_src_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::ConvR8I8Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::ConvR8R4:
+        if (fit_u8(inst.get_var_src_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::ConvR8R4Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::CeqI4:
+        if (fit_u8(inst.get_var_arg1_eval_stack_idx()) && fit_u8(inst.get_var_arg2_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::CeqI4Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::CeqI8:
+        if (fit_u8(inst.get_var_arg1_eval_stack_idx()) && fit_u8(inst.get_var_arg2_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::CeqI8Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::CeqR4:
+        if (fit_u8(inst.get_var_arg1_eval_stack_idx()) && fit_u8(inst.get_var_arg2_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::CeqR4Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::CeqR8:
+        if (fit_u8(inst.get_var_arg1_eval_stack_idx()) && fit_u8(inst.get_var_arg2_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::CeqR8Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::CgtI4:
+        if (fit_u8(inst.get_var_arg1_eval_stack_idx()) && fit_u8(inst.get_var_arg2_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::CgtI4Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::CgtI8:
+        if (fit_u8(inst.get_var_arg1_eval_stack_idx()) && fit_u8(inst.get_var_arg2_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::CgtI8Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::CgtUnI4:
+        if (fit_u8(inst.get_var_arg1_eval_stack_idx()) && fit_u8(inst.get_var_arg2_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::CgtUnI4Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::CgtUnI8:
+        if (fit_u8(inst.get_var_arg1_eval_stack_idx()) && fit_u8(inst.get_var_arg2_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::CgtUnI8Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::CltI4:
+        if (fit_u8(inst.get_var_arg1_eval_stack_idx()) && fit_u8(inst.get_var_arg2_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::CltI4Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::CltI8:
+        if (fit_u8(inst.get_var_arg1_eval_stack_idx()) && fit_u8(inst.get_var_arg2_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::CltI8Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::CltUnI4:
+        if (fit_u8(inst.get_var_arg1_eval_stack_idx()) && fit_u8(inst.get_var_arg2_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::CltUnI4Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::CltUnI8:
+        if (fit_u8(inst.get_var_arg1_eval_stack_idx()) && fit_u8(inst.get_var_arg2_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::CltUnI8Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::InitObjI1:
+        if (fit_u8(inst.get_var_src_eval_stack_idx()))
+        {
+            return OpCodeEnum::InitObjI1Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::InitObjI2:
+        if (fit_u8(inst.get_var_src_eval_stack_idx()))
+        {
+            return OpCodeEnum::InitObjI2Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::InitObjI4:
+        if (fit_u8(inst.get_var_src_eval_stack_idx()))
+        {
+            return OpCodeEnum::InitObjI4Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::InitObjI8:
+        if (fit_u8(inst.get_var_src_eval_stack_idx()))
+        {
+            return OpCodeEnum::InitObjI8Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::InitObjAny:
+        if (fit_u8(inst.get_var_src_eval_stack_idx()))
+        {
+            return OpCodeEnum::InitObjAnyShort;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::CpObjI1:
+        if (fit_u8(inst.get_var_src_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::CpObjI1Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::CpObjI2:
+        if (fit_u8(inst.get_var_src_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::CpObjI2Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::CpObjI4:
+        if (fit_u8(inst.get_var_src_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::CpObjI4Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::CpObjI8:
+        if (fit_u8(inst.get_var_src_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::CpObjI8Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::CpObjAny:
+        if (fit_u8(inst.get_var_src_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()) && fit_u8(inst.get_size()))
+        {
+            return OpCodeEnum::CpObjAnyShort;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::LdObjAny:
+        if (fit_u8(inst.get_var_src_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()) && fit_u8(inst.get_size()))
+        {
+            return OpCodeEnum::LdObjAnyShort;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::StObjAny:
+        if (fit_u8(inst.get_var_src_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()) && fit_u8(inst.get_size()))
+        {
+            return OpCodeEnum::StObjAnyShort;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::CastClass:
+        if (fit_u8(inst.get_var_src_eval_stack_idx()) && fit_u8(inst.get_resolved_data_index()))
+        {
+            return OpCodeEnum::CastClassShort;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::IsInst:
+        if (fit_u8(inst.get_var_src_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()) && fit_u8(inst.get_resolved_data_index()))
+        {
+            return OpCodeEnum::IsInstShort;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::Box:
+        if (fit_u8(inst.get_var_src_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()) && fit_u8(inst.get_resolved_data_index()))
+        {
+            return OpCodeEnum::BoxShort;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::Unbox:
+        if (fit_u8(inst.get_var_src_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()) && fit_u8(inst.get_resolved_data_index()))
+        {
+            return OpCodeEnum::UnboxShort;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::UnboxAny:
+        if (fit_u8(inst.get_var_src_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()) && fit_u8(inst.get_resolved_data_index()))
+        {
+            return OpCodeEnum::UnboxAnyShort;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::NewArr:
+        if (fit_u8(inst.get_var_src_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()) && fit_u8(inst.get_resolved_data_index()))
+        {
+            return OpCodeEnum::NewArrShort;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::LdLen:
+        if (fit_u8(inst.get_var_src_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::LdLenShort;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::Ldelema:
+        if (fit_u8(inst.get_var_arg1_eval_stack_idx()) && fit_u8(inst.get_var_arg2_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()) &&
+            fit_u8(inst.get_resolved_data_index()))
+        {
+            return OpCodeEnum::LdelemaShort;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::LdelemI1:
+        if (fit_u8(inst.get_var_arg1_eval_stack_idx()) && fit_u8(inst.get_var_arg2_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::LdelemI1Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::LdelemU1:
+        if (fit_u8(inst.get_var_arg1_eval_stack_idx()) && fit_u8(inst.get_var_arg2_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::LdelemU1Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::LdelemI2:
+        if (fit_u8(inst.get_var_arg1_eval_stack_idx()) && fit_u8(inst.get_var_arg2_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::LdelemI2Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::LdelemU2:
+        if (fit_u8(inst.get_var_arg1_eval_stack_idx()) && fit_u8(inst.get_var_arg2_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::LdelemU2Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::LdelemI4:
+        if (fit_u8(inst.get_var_arg1_eval_stack_idx()) && fit_u8(inst.get_var_arg2_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::LdelemI4Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::LdelemI8:
+        if (fit_u8(inst.get_var_arg1_eval_stack_idx()) && fit_u8(inst.get_var_arg2_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::LdelemI8Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::LdelemI:
+        if (fit_u8(inst.get_var_arg1_eval_stack_idx()) && fit_u8(inst.get_var_arg2_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::LdelemIShort;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::LdelemR4:
+        if (fit_u8(inst.get_var_arg1_eval_stack_idx()) && fit_u8(inst.get_var_arg2_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::LdelemR4Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::LdelemR8:
+        if (fit_u8(inst.get_var_arg1_eval_stack_idx()) && fit_u8(inst.get_var_arg2_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::LdelemR8Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::LdelemRef:
+        if (fit_u8(inst.get_var_arg1_eval_stack_idx()) && fit_u8(inst.get_var_arg2_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::LdelemRefShort;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::LdelemAnyRef:
+        if (fit_u8(inst.get_var_arg1_eval_stack_idx()) && fit_u8(inst.get_var_arg2_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()) &&
+            fit_u8(inst.get_resolved_data_index()))
+        {
+            return OpCodeEnum::LdelemAnyRefShort;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::LdelemAnyVal:
+        if (fit_u8(inst.get_var_arg1_eval_stack_idx()) && fit_u8(inst.get_var_arg2_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()) &&
+            fit_u8(inst.get_resolved_data_index()))
+        {
+            return OpCodeEnum::LdelemAnyValShort;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::StelemI1:
+        if (fit_u8(inst.get_var_arg1_eval_stack_idx()) && fit_u8(inst.get_var_arg2_eval_stack_idx()) && fit_u8(inst.get_var_arg3_eval_stack_idx()))
+        {
+            return OpCodeEnum::StelemI1Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::StelemI2:
+        if (fit_u8(inst.get_var_arg1_eval_stack_idx()) && fit_u8(inst.get_var_arg2_eval_stack_idx()) && fit_u8(inst.get_var_arg3_eval_stack_idx()))
+        {
+            return OpCodeEnum::StelemI2Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::StelemI4:
+        if (fit_u8(inst.get_var_arg1_eval_stack_idx()) && fit_u8(inst.get_var_arg2_eval_stack_idx()) && fit_u8(inst.get_var_arg3_eval_stack_idx()))
+        {
+            return OpCodeEnum::StelemI4Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::StelemI8:
+        if (fit_u8(inst.get_var_arg1_eval_stack_idx()) && fit_u8(inst.get_var_arg2_eval_stack_idx()) && fit_u8(inst.get_var_arg3_eval_stack_idx()))
+        {
+            return OpCodeEnum::StelemI8Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::StelemI:
+        if (fit_u8(inst.get_var_arg1_eval_stack_idx()) && fit_u8(inst.get_var_arg2_eval_stack_idx()) && fit_u8(inst.get_var_arg3_eval_stack_idx()))
+        {
+            return OpCodeEnum::StelemIShort;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::StelemR4:
+        if (fit_u8(inst.get_var_arg1_eval_stack_idx()) && fit_u8(inst.get_var_arg2_eval_stack_idx()) && fit_u8(inst.get_var_arg3_eval_stack_idx()))
+        {
+            return OpCodeEnum::StelemR4Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::StelemR8:
+        if (fit_u8(inst.get_var_arg1_eval_stack_idx()) && fit_u8(inst.get_var_arg2_eval_stack_idx()) && fit_u8(inst.get_var_arg3_eval_stack_idx()))
+        {
+            return OpCodeEnum::StelemR8Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::StelemRef:
+        if (fit_u8(inst.get_var_arg1_eval_stack_idx()) && fit_u8(inst.get_var_arg2_eval_stack_idx()) && fit_u8(inst.get_var_arg3_eval_stack_idx()))
+        {
+            return OpCodeEnum::StelemRefShort;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::StelemAnyRef:
+        if (fit_u8(inst.get_var_arg1_eval_stack_idx()) && fit_u8(inst.get_var_arg2_eval_stack_idx()) && fit_u8(inst.get_var_arg3_eval_stack_idx()) &&
+            fit_u8(inst.get_resolved_data_index()))
+        {
+            return OpCodeEnum::StelemAnyRefShort;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::StelemAnyVal:
+        if (fit_u8(inst.get_var_arg1_eval_stack_idx()) && fit_u8(inst.get_var_arg2_eval_stack_idx()) && fit_u8(inst.get_var_arg3_eval_stack_idx()) &&
+            fit_u8(inst.get_resolved_data_index()))
+        {
+            return OpCodeEnum::StelemAnyValShort;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::Ldftn:
+        if (fit_u8(inst.get_var_dst_eval_stack_idx()) && fit_u8(inst.get_resolved_data_index()))
+        {
+            return OpCodeEnum::LdftnShort;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::Ldvirtftn:
+        if (fit_u8(inst.get_var_src_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()) && fit_u8(inst.get_resolved_data_index()))
+        {
+            return OpCodeEnum::LdvirtftnShort;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::LdfldI1:
+        if (fit_u8(inst.get_var_src_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()) && fit_u8(inst.get_field_offset()))
+        {
+            return OpCodeEnum::LdfldI1Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::LdfldU1:
+        if (fit_u8(inst.get_var_src_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()) && fit_u8(inst.get_field_offset()))
+        {
+            return OpCodeEnum::LdfldU1Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::LdfldI2:
+        if (fit_u8(inst.get_var_src_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()) && fit_u8(inst.get_field_offset()))
+        {
+            return OpCodeEnum::LdfldI2Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::LdfldU2:
+        if (fit_u8(inst.get_var_src_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()) && fit_u8(inst.get_field_offset()))
+        {
+            return OpCodeEnum::LdfldU2Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::LdfldI4:
+        if (fit_u8(inst.get_var_src_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()) && fit_u8(inst.get_field_offset()))
+        {
+            return OpCodeEnum::LdfldI4Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::LdfldI8:
+        if (fit_u8(inst.get_var_src_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()) && fit_u8(inst.get_field_offset()))
+        {
+            return OpCodeEnum::LdfldI8Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::LdfldAny:
+        if (fit_u8(inst.get_var_src_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()) && fit_u8(inst.get_field_offset()) &&
+            fit_u8(inst.get_field_size()))
+        {
+            return OpCodeEnum::LdfldAnyShort;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::LdvfldI1:
+        if (fit_u8(inst.get_var_src_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()) && fit_u8(inst.get_field_offset()))
+        {
+            return OpCodeEnum::LdvfldI1Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::LdvfldU1:
+        if (fit_u8(inst.get_var_src_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()) && fit_u8(inst.get_field_offset()))
+        {
+            return OpCodeEnum::LdvfldU1Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::LdvfldI2:
+        if (fit_u8(inst.get_var_src_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()) && fit_u8(inst.get_field_offset()))
+        {
+            return OpCodeEnum::LdvfldI2Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::LdvfldU2:
+        if (fit_u8(inst.get_var_src_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()) && fit_u8(inst.get_field_offset()))
+        {
+            return OpCodeEnum::LdvfldU2Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::LdvfldI4:
+        if (fit_u8(inst.get_var_src_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()) && fit_u8(inst.get_field_offset()))
+        {
+            return OpCodeEnum::LdvfldI4Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::LdvfldI8:
+        if (fit_u8(inst.get_var_src_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()) && fit_u8(inst.get_field_offset()))
+        {
+            return OpCodeEnum::LdvfldI8Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::LdvfldAny:
+        if (fit_u8(inst.get_var_src_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()) && fit_u8(inst.get_field_offset()) &&
+            fit_u8(inst.get_field_size()))
+        {
+            return OpCodeEnum::LdvfldAnyShort;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::Ldflda:
+        if (fit_u8(inst.get_var_src_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()) && fit_u8(inst.get_field_offset()))
+        {
+            return OpCodeEnum::LdfldaShort;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::StfldI1:
+        if (fit_u8(inst.get_var_arg1_eval_stack_idx()) && fit_u8(inst.get_var_arg2_eval_stack_idx()) && fit_u8(inst.get_field_offset()))
+        {
+            return OpCodeEnum::StfldI1Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::StfldI2:
+        if (fit_u8(inst.get_var_arg1_eval_stack_idx()) && fit_u8(inst.get_var_arg2_eval_stack_idx()) && fit_u8(inst.get_field_offset()))
+        {
+            return OpCodeEnum::StfldI2Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::StfldI4:
+        if (fit_u8(inst.get_var_arg1_eval_stack_idx()) && fit_u8(inst.get_var_arg2_eval_stack_idx()) && fit_u8(inst.get_field_offset()))
+        {
+            return OpCodeEnum::StfldI4Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::StfldI8:
+        if (fit_u8(inst.get_var_arg1_eval_stack_idx()) && fit_u8(inst.get_var_arg2_eval_stack_idx()) && fit_u8(inst.get_field_offset()))
+        {
+            return OpCodeEnum::StfldI8Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::StfldAny:
+        if (fit_u8(inst.get_var_arg1_eval_stack_idx()) && fit_u8(inst.get_var_arg2_eval_stack_idx()) && fit_u8(inst.get_field_offset()) &&
+            fit_u8(inst.get_field_size()))
+        {
+            return OpCodeEnum::StfldAnyShort;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::LdsfldI1:
+        if (fit_u8(inst.get_var_dst_eval_stack_idx()) && fit_u8(inst.get_resolved_data_index()))
+        {
+            return OpCodeEnum::LdsfldI1Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::LdsfldU1:
+        if (fit_u8(inst.get_var_dst_eval_stack_idx()) && fit_u8(inst.get_resolved_data_index()))
+        {
+            return OpCodeEnum::LdsfldU1Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::LdsfldI2:
+        if (fit_u8(inst.get_var_dst_eval_stack_idx()) && fit_u8(inst.get_resolved_data_index()))
+        {
+            return OpCodeEnum::LdsfldI2Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::LdsfldU2:
+        if (fit_u8(inst.get_var_dst_eval_stack_idx()) && fit_u8(inst.get_resolved_data_index()))
+        {
+            return OpCodeEnum::LdsfldU2Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::LdsfldI4:
+        if (fit_u8(inst.get_var_dst_eval_stack_idx()) && fit_u8(inst.get_resolved_data_index()))
+        {
+            return OpCodeEnum::LdsfldI4Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::LdsfldI8:
+        if (fit_u8(inst.get_var_dst_eval_stack_idx()) && fit_u8(inst.get_resolved_data_index()))
+        {
+            return OpCodeEnum::LdsfldI8Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::LdsfldAny:
+        if (fit_u8(inst.get_resolved_data_index()) && fit_u8(inst.get_field_size()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::LdsfldAnyShort;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::Ldsflda:
+        if (fit_u8(inst.get_resolved_data_index()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::LdsfldaShort;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::LdsfldRvaData:
+        if (fit_u8(inst.get_resolved_data_index()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::LdsfldRvaDataShort;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::StsfldI1:
+        if (fit_u8(inst.get_resolved_data_index()) && fit_u8(inst.get_var_arg1_eval_stack_idx()))
+        {
+            return OpCodeEnum::StsfldI1Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::StsfldI2:
+        if (fit_u8(inst.get_resolved_data_index()) && fit_u8(inst.get_var_arg1_eval_stack_idx()))
+        {
+            return OpCodeEnum::StsfldI2Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::StsfldI4:
+        if (fit_u8(inst.get_resolved_data_index()) && fit_u8(inst.get_var_arg1_eval_stack_idx()))
+        {
+            return OpCodeEnum::StsfldI4Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::StsfldI8:
+        if (fit_u8(inst.get_resolved_data_index()) && fit_u8(inst.get_var_arg1_eval_stack_idx()))
+        {
+            return OpCodeEnum::StsfldI8Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::StsfldAny:
+        if (fit_u8(inst.get_resolved_data_index()) && fit_u8(inst.get_field_size()) && fit_u8(inst.get_var_arg1_eval_stack_idx()))
+        {
+            return OpCodeEnum::StsfldAnyShort;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::RetVoid:
+        return OpCodeEnum::RetVoidShort;
+    case OpCodeEnum::RetI4:
+        if (fit_u8(inst.get_var_src_eval_stack_idx()))
+        {
+            return OpCodeEnum::RetI4Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::RetI8:
+        if (fit_u8(inst.get_var_src_eval_stack_idx()))
+        {
+            return OpCodeEnum::RetI8Short;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::RetAny:
+        if (fit_u8(inst.get_var_src_eval_stack_idx()) && fit_u8(inst.get_size()))
+        {
+            return OpCodeEnum::RetAnyShort;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::CallInterp:
+        if (fit_u8(inst.get_resolved_data_index()) && fit_u8(inst.get_frame_base()))
+        {
+            return OpCodeEnum::CallInterpShort;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::CallVirtInterp:
+        if (fit_u8(inst.get_resolved_data_index()) && fit_u8(inst.get_frame_base()))
+        {
+            return OpCodeEnum::CallVirtInterpShort;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::CallInternalCall:
+        if (fit_u8(inst.get_resolved_data_index()) && fit_u8(inst.get_frame_base()))
+        {
+            return OpCodeEnum::CallInternalCallShort;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::CallIntrinsic:
+        if (fit_u8(inst.get_resolved_data_index()) && fit_u8(inst.get_frame_base()))
+        {
+            return OpCodeEnum::CallIntrinsicShort;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::CallPInvoke:
+        if (fit_u8(inst.get_resolved_data_index()) && fit_u8(inst.get_frame_base()))
+        {
+            return OpCodeEnum::CallPInvokeShort;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::CallRuntimeImplemented:
+        if (fit_u8(inst.get_resolved_data_index()) && fit_u8(inst.get_frame_base()))
+        {
+            return OpCodeEnum::CallRuntimeImplementedShort;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::CalliInterp:
+        if (fit_u8(inst.get_resolved_data_index()) && fit_u8(inst.get_var_arg3_eval_stack_idx()) && fit_u8(inst.get_frame_base()))
+        {
+            return OpCodeEnum::CalliInterpShort;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::BoxRefInplace:
+        if (fit_u8(inst.get_var_src_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()) && fit_u8(inst.get_resolved_data_index()))
+        {
+            return OpCodeEnum::BoxRefInplaceShort;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::NewObjInterp:
+        if (fit_u8(inst.get_resolved_data_index()) && fit_u8(inst.get_frame_base()))
+        {
+            return OpCodeEnum::NewObjInterpShort;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::NewValueTypeInterp:
+        if (fit_u8(inst.get_resolved_data_index()) && fit_u8(inst.get_frame_base()))
+        {
+            return OpCodeEnum::NewValueTypeInterpShort;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::NewObjInternalCall:
+        if (fit_u8(inst.get_resolved_data_index()) && fit_u8(inst.get_invoker_idx()) && fit_u8(inst.get_frame_base()))
+        {
+            return OpCodeEnum::NewObjInternalCallShort;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::NewObjIntrinsic:
+        if (fit_u8(inst.get_resolved_data_index()) && fit_u8(inst.get_invoker_idx()) && fit_u8(inst.get_frame_base()))
+        {
+            return OpCodeEnum::NewObjIntrinsicShort;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::Throw:
+        if (fit_u8(inst.get_var_src_eval_stack_idx()))
+        {
+            return OpCodeEnum::ThrowShort;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::Rethrow:
+        return OpCodeEnum::RethrowShort;
+    case OpCodeEnum::LeaveTryWithFinally:
+        if (fit_i8(inst.get_branch_target_offset()))
+        {
+            return OpCodeEnum::LeaveTryWithFinallyShort;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::LeaveCatchWithFinally:
+        if (fit_i8(inst.get_branch_target_offset()))
+        {
+            return OpCodeEnum::LeaveCatchWithFinallyShort;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::LeaveCatchWithoutFinally:
+        if (fit_i8(inst.get_branch_target_offset()))
+        {
+            return OpCodeEnum::LeaveCatchWithoutFinallyShort;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::EndFilter:
+        if (fit_u8(inst.get_var_src_eval_stack_idx()))
+        {
+            return OpCodeEnum::EndFilterShort;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::EndFinally:
+        return OpCodeEnum::EndFinallyShort;
+    case OpCodeEnum::EndFault:
+        return OpCodeEnum::EndFaultShort;
+    case OpCodeEnum::CheckNull:
+        if (fit_u8(inst.get_var_src_eval_stack_idx()))
+        {
+            return OpCodeEnum::CheckNullShort;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::LdsfldU1NoCctor:
+        if (fit_u8(inst.get_var_dst_eval_stack_idx()) && fit_u8(inst.get_resolved_data_index()))
+        {
+            return OpCodeEnum::LdsfldU1NoCctorShort;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::LdsfldI4NoCctor:
+        if (fit_u8(inst.get_var_dst_eval_stack_idx()) && fit_u8(inst.get_resolved_data_index()))
+        {
+            return OpCodeEnum::LdsfldI4NoCctorShort;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::LdsfldI8NoCctor:
+        if (fit_u8(inst.get_var_dst_eval_stack_idx()) && fit_u8(inst.get_resolved_data_index()))
+        {
+            return OpCodeEnum::LdsfldI8NoCctorShort;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::LdsfldaNoCctor:
+        if (fit_u8(inst.get_resolved_data_index()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::LdsfldaNoCctorShort;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::StsfldI4NoCctor:
+        if (fit_u8(inst.get_resolved_data_index()) && fit_u8(inst.get_var_arg1_eval_stack_idx()))
+        {
+            return OpCodeEnum::StsfldI4NoCctorShort;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::StsfldI8NoCctor:
+        if (fit_u8(inst.get_resolved_data_index()) && fit_u8(inst.get_var_arg1_eval_stack_idx()))
+        {
+            return OpCodeEnum::StsfldI8NoCctorShort;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::CallInterpNoCctor:
+        if (fit_u8(inst.get_resolved_data_index()) && fit_u8(inst.get_frame_base()))
+        {
+            return OpCodeEnum::CallInterpNoCctorShort;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::LdelemI4Unchecked:
+        if (fit_u8(inst.get_var_arg1_eval_stack_idx()) && fit_u8(inst.get_var_arg2_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::LdelemI4UncheckedShort;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::LdelemR4Unchecked:
+        if (fit_u8(inst.get_var_arg1_eval_stack_idx()) && fit_u8(inst.get_var_arg2_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::LdelemR4UncheckedShort;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::LdelemR8Unchecked:
+        if (fit_u8(inst.get_var_arg1_eval_stack_idx()) && fit_u8(inst.get_var_arg2_eval_stack_idx()) && fit_u8(inst.get_var_dst_eval_stack_idx()))
+        {
+            return OpCodeEnum::LdelemR8UncheckedShort;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::StelemI4Unchecked:
+        if (fit_u8(inst.get_var_arg1_eval_stack_idx()) && fit_u8(inst.get_var_arg2_eval_stack_idx()) && fit_u8(inst.get_var_arg3_eval_stack_idx()))
+        {
+            return OpCodeEnum::StelemI4UncheckedShort;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::StelemR4Unchecked:
+        if (fit_u8(inst.get_var_arg1_eval_stack_idx()) && fit_u8(inst.get_var_arg2_eval_stack_idx()) && fit_u8(inst.get_var_arg3_eval_stack_idx()))
+        {
+            return OpCodeEnum::StelemR4UncheckedShort;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::StelemR8Unchecked:
+        if (fit_u8(inst.get_var_arg1_eval_stack_idx()) && fit_u8(inst.get_var_arg2_eval_stack_idx()) && fit_u8(inst.get_var_arg3_eval_stack_idx()))
+        {
+            return OpCodeEnum::StelemR8UncheckedShort;
+        }
+        return OpCodeEnum::Illegal;
+    case OpCodeEnum::StfldRef:
+        if (fit_u8(inst.get_var_arg1_eval_stack_idx()) && fit_u8(inst.get_var_arg2_eval_stack_idx()) && fit_u8(inst.get_field_offset()))
+        {
+            return OpCodeEnum::StfldRefShort;
+        }
+        return OpCodeEnum::Illegal;
+
+    //}}LOW_LEVEL_SHORT_INSTRUCTION_SELECT
+    default:
+        return OpCodeEnum::Illegal;
+    }
+}
+
+OpCodeEnum OpCodes::get_super_opcode(OpCodeEnum first, OpCodeEnum second)
+{
+    // unread when the profile selects no superinstruction
+    (void)second;
+    switch (first)
+    {
+    //{{LOW_LEVEL_SUPER_INSTRUCTION_SELECT
+    //}}LOW_LEVEL_SUPER_INSTRUCTION_SELECT
+    default:
+        break;
     }
+    return OpCodeEnum::Illegal;
 }
 
 } // namespace leanclr::interp::ll
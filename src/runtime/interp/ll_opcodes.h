@@ -660,7 +660,60 @@ enum class OpCodeEnum
     EndFinallyShort,
     EndFault,
     EndFaultShort,
+    CheckNull,
+    CheckNullShort,
     GetEnumLongHashCode,
+    LdsfldU1NoCctor,
+    LdsfldU1NoCctorShort,
+    LdsfldI4NoCctor,
+    LdsfldI4NoCctorShort,
+    LdsfldI8NoCctor,
+    LdsfldI8NoCctorShort,
+    LdsfldaNoCctor,
+    LdsfldaNoCctorShort,
+    StsfldI4NoCctor,
+    StsfldI4NoCctorShort,
+    StsfldI8NoCctor,
+    StsfldI8NoCctorShort,
+    CallInterpNoCctor,
+    CallInterpNoCctorShort,
+    CountBackEdge,
+    LdelemaUnchecked,
+    LdelemaReadOnlyUnchecked,
+    LdelemI1Unchecked,
+    LdelemU1Unchecked,
+    LdelemI2Unchecked,
+    LdelemU2Unchecked,
+    LdelemI4Unchecked,
+    LdelemI4UncheckedShort,
+    LdelemI8Unchecked,
+    LdelemIUnchecked,
+    LdelemR4Unchecked,
+    LdelemR4UncheckedShort,
+    LdelemR8Unchecked,
+    LdelemR8UncheckedShort,
+    LdelemRefUnchecked,
+    StelemI1Unchecked,
+    StelemI2Unchecked,
+    StelemI4Unchecked,
+    StelemI4UncheckedShort,
+    StelemI8Unchecked,
+    StelemIUnchecked,
+    StelemR4Unchecked,
+    StelemR4UncheckedShort,
+    StelemR8Unchecked,
+    StelemR8UncheckedShort,
+    InvokeDelegate,
+    StfldRef,
+    StfldRefShort,
+    StfldRefLarge,
+    StfldAnyRef,
+    StfldAnyRefLarge,
+    StIndRef,
+    StIndRefShort,
+    CpObjRef,
+    CpObjAnyRef,
+    StObjAnyRef,
 
     //}}LOW_LEVEL_OPCODE_ENUMM
     __Count,
@@ -904,21 +957,21 @@ enum class OpCodeValue0 : uint8_t
     EndFilterShort = 0xE8,
     EndFinallyShort = 0xE9,
     EndFaultShort = 0xEA,
-    __UnusedEB = 0xEB,
-    __UnusedEC = 0xEC,
-    __UnusedED = 0xED,
-    __UnusedEE = 0xEE,
-    __UnusedEF = 0xEF,
-    __UnusedF0 = 0xF0,
-    __UnusedF1 = 0xF1,
-    __UnusedF2 = 0xF2,
-    __UnusedF3 = 0xF3,
-    __UnusedF4 = 0xF4,
-    __UnusedF5 = 0xF5,
-    __UnusedF6 = 0xF6,
-    __UnusedF7 = 0xF7,
-    __UnusedF8 = 0xF8,
-    __UnusedF9 = 0xF9,
+    CheckNullShort = 0xEB,
+    LdsfldU1NoCctorShort = 0xEC,
+    LdsfldI4NoCctorShort = 0xED,
+    LdsfldI8NoCctorShort = 0xEE,
+    LdsfldaNoCctorShort = 0xEF,
+    StsfldI4NoCctorShort = 0xF0,
+    StsfldI8NoCctorShort = 0xF1,
+    CallInterpNoCctorShort = 0xF2,
+    LdelemI4UncheckedShort = 0xF3,
+    LdelemR4UncheckedShort = 0xF4,
+    LdelemR8UncheckedShort = 0xF5,
+    StelemI4UncheckedShort = 0xF6,
+    StelemR4UncheckedShort = 0xF7,
+    StelemR8UncheckedShort = 0xF8,
+    StfldRefShort = 0xF9,
     __UnusedFA = 0xFA,
 
     //}}LOW_LEVEL_OPCODE00
@@ -1182,6 +1235,10 @@ enum class OpCodeValue1 : uint8_t
     EndFilter = 0xF7,
     EndFinally = 0xF8,
     EndFault = 0xF9,
+    CheckNull = 0xFA,
+    StfldRef = 0xFB,
+    StIndRefShort = 0xFC,
+    CpObjRef = 0xFD,
 
     //}}LOW_LEVEL_OPCODE1
 };
@@ -1240,6 +1297,38 @@ enum class OpCodeValue2 : uint8_t
     InitBlk = 0x30,
     CpBlk = 0x31,
     GetEnumLongHashCode = 0x32,
+    LdsfldU1NoCctor = 0x33,
+    LdsfldI4NoCctor = 0x34,
+    LdsfldI8NoCctor = 0x35,
+    LdsfldaNoCctor = 0x36,
+    StsfldI4NoCctor = 0x37,
+    StsfldI8NoCctor = 0x38,
+    CallInterpNoCctor = 0x39,
+    CountBackEdge = 0x3A,
+    LdelemaUnchecked = 0x3B,
+    LdelemaReadOnlyUnchecked = 0x3C,
+    LdelemI1Unchecked = 0x3D,
+    LdelemU1Unchecked = 0x3E,
+    LdelemI2Unchecked = 0x3F,
+    LdelemU2Unchecked = 0x40,
+    LdelemI4Unchecked = 0x41,
+    LdelemI8Unchecked = 0x42,
+    LdelemIUnchecked = 0x43,
+    LdelemR4Unchecked = 0x44,
+    LdelemR8Unchecked = 0x45,
+    LdelemRefUnchecked = 0x46,
+    StelemI1Unchecked = 0x47,
+    StelemI2Unchecked = 0x48,
+    StelemI4Unchecked = 0x49,
+    StelemI8Unchecked = 0x4A,
+    StelemIUnchecked = 0x4B,
+    StelemR4Unchecked = 0x4C,
+    StelemR8Unchecked = 0x4D,
+    InvokeDelegate = 0x4E,
+    StfldAnyRef = 0x4F,
+    StIndRef = 0x50,
+    CpObjAnyRef = 0x51,
+    StObjAnyRef = 0x52,
 
     //}}LOW_LEVEL_OPCODE2
 };
@@ -1359,6 +1448,8 @@ enum class OpCodeValue3 : uint8_t
     StfldI8Large = 0x6D,
     StfldI8Unaligned = 0x6E,
     StfldAnyLarge = 0x6F,
+    StfldRefLarge = 0x70,
+    StfldAnyRefLarge = 0x71,
 
     //}}LOW_LEVEL_OPCODE3
 };
@@ -7296,6 +7387,21 @@ struct EndFaultShort
     uint8_t __padding_3;
 };
 
+struct CheckNull
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t obj;
+};
+
+struct CheckNullShort
+{
+    uint8_t __code;
+    uint8_t obj;
+    uint8_t __padding_2;
+    uint8_t __padding_3;
+};
+
 struct GetEnumLongHashCode
 {
     uint8_t __prefix;
@@ -7306,6 +7412,470 @@ struct GetEnumLongHashCode
     uint8_t __padding_7;
 };
 
+struct LdsfldU1NoCctor
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t dst;
+    uint16_t field_idx;
+    uint8_t __padding_6;
+    uint8_t __padding_7;
+};
+
+struct LdsfldU1NoCctorShort
+{
+    uint8_t __code;
+    uint8_t dst;
+    uint8_t field_idx;
+    uint8_t __padding_3;
+};
+
+struct LdsfldI4NoCctor
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t dst;
+    uint16_t field_idx;
+    uint8_t __padding_6;
+    uint8_t __padding_7;
+};
+
+struct LdsfldI4NoCctorShort
+{
+    uint8_t __code;
+    uint8_t dst;
+    uint8_t field_idx;
+    uint8_t __padding_3;
+};
+
+struct LdsfldI8NoCctor
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t dst;
+    uint16_t field_idx;
+    uint8_t __padding_6;
+    uint8_t __padding_7;
+};
+
+struct LdsfldI8NoCctorShort
+{
+    uint8_t __code;
+    uint8_t dst;
+    uint8_t field_idx;
+    uint8_t __padding_3;
+};
+
+struct LdsfldaNoCctor
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t field_idx;
+    uint16_t dst;
+    uint8_t __padding_6;
+    uint8_t __padding_7;
+};
+
+struct LdsfldaNoCctorShort
+{
+    uint8_t __code;
+    uint8_t field_idx;
+    uint8_t dst;
+    uint8_t __padding_3;
+};
+
+struct StsfldI4NoCctor
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t field_idx;
+    uint16_t value;
+    uint8_t __padding_6;
+    uint8_t __padding_7;
+};
+
+struct StsfldI4NoCctorShort
+{
+    uint8_t __code;
+    uint8_t field_idx;
+    uint8_t value;
+    uint8_t __padding_3;
+};
+
+struct StsfldI8NoCctor
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t field_idx;
+    uint16_t value;
+    uint8_t __padding_6;
+    uint8_t __padding_7;
+};
+
+struct StsfldI8NoCctorShort
+{
+    uint8_t __code;
+    uint8_t field_idx;
+    uint8_t value;
+    uint8_t __padding_3;
+};
+
+struct CallInterpNoCctor
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t method_idx;
+    uint16_t frame_base;
+    uint8_t __padding_6;
+    uint8_t __padding_7;
+};
+
+struct CallInterpNoCctorShort
+{
+    uint8_t __code;
+    uint8_t method_idx;
+    uint8_t frame_base;
+    uint8_t __padding_3;
+};
+
+struct CountBackEdge
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint8_t __padding_2;
+    uint8_t __padding_3;
+};
+
+struct LdelemaUnchecked
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t arr;
+    uint16_t index;
+    uint16_t dst;
+    uint16_t ele_klass_idx;
+    uint8_t __padding_10;
+    uint8_t __padding_11;
+};
+
+struct LdelemaReadOnlyUnchecked
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t arr;
+    uint16_t index;
+    uint16_t dst;
+};
+
+struct LdelemI1Unchecked
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t arr;
+    uint16_t index;
+    uint16_t dst;
+};
+
+struct LdelemU1Unchecked
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t arr;
+    uint16_t index;
+    uint16_t dst;
+};
+
+struct LdelemI2Unchecked
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t arr;
+    uint16_t index;
+    uint16_t dst;
+};
+
+struct LdelemU2Unchecked
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t arr;
+    uint16_t index;
+    uint16_t dst;
+};
+
+struct LdelemI4Unchecked
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t arr;
+    uint16_t index;
+    uint16_t dst;
+};
+
+struct LdelemI4UncheckedShort
+{
+    uint8_t __code;
+    uint8_t arr;
+    uint8_t index;
+    uint8_t dst;
+};
+
+struct LdelemI8Unchecked
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t arr;
+    uint16_t index;
+    uint16_t dst;
+};
+
+struct LdelemIUnchecked
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t arr;
+    uint16_t index;
+    uint16_t dst;
+};
+
+struct LdelemR4Unchecked
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t arr;
+    uint16_t index;
+    uint16_t dst;
+};
+
+struct LdelemR4UncheckedShort
+{
+    uint8_t __code;
+    uint8_t arr;
+    uint8_t index;
+    uint8_t dst;
+};
+
+struct LdelemR8Unchecked
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t arr;
+    uint16_t index;
+    uint16_t dst;
+};
+
+struct LdelemR8UncheckedShort
+{
+    uint8_t __code;
+    uint8_t arr;
+    uint8_t index;
+    uint8_t dst;
+};
+
+struct LdelemRefUnchecked
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t arr;
+    uint16_t index;
+    uint16_t dst;
+};
+
+struct StelemI1Unchecked
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t arr;
+    uint16_t index;
+    uint16_t value;
+};
+
+struct StelemI2Unchecked
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t arr;
+    uint16_t index;
+    uint16_t value;
+};
+
+struct StelemI4Unchecked
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t arr;
+    uint16_t index;
+    uint16_t value;
+};
+
+struct StelemI4UncheckedShort
+{
+    uint8_t __code;
+    uint8_t arr;
+    uint8_t index;
+    uint8_t value;
+};
+
+struct StelemI8Unchecked
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t arr;
+    uint16_t index;
+    uint16_t value;
+};
+
+struct StelemIUnchecked
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t arr;
+    uint16_t index;
+    uint16_t value;
+};
+
+struct StelemR4Unchecked
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t arr;
+    uint16_t index;
+    uint16_t value;
+};
+
+struct StelemR4UncheckedShort
+{
+    uint8_t __code;
+    uint8_t arr;
+    uint8_t index;
+    uint8_t value;
+};
+
+struct StelemR8Unchecked
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t arr;
+    uint16_t index;
+    uint16_t value;
+};
+
+struct StelemR8UncheckedShort
+{
+    uint8_t __code;
+    uint8_t arr;
+    uint8_t index;
+    uint8_t value;
+};
+
+struct InvokeDelegate
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t method_idx;
+    uint16_t frame_base;
+    uint8_t __padding_6;
+    uint8_t __padding_7;
+};
+
+struct StfldRef
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t obj;
+    uint16_t value;
+    uint16_t offset;
+};
+
+struct StfldRefShort
+{
+    uint8_t __code;
+    uint8_t obj;
+    uint8_t value;
+    uint8_t offset;
+};
+
+struct StfldRefLarge
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t obj;
+    uint16_t value;
+    uint8_t __padding_6;
+    uint8_t __padding_7;
+    uint32_t offset;
+};
+
+struct StfldAnyRef
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t obj;
+    uint16_t value;
+    uint16_t offset;
+    uint16_t size;
+    uint8_t __padding_10;
+    uint8_t __padding_11;
+};
+
+struct StfldAnyRefLarge
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t obj;
+    uint16_t value;
+    uint8_t __padding_6;
+    uint8_t __padding_7;
+    uint32_t offset;
+    uint32_t size;
+};
+
+struct StIndRef
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t src;
+    uint16_t dst;
+    uint8_t __padding_6;
+    uint8_t __padding_7;
+};
+
+struct StIndRefShort
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint8_t src;
+    uint8_t dst;
+};
+
+struct CpObjRef
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t src;
+    uint16_t dst;
+    uint8_t __padding_6;
+    uint8_t __padding_7;
+};
+
+struct CpObjAnyRef
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t src;
+    uint16_t dst;
+    uint16_t size;
+};
+
+struct StObjAnyRef
+{
+    uint8_t __prefix;
+    uint8_t __code;
+    uint16_t src;
+    uint16_t addr;
+    uint16_t size;
+};
+
 //}}LOW_LEVEL_INSTRUCTION_STRUCTSS
 
 struct GeneralInst;
@@ -7325,10 +7895,20 @@ class OpCodes
         }
     }
 
+    static const char* get_opcode_name(OpCodeEnum opcode)
+    {
+        return s_opnames[static_cast<size_t>(opcode)];
+    }
+
     static uint8_t* write_instruction_to_data(uint8_t* codes_cur, const GeneralInst& inst);
+    // Returns the Short form of inst if all its operands fit under the current layout, otherwise Illegal.
+    static OpCodeEnum get_short_opcode(const GeneralInst& inst);
+    // Returns the superinstruction that runs first and the second instruction following it, otherwise Illegal.
+    static OpCodeEnum get_super_opcode(OpCodeEnum first, OpCodeEnum second);
 
   private:
     static size_t get_switch_instruction_size(const GeneralInst& inst);
+    static const char* s_opnames[static_cast<size_t>(OpCodeEnum::__Count)];
     static size_t s_opsizes[static_cast<size_t>(OpCodeEnum::__Count)];
 };
 
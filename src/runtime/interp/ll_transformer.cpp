@@ -2,8 +2,12 @@
 #include <cstdint>
 #include "ll_transformer.h"
 #include "hl_transformer.h"
+#include "ir_cache.h"
+#include "interpreter.h"
 #include "vm/class.h"
+#include "vm/delegate.h"
 #include "vm/field.h"
+#include "vm/method.h"
 #include "vm/rt_string.h"
 #include "vm/assembly.h"
 #include "vm/array_class.h"
@@ -29,6 +33,42 @@ GeneralInst::GeneralInst(const hl::GeneralInst& hl_inst)
 #endif
 }
 
+// Static field accesses and static calls on a class whose static constructor has already finished skip the check, and so do
+// instance calls, which pass a null klass. Instructions emitted with the checked form are quickened by the interpreter once the
+// check first passes. Recorded methods only ever get the checked form: the class may not be initialized when the IR cache is
+// loaded, and quickening a cached method works the same as quickening a transformed one.
+static OpCodeEnum select_no_cctor_opcode(OpCodeEnum op, metadata::RtClass* klass)
+{
+    if (IrCache::is_recording() || (klass && vm::Class::is_cctor_not_finished(klass)))
+    {
+        return op;
+    }
+    switch (op)
+    {
+    case OpCodeEnum::LdsfldU1:
+        return OpCodeEnum::LdsfldU1NoCctor;
+    case OpCodeEnum::LdsfldI4:
+        return OpCodeEnum::LdsfldI4NoCctor;
+    case OpCodeEnum::LdsfldI8:
+        return OpCodeEnum::LdsfldI8NoCctor;
+    case OpCodeEnum::Ldsflda:
+        return OpCodeEnum::LdsfldaNoCctor;
+    case OpCodeEnum::StsfldI4:
+        return OpCodeEnum::StsfldI4NoCctor;
+    case OpCodeEnum::StsfldI8:
+        return OpCodeEnum::StsfldI8NoCctor;
+    case OpCodeEnum::CallInterp:
+        return OpCodeEnum::CallInterpNoCctor;
+    default:
+        return op;
+    }
+}
+
+Transformer::Transformer(hl::Transformer& hl_trans, alloc::MemPool& mem_pool)
+    : _hl_transformer(hl_trans), _mem_pool(mem_pool), _code_pool(hl_trans.get_module()), _resolved_datas(&mem_pool), _resolved_data_sources(&mem_pool)
+{
+}
+
 RtResult<BasicBlock*> Transformer::translate_hl_basic_to_ll_basic(const hl::BasicBlock* hl_bb)
 {
     auto it = _hl_2_ll_bb_map.find(hl_bb);
@@ -63,7 +103,7 @@ RtResultVoid Transformer::transform_basic_blocks()
     RET_VOID_OK();
 }
 
-size_t Transformer::get_resolved_data_index(const void* data)
+size_t Transformer::get_resolved_data_index(const void* data, RtResolvedDataKind kind, const void* source)
 {
     auto it = _resolved_data_2_index_map.find(data);
     if (it != _resolved_data_2_index_map.end())
@@ -73,26 +113,44 @@ size_t Transformer::get_resolved_data_index(const void* data)
 
     size_t index = _resolved_datas.size();
     _resolved_datas.push_back(data);
+    _resolved_data_sources.push_back({kind, source ? source : data});
     _resolved_data_2_index_map.insert({data, index});
     return index;
 }
 
-void Transformer::setup_inst_resolved_data(GeneralInst* ll_inst, const void* data)
+void Transformer::setup_inst_resolved_data(GeneralInst* ll_inst, const void* data, RtResolvedDataKind kind, const void* source)
 {
-    size_t index = get_resolved_data_index(data);
+    size_t index = get_resolved_data_index(data, kind, source);
     ll_inst->set_resolved_data_index(index);
 }
 
 void Transformer::setup_inst_klass(GeneralInst* ll_inst, const hl::GeneralInst* hl_inst)
 {
     metadata::RtClass* klass = hl_inst->get_class();
-    setup_inst_resolved_data(ll_inst, klass);
+    setup_inst_resolved_data(ll_inst, klass, RtResolvedDataKind::Class);
 }
 
 void Transformer::setup_inst_method(GeneralInst* ll_inst, const hl::GeneralInst* hl_inst)
 {
     const metadata::RtMethodInfo* method = hl_inst->get_method();
-    setup_inst_resolved_data(ll_inst, method);
+    setup_inst_resolved_data(ll_inst, method, RtResolvedDataKind::Method);
+}
+
+void Transformer::setup_inst_virtual_call_cache(GeneralInst* ll_inst, const metadata::RtMethodInfo* virtual_method)
+{
+    // every call site owns its cache, so the resolved data slot is never shared
+    alloc::MemPool& pool = _code_pool.get();
+    RtVirtualCallCache* cache = pool.malloc_any_zeroed<RtVirtualCallCache>();
+    cache->virtual_method = virtual_method;
+    setup_inst_resolved_data(ll_inst, cache, RtResolvedDataKind::VirtualCallCache);
+}
+
+void Transformer::setup_inst_type_check_cache(GeneralInst* ll_inst, metadata::RtClass* klass)
+{
+    alloc::MemPool& pool = _code_pool.get();
+    RtTypeCheckCache* cache = pool.malloc_any_zeroed<RtTypeCheckCache>();
+    InterpDefs::init_type_check_cache(cache, klass);
+    setup_inst_resolved_data(ll_inst, cache, RtResolvedDataKind::TypeCheckCache);
 }
 
 utils::NotFreeList<size_t> Transformer::find_finally_clause_idx_of_leave_target(const BasicBlock* leave_src, const BasicBlock* leave_target)
@@ -792,7 +850,7 @@ RtResultVoid Transformer::transform_instructions()
 
             case hl::OpCodeEnum::LdStr:
                 ll_inst->set_opcode(OpCodeEnum::LdStr);
-                setup_inst_resolved_data(ll_inst, hl_inst->get_user_string());
+                setup_inst_resolved_data(ll_inst, hl_inst->get_user_string(), RtResolvedDataKind::UserString);
                 break;
 
             case hl::OpCodeEnum::Dup:
@@ -995,9 +1053,8 @@ RtResultVoid Transformer::transform_instructions()
                 break;
 
             case hl::OpCodeEnum::StIndRef:
-                ll_inst->set_opcode(hl_inst->contains_prefix_unaligned()
-                                        ? utils::Platform::select_arch(OpCodeEnum::StIndI4Unaligned, OpCodeEnum::StIndI8Unaligned)
-                                        : utils::Platform::select_arch(OpCodeEnum::StIndI4, OpCodeEnum::StIndI8));
+                // reference slots are always pointer aligned, the collector could not trace them otherwise
+                ll_inst->set_opcode(OpCodeEnum::StIndRef);
                 break;
 
             case hl::OpCodeEnum::Add:
@@ -1360,11 +1417,11 @@ RtResultVoid Transformer::transform_instructions()
                 break;
 
             case hl::OpCodeEnum::CpObjRef:
-                ll_inst->set_opcode(utils::Platform::select_arch(OpCodeEnum::CpObjI4, OpCodeEnum::CpObjI8));
+                ll_inst->set_opcode(OpCodeEnum::CpObjRef);
                 break;
 
             case hl::OpCodeEnum::CpObjAny:
-                ll_inst->set_opcode(OpCodeEnum::CpObjAny);
+                ll_inst->set_opcode(hl_inst->stores_references ? OpCodeEnum::CpObjAnyRef : OpCodeEnum::CpObjAny);
                 break;
 
             case hl::OpCodeEnum::LdObjAny:
@@ -1372,18 +1429,18 @@ RtResultVoid Transformer::transform_instructions()
                 break;
 
             case hl::OpCodeEnum::StObjAny:
-                ll_inst->set_opcode(OpCodeEnum::StObjAny);
+                ll_inst->set_opcode(hl_inst->stores_references ? OpCodeEnum::StObjAnyRef : OpCodeEnum::StObjAny);
                 break;
 
             case hl::OpCodeEnum::CastClass:
                 ll_inst->set_opcode(OpCodeEnum::CastClass);
-                setup_inst_klass(ll_inst, hl_inst);
+                setup_inst_type_check_cache(ll_inst, hl_inst->get_class());
                 assert(ll_inst->get_var_src_eval_stack_idx() == ll_inst->get_var_dst_eval_stack_idx());
                 break;
 
             case hl::OpCodeEnum::IsInst:
                 ll_inst->set_opcode(OpCodeEnum::IsInst);
-                setup_inst_klass(ll_inst, hl_inst);
+                setup_inst_type_check_cache(ll_inst, hl_inst->get_class());
                 break;
 
             case hl::OpCodeEnum::Box:
@@ -1411,7 +1468,7 @@ RtResultVoid Transformer::transform_instructions()
                 ll_inst->set_opcode(OpCodeEnum::NewArr);
                 metadata::RtClass* ele_klass = hl_inst->get_class();
                 DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(metadata::RtClass*, arr_klass, vm::ArrayClass::get_szarray_class_from_element_class(ele_klass));
-                setup_inst_resolved_data(ll_inst, arr_klass);
+                setup_inst_resolved_data(ll_inst, arr_klass, RtResolvedDataKind::Class);
                 break;
             }
 
@@ -1420,48 +1477,51 @@ RtResultVoid Transformer::transform_instructions()
                 break;
 
             case hl::OpCodeEnum::Ldelema:
-                ll_inst->set_opcode(hl_inst->contains_prefix_readonly() ? OpCodeEnum::LdelemaReadOnly : OpCodeEnum::Ldelema);
+                if (hl_inst->contains_prefix_readonly())
+                    ll_inst->set_opcode(hl_inst->index_in_range ? OpCodeEnum::LdelemaReadOnlyUnchecked : OpCodeEnum::LdelemaReadOnly);
+                else
+                    ll_inst->set_opcode(hl_inst->index_in_range ? OpCodeEnum::LdelemaUnchecked : OpCodeEnum::Ldelema);
                 setup_inst_klass(ll_inst, hl_inst);
                 break;
 
             case hl::OpCodeEnum::LdelemI1:
-                ll_inst->set_opcode(OpCodeEnum::LdelemI1);
+                ll_inst->set_opcode(hl_inst->index_in_range ? OpCodeEnum::LdelemI1Unchecked : OpCodeEnum::LdelemI1);
                 break;
 
             case hl::OpCodeEnum::LdelemU1:
-                ll_inst->set_opcode(OpCodeEnum::LdelemU1);
+                ll_inst->set_opcode(hl_inst->index_in_range ? OpCodeEnum::LdelemU1Unchecked : OpCodeEnum::LdelemU1);
                 break;
 
             case hl::OpCodeEnum::LdelemI2:
-                ll_inst->set_opcode(OpCodeEnum::LdelemI2);
+                ll_inst->set_opcode(hl_inst->index_in_range ? OpCodeEnum::LdelemI2Unchecked : OpCodeEnum::LdelemI2);
                 break;
 
             case hl::OpCodeEnum::LdelemU2:
-                ll_inst->set_opcode(OpCodeEnum::LdelemU2);
+                ll_inst->set_opcode(hl_inst->index_in_range ? OpCodeEnum::LdelemU2Unchecked : OpCodeEnum::LdelemU2);
                 break;
 
             case hl::OpCodeEnum::LdelemI4:
-                ll_inst->set_opcode(OpCodeEnum::LdelemI4);
+                ll_inst->set_opcode(hl_inst->index_in_range ? OpCodeEnum::LdelemI4Unchecked : OpCodeEnum::LdelemI4);
                 break;
 
             case hl::OpCodeEnum::LdelemI8:
-                ll_inst->set_opcode(OpCodeEnum::LdelemI8);
+                ll_inst->set_opcode(hl_inst->index_in_range ? OpCodeEnum::LdelemI8Unchecked : OpCodeEnum::LdelemI8);
                 break;
 
             case hl::OpCodeEnum::LdelemI:
-                ll_inst->set_opcode(OpCodeEnum::LdelemI);
+                ll_inst->set_opcode(hl_inst->index_in_range ? OpCodeEnum::LdelemIUnchecked : OpCodeEnum::LdelemI);
                 break;
 
             case hl::OpCodeEnum::LdelemR4:
-                ll_inst->set_opcode(OpCodeEnum::LdelemR4);
+                ll_inst->set_opcode(hl_inst->index_in_range ? OpCodeEnum::LdelemR4Unchecked : OpCodeEnum::LdelemR4);
                 break;
 
             case hl::OpCodeEnum::LdelemR8:
-                ll_inst->set_opcode(OpCodeEnum::LdelemR8);
+                ll_inst->set_opcode(hl_inst->index_in_range ? OpCodeEnum::LdelemR8Unchecked : OpCodeEnum::LdelemR8);
                 break;
 
             case hl::OpCodeEnum::LdelemRef:
-                ll_inst->set_opcode(OpCodeEnum::LdelemRef);
+                ll_inst->set_opcode(hl_inst->index_in_range ? OpCodeEnum::LdelemRefUnchecked : OpCodeEnum::LdelemRef);
                 break;
 
             case hl::OpCodeEnum::LdelemAny:
@@ -1474,31 +1534,31 @@ RtResultVoid Transformer::transform_instructions()
             }
 
             case hl::OpCodeEnum::StelemI1:
-                ll_inst->set_opcode(OpCodeEnum::StelemI1);
+                ll_inst->set_opcode(hl_inst->index_in_range ? OpCodeEnum::StelemI1Unchecked : OpCodeEnum::StelemI1);
                 break;
 
             case hl::OpCodeEnum::StelemI2:
-                ll_inst->set_opcode(OpCodeEnum::StelemI2);
+                ll_inst->set_opcode(hl_inst->index_in_range ? OpCodeEnum::StelemI2Unchecked : OpCodeEnum::StelemI2);
                 break;
 
             case hl::OpCodeEnum::StelemI4:
-                ll_inst->set_opcode(OpCodeEnum::StelemI4);
+                ll_inst->set_opcode(hl_inst->index_in_range ? OpCodeEnum::StelemI4Unchecked : OpCodeEnum::StelemI4);
                 break;
 
             case hl::OpCodeEnum::StelemI8:
-                ll_inst->set_opcode(OpCodeEnum::StelemI8);
+                ll_inst->set_opcode(hl_inst->index_in_range ? OpCodeEnum::StelemI8Unchecked : OpCodeEnum::StelemI8);
                 break;
 
             case hl::OpCodeEnum::StelemI:
-                ll_inst->set_opcode(OpCodeEnum::StelemI);
+                ll_inst->set_opcode(hl_inst->index_in_range ? OpCodeEnum::StelemIUnchecked : OpCodeEnum::StelemI);
                 break;
 
             case hl::OpCodeEnum::StelemR4:
-                ll_inst->set_opcode(OpCodeEnum::StelemR4);
+                ll_inst->set_opcode(hl_inst->index_in_range ? OpCodeEnum::StelemR4Unchecked : OpCodeEnum::StelemR4);
                 break;
 
             case hl::OpCodeEnum::StelemR8:
-                ll_inst->set_opcode(OpCodeEnum::StelemR8);
+                ll_inst->set_opcode(hl_inst->index_in_range ? OpCodeEnum::StelemR8Unchecked : OpCodeEnum::StelemR8);
                 break;
 
             case hl::OpCodeEnum::StelemRef:
@@ -1530,9 +1590,14 @@ RtResultVoid Transformer::transform_instructions()
                 break;
 
             case hl::OpCodeEnum::LdToken:
+            {
                 ll_inst->set_opcode(OpCodeEnum::LdToken);
-                setup_inst_resolved_data(ll_inst, (const void*)hl_inst->get_runtime_handle().get_handle_without_type());
+                metadata::RtRuntimeHandle handle = metadata::RtEncodedRuntimeHandle::decode(hl_inst->get_runtime_handle());
+                RtResolvedDataKind kind = handle.is_type() ? RtResolvedDataKind::TypeSig
+                                                           : (handle.is_field() ? RtResolvedDataKind::Field : RtResolvedDataKind::Method);
+                setup_inst_resolved_data(ll_inst, handle.value, kind);
                 break;
+            }
 
             case hl::OpCodeEnum::Ckfinite:
             {
@@ -1806,7 +1871,6 @@ RtResultVoid Transformer::transform_instructions()
                     }
                     break;
                 case metadata::RtArgOrLocOrFieldReduceType::I:
-                case metadata::RtArgOrLocOrFieldReduceType::Ref:
                     if (hl_inst->contains_prefix_unaligned())
                     {
                         op = utils::Platform::select_arch(OpCodeEnum::StfldI4Unaligned, OpCodeEnum::StfldI8Unaligned);
@@ -1817,9 +1881,23 @@ RtResultVoid Transformer::transform_instructions()
                                                   : utils::Platform::select_arch(OpCodeEnum::StfldI4, OpCodeEnum::StfldI8);
                     }
                     break;
+                case metadata::RtArgOrLocOrFieldReduceType::Ref:
+                    // reference fields are always pointer aligned
+                    op = use_large_addressing ? OpCodeEnum::StfldRefLarge : OpCodeEnum::StfldRef;
+                    break;
                 case metadata::RtArgOrLocOrFieldReduceType::Other:
-                    op = use_large_addressing ? OpCodeEnum::StfldAnyLarge : OpCodeEnum::StfldAny;
+                {
+                    DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL3(metadata::RtClass*, field_klass, vm::Class::get_class_from_typesig(field->type_sig));
+                    if (vm::Class::get_has_references(field_klass))
+                    {
+                        op = use_large_addressing ? OpCodeEnum::StfldAnyRefLarge : OpCodeEnum::StfldAnyRef;
+                    }
+                    else
+                    {
+                        op = use_large_addressing ? OpCodeEnum::StfldAnyLarge : OpCodeEnum::StfldAny;
+                    }
                     break;
+                }
                 default:
                     RET_ERR(core::RtErr::NotImplemented);
                 }
@@ -1864,8 +1942,8 @@ RtResultVoid Transformer::transform_instructions()
                 default:
                     RET_ERR(core::RtErr::NotImplemented);
                 }
-                ll_inst->set_opcode(op);
-                setup_inst_resolved_data(ll_inst, field);
+                ll_inst->set_opcode(select_no_cctor_opcode(op, field->parent));
+                setup_inst_resolved_data(ll_inst, field, RtResolvedDataKind::Field);
                 break;
             }
 
@@ -1876,12 +1954,12 @@ RtResultVoid Transformer::transform_instructions()
                 {
                     ll_inst->set_opcode(OpCodeEnum::LdsfldRvaData);
                     DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(const uint8_t*, rva_data, vm::Field::get_field_rva_data(field));
-                    setup_inst_resolved_data(ll_inst, rva_data);
+                    setup_inst_resolved_data(ll_inst, rva_data, RtResolvedDataKind::FieldRvaData, field);
                 }
                 else
                 {
-                    ll_inst->set_opcode(OpCodeEnum::Ldsflda);
-                    setup_inst_resolved_data(ll_inst, field);
+                    ll_inst->set_opcode(select_no_cctor_opcode(OpCodeEnum::Ldsflda, field->parent));
+                    setup_inst_resolved_data(ll_inst, field, RtResolvedDataKind::Field);
                 }
                 break;
             }
@@ -1919,17 +1997,26 @@ RtResultVoid Transformer::transform_instructions()
                 default:
                     RET_ERR(core::RtErr::NotImplemented);
                 }
-                ll_inst->set_opcode(op);
-                setup_inst_resolved_data(ll_inst, field);
+                ll_inst->set_opcode(select_no_cctor_opcode(op, field->parent));
+                setup_inst_resolved_data(ll_inst, field, RtResolvedDataKind::Field);
                 break;
             }
 
+            case hl::OpCodeEnum::CheckNull:
+                ll_inst->set_opcode(OpCodeEnum::CheckNull);
+                break;
+
+            case hl::OpCodeEnum::CountBackEdge:
+                ll_inst->set_opcode(OpCodeEnum::CountBackEdge);
+                break;
+
             case hl::OpCodeEnum::Call:
             {
                 DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(bool, handled, transform_special_call_methods(ll_inst, hl_inst));
                 if (!handled)
                 {
-                    ll_inst->set_opcode(OpCodeEnum::CallInterp);
+                    const metadata::RtMethodInfo* method = hl_inst->get_method();
+                    ll_inst->set_opcode(select_no_cctor_opcode(OpCodeEnum::CallInterp, vm::Method::is_static(method) ? method->parent : nullptr));
                     setup_inst_method(ll_inst, hl_inst);
                 }
                 break;
@@ -1937,7 +2024,7 @@ RtResultVoid Transformer::transform_instructions()
 
             case hl::OpCodeEnum::CallVirt:
                 ll_inst->set_opcode(OpCodeEnum::CallVirtInterp);
-                setup_inst_method(ll_inst, hl_inst);
+                setup_inst_virtual_call_cache(ll_inst, hl_inst->get_method());
                 break;
 
             case hl::OpCodeEnum::CallInternalCall:
@@ -1968,7 +2055,9 @@ RtResultVoid Transformer::transform_instructions()
                 break;
 
             case hl::OpCodeEnum::CallRuntimeImplemented:
-                ll_inst->set_opcode(OpCodeEnum::CallRuntimeImplemented);
+                // delegate Invoke enters single-cast interpreted targets without going through the native invoker
+                ll_inst->set_opcode(hl_inst->get_method()->invoke_method_ptr == vm::Delegate::invoke_delegate_invoker ? OpCodeEnum::InvokeDelegate
+                                                                                                                  : OpCodeEnum::CallRuntimeImplemented);
                 setup_inst_method(ll_inst, hl_inst);
                 break;
 
@@ -2010,12 +2099,12 @@ RtResultVoid Transformer::transform_instructions()
 
             case hl::OpCodeEnum::Ldftn:
                 ll_inst->set_opcode(OpCodeEnum::Ldftn);
-                setup_inst_resolved_data(ll_inst, hl_inst->get_method());
+                setup_inst_resolved_data(ll_inst, hl_inst->get_method(), RtResolvedDataKind::Method);
                 break;
 
             case hl::OpCodeEnum::Ldvirtftn:
                 ll_inst->set_opcode(OpCodeEnum::Ldvirtftn);
-                setup_inst_resolved_data(ll_inst, hl_inst->get_method());
+                setup_inst_virtual_call_cache(ll_inst, hl_inst->get_method());
                 break;
 
             case hl::OpCodeEnum::Throw:
@@ -2119,7 +2208,50 @@ RtResultVoid Transformer::transform_instructions()
 
 RtResultVoid Transformer::optimize_short_instructions()
 {
-    // TODO: Implement instruction optimization
+    // Start from the layout of the long forms and shrink every instruction whose operands fit its Short form.
+    // Shrinking never moves a branch target further away, so a choice made against an older layout stays valid;
+    // re-layout and repeat until no instruction shrinks any more.
+    bool changed = true;
+    while (changed)
+    {
+        changed = false;
+        layout_codes();
+        for (BasicBlock* cur_bb = _bb_head; cur_bb != nullptr; cur_bb = cur_bb->next_bb)
+        {
+            for (const GeneralInst* inst : cur_bb->insts)
+            {
+                OpCodeEnum short_opcode = ll::OpCodes::get_short_opcode(*inst);
+                if (short_opcode != OpCodeEnum::Illegal)
+                {
+                    const_cast<GeneralInst*>(inst)->set_opcode(short_opcode);
+                    changed = true;
+                }
+            }
+        }
+    }
+    RET_VOID_OK();
+}
+
+RtResultVoid Transformer::optimize_super_instructions()
+{
+    // A superinstruction keeps the layout of its first instruction and runs the following one inline,
+    // which stays in place, so neither offsets nor branch targets into the second instruction change.
+    GeneralInst* prev_inst = nullptr;
+    for (BasicBlock* cur_bb = _bb_head; cur_bb != nullptr; cur_bb = cur_bb->next_bb)
+    {
+        for (const GeneralInst* inst : cur_bb->insts)
+        {
+            if (prev_inst)
+            {
+                OpCodeEnum super_opcode = ll::OpCodes::get_super_opcode(prev_inst->get_opcode(), inst->get_opcode());
+                if (super_opcode != OpCodeEnum::Illegal)
+                {
+                    prev_inst->set_opcode(super_opcode);
+                }
+            }
+            prev_inst = const_cast<GeneralInst*>(inst);
+        }
+    }
     RET_VOID_OK();
 }
 
@@ -2135,7 +2267,7 @@ RtResultVoid Transformer::build_exception_clauses(RtInterpMethodInfo* interp_met
     }
 
     metadata::RtModuleDef* ass = _hl_transformer.get_module();
-    RtInterpExceptionClause* exception_clauses = ass->get_mem_pool().calloc_any<RtInterpExceptionClause>(exception_clause_count);
+    RtInterpExceptionClause* exception_clauses = _code_pool.get().calloc_any<RtInterpExceptionClause>(exception_clause_count);
     interp_method->exception_clauses = exception_clauses;
     interp_method->exception_clause_count = static_cast<uint8_t>(exception_clause_count);
 
@@ -2181,6 +2313,7 @@ RtResultVoid Transformer::build_exception_clauses(RtInterpMethodInfo* interp_met
         dst.ex_klass = ex_klass;
     }
 
+    InterpDefs::build_exception_ranges(interp_method, _code_pool.get());
     RET_VOID_OK();
 }
 
@@ -2197,14 +2330,9 @@ RtResult<uint32_t> Transformer::translate_il_offset_to_ir_offset(uint32_t il_off
     RET_ERR(core::RtErr::ExecutionEngine);
 }
 
-RtResultVoid Transformer::build_codes(RtInterpMethodInfo* interp_method)
+size_t Transformer::layout_codes()
 {
-    metadata::RtModuleDef* mod = _hl_transformer.get_module();
-
-    // First pass: calculate total size and set offsets
     size_t total_ir_size = 0;
-    BasicBlock* cur_bb = _bb_head;
-
     for (BasicBlock* cur_bb = _bb_head; cur_bb != nullptr; cur_bb = cur_bb->next_bb)
     {
         cur_bb->ir_offset = total_ir_size;
@@ -2212,14 +2340,20 @@ RtResultVoid Transformer::build_codes(RtInterpMethodInfo* interp_method)
         {
             GeneralInst* mutable_inst = const_cast<GeneralInst*>(inst);
             mutable_inst->set_ir_offset(total_ir_size);
-            total_ir_size += ll::OpCodes::get_instruction_size(inst->get_opcode(), *inst);
+            total_ir_size += THREADED_CODE_HEADER_SIZE + ll::OpCodes::get_instruction_size(inst->get_opcode(), *inst);
         }
     }
+    return total_ir_size;
+}
 
+RtResultVoid Transformer::build_codes(RtInterpMethodInfo* interp_method)
+{
+    // First pass: calculate total size and set offsets
+    size_t total_ir_size = layout_codes();
     interp_method->code_size = static_cast<uint32_t>(total_ir_size);
 
     // Second pass: write instructions
-    uint8_t* codes = (uint8_t*)mod->get_mem_pool().calloc_any<uint8_t>(total_ir_size);
+    uint8_t* codes = (uint8_t*)_code_pool.get().calloc_any<uint8_t>(total_ir_size);
     interp_method->codes = codes;
 
     uint8_t* codes_cur = codes;
@@ -2227,7 +2361,13 @@ RtResultVoid Transformer::build_codes(RtInterpMethodInfo* interp_method)
     {
         for (const GeneralInst* inst : cur_bb->insts)
         {
+#if LEANCLR_USE_DIRECT_THREADED_DISPATCHER
+            uint8_t* inst_codes = codes_cur;
+            codes_cur = ll::OpCodes::write_instruction_to_data(codes_cur + THREADED_CODE_HEADER_SIZE, *inst);
+            Interpreter::thread_instruction(inst_codes);
+#else
             codes_cur = ll::OpCodes::write_instruction_to_data(codes_cur, *inst);
+#endif
         }
     }
 
@@ -2240,6 +2380,10 @@ RtResultVoid Transformer::transform()
     RET_ERR_ON_FAIL(transform_basic_blocks());
     RET_ERR_ON_FAIL(transform_instructions());
     RET_ERR_ON_FAIL(optimize_short_instructions());
+    if (_hl_transformer.is_optimizing())
+    {
+        RET_ERR_ON_FAIL(optimize_super_instructions());
+    }
     RET_VOID_OK();
 }
 
@@ -2247,7 +2391,7 @@ RtResult<const RtInterpMethodInfo*> Transformer::build_interp_method_info()
 {
     const metadata::RtMethodInfo* method = _hl_transformer.get_method_info();
     metadata::RtModuleDef* mod = _hl_transformer.get_module();
-    alloc::MemPool& pool = mod->get_mem_pool();
+    alloc::MemPool& pool = _code_pool.get();
 
     RtInterpMethodInfo* interp_method = pool.malloc_any_zeroed<RtInterpMethodInfo>();
 
@@ -2261,10 +2405,17 @@ RtResult<const RtInterpMethodInfo*> Transformer::build_interp_method_info()
     interp_method->total_arg_and_local_stack_object_size = static_cast<uint16_t>(_hl_transformer.get_total_arg_and_local_stack_object_size());
     interp_method->max_stack_object_size = static_cast<uint16_t>(_hl_transformer.get_max_stack_size());
     interp_method->init_locals = _hl_transformer.need_init_locals();
+    interp_method->optimized = _hl_transformer.is_optimizing();
 
     RET_ERR_ON_FAIL(build_codes(interp_method));
     RET_ERR_ON_FAIL(build_exception_clauses(interp_method));
 
+    if (IrCache::is_recording())
+    {
+        IrCache::record_method(mod, method, interp_method, _resolved_data_sources.data(), _resolved_data_sources.size());
+    }
+
+    _code_pool.release_to(interp_method);
     RET_OK(interp_method);
 }
 
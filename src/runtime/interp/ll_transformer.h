@@ -2,6 +2,7 @@
 
 #include "transform_defs.h"
 #include "ll_opcodes.h"
+#include "code_cache.h"
 #include "utils/not_free_list.h"
 #include "utils/hashmap.h"
 
@@ -438,9 +439,7 @@ struct GeneralInst
 class Transformer
 {
   public:
-    Transformer(hl::Transformer& hl_trans, alloc::MemPool& mem_pool) : _hl_transformer(hl_trans), _mem_pool(mem_pool), _resolved_datas(&mem_pool)
-    {
-    }
+    Transformer(hl::Transformer& hl_trans, alloc::MemPool& mem_pool);
 
     RtResultVoid transform();
 
@@ -456,16 +455,21 @@ class Transformer
 
     hl::Transformer& _hl_transformer;
     alloc::MemPool& _mem_pool;
+    // the IR that outlives the transformation
+    MethodCodePool _code_pool;
     utils::HashMap<const hl::BasicBlock*, BasicBlock*> _hl_2_ll_bb_map;
     BasicBlock* _bb_head = nullptr;
     utils::NotFreeList<const void*> _resolved_datas;
+    utils::NotFreeList<RtResolvedDataSource> _resolved_data_sources;
     utils::HashMap<const void*, size_t> _resolved_data_2_index_map;
 
     // Helper functions
     RtResult<BasicBlock*> translate_hl_basic_to_ll_basic(const hl::BasicBlock* hl_bb);
     RtResultVoid transform_basic_blocks();
-    size_t get_resolved_data_index(const void* data);
-    void setup_inst_resolved_data(GeneralInst* ll_inst, const void* data);
+    size_t get_resolved_data_index(const void* data, RtResolvedDataKind kind, const void* source);
+    void setup_inst_resolved_data(GeneralInst* ll_inst, const void* data, RtResolvedDataKind kind, const void* source = nullptr);
+    void setup_inst_virtual_call_cache(GeneralInst* ll_inst, const metadata::RtMethodInfo* virtual_method);
+    void setup_inst_type_check_cache(GeneralInst* ll_inst, metadata::RtClass* klass);
     void setup_inst_klass(GeneralInst* ll_inst, const hl::GeneralInst* hl_inst);
     void setup_inst_method(GeneralInst* ll_inst, const hl::GeneralInst* hl_inst);
     utils::NotFreeList<size_t> find_finally_clause_idx_of_leave_target(const BasicBlock* leave_src, const BasicBlock* leave_target);
@@ -496,8 +500,10 @@ class Transformer
     RtResult<bool> transform_special_newobj_methods(GeneralInst* ll_inst, const hl::GeneralInst* hl_inst);
     RtResultVoid transform_instructions();
     RtResultVoid optimize_short_instructions();
+    RtResultVoid optimize_super_instructions();
     RtResultVoid build_exception_clauses(RtInterpMethodInfo* interp_method);
     RtResult<uint32_t> translate_il_offset_to_ir_offset(uint32_t il_offset);
+    size_t layout_codes();
     RtResultVoid build_codes(RtInterpMethodInfo* interp_method);
 };
 } // namespace leanclr::interp::ll
@@ -2,6 +2,7 @@
 #include "machine_state.h"
 
 #include "alloc/general_allocation.h"
+#include "gc/garbage_collector.h"
 #include "vm/settings.h"
 #include "interpreter.h"
 
@@ -70,8 +71,16 @@ RtResult<InterpFrame*> MachineState::enter_frame_from_native(const metadata::RtM
     {
         UNWRAP_OR_RET_ERR_ON_FAIL(imi, Interpreter::init_interpreter_method(method));
     }
+#if LEANCLR_ENABLE_TIERED_EXECUTION
+    else if (!imi->optimized)
+    {
+        UNWRAP_OR_RET_ERR_ON_FAIL(imi, Interpreter::tier_up_interpreter_method_if_hot(method));
+    }
+#endif
+    const_cast<RtInterpMethodInfo*>(imi)->recently_used = true;
     DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(InterpFrame*, frame, alloc_frame_stack());
     frame->method = method;
+    frame->imi = imi;
 
     const uint32_t method_max_stack = imi->max_stack_object_size;
     frame->old_eval_stack_top = get_eval_stack_top();
@@ -86,6 +95,7 @@ RtResult<InterpFrame*> MachineState::enter_frame_from_native(const metadata::RtM
     }
     frame->eval_stack_size = method_max_stack;
     frame->ip = imi->codes;
+    poll_gc_safepoint();
     RET_OK(frame);
 }
 
@@ -99,8 +109,16 @@ RtResult<InterpFrame*> MachineState::enter_frame_from_interp(const metadata::RtM
     {
         UNWRAP_OR_RET_ERR_ON_FAIL(imi, Interpreter::init_interpreter_method(method));
     }
+#if LEANCLR_ENABLE_TIERED_EXECUTION
+    else if (!imi->optimized)
+    {
+        UNWRAP_OR_RET_ERR_ON_FAIL(imi, Interpreter::tier_up_interpreter_method_if_hot(method));
+    }
+#endif
+    const_cast<RtInterpMethodInfo*>(imi)->recently_used = true;
     DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(InterpFrame*, frame, alloc_frame_stack());
     frame->method = method;
+    frame->imi = imi;
 
     const uint32_t method_max_stack = imi->max_stack_object_size;
     frame->old_eval_stack_top = get_eval_stack_top();
@@ -118,6 +136,7 @@ RtResult<InterpFrame*> MachineState::enter_frame_from_interp(const metadata::RtM
     std::memset(frame->eval_stack_base + arg_size, 0, (static_cast<size_t>(method_max_stack) - arg_size) * sizeof(RtStackObject));
 #endif
     frame->ip = imi->codes;
+    poll_gc_safepoint();
     RET_OK(frame);
 }
 
@@ -138,6 +157,20 @@ InterpFrame* MachineState::leave_frame(const MachineStateSavePoint& sp, InterpFr
     return frame - 1;
 }
 
+void MachineState::poll_gc_safepoint()
+{
+    if (_execution_depth == 1 && gc::GarbageCollector::is_collection_requested())
+    {
+        gc::GarbageCollector::collect();
+    }
+}
+
+void MachineState::mark_roots() const
+{
+    // the transformer emits no reference maps of frames, so any word of the eval stack may hold a reference
+    gc::GarbageCollector::mark_range_conservatively(_eval_stack_base, _eval_stack_base + _eval_stack_top);
+}
+
 uint32_t MachineState::enter_frame_from_icall_or_intrinsic(const metadata::RtMethodInfo* method)
 {
 #if LEANCLR_ENABLE_FRAME_TRACE
@@ -150,6 +183,7 @@ uint32_t MachineState::enter_frame_from_icall_or_intrinsic(const metadata::RtMet
         InterpFrame* frame = _frame_stack_base + _frame_stack_top;
         _frame_stack_top += 1;
         frame->method = method;
+        frame->imi = nullptr;
 #ifndef NDEBUG
         frame->eval_stack_base = nullptr;
         frame->eval_stack_size = 0;
@@ -12,6 +12,8 @@ namespace leanclr::interp
 struct InterpFrame
 {
     const metadata::RtMethodInfo* method;
+    // the code the frame runs, which may differ from method->interp_data once the method has been re-transformed
+    const RtInterpMethodInfo* imi;
     RtStackObject* eval_stack_base;
     uint32_t eval_stack_size;
     uint32_t old_eval_stack_top;
@@ -95,8 +97,21 @@ class MachineState
     uint32_t enter_frame_from_icall_or_intrinsic(const metadata::RtMethodInfo* method);
     void leave_frame_from_icall_or_intrinsic(uint32_t old_frame_top);
 
+    // Number of nested interpreter executions. Only the outermost one is a safepoint of the collector, inner ones were
+    // entered from native code that may hold object references.
+    uint32_t get_execution_depth() const
+    {
+        return _execution_depth;
+    }
+
+    // Run a requested collection if the machine state is at a safepoint.
+    void poll_gc_safepoint();
+    // The slot types of eval stacks are unknown, so every slot below the top is a potential reference.
+    void mark_roots() const;
+
   private:
     MachineState() = default;
+    friend struct MachineStateSavePoint;
 
     RtStackObject* _eval_stack_base = nullptr;
     uint32_t _eval_stack_size = 0;
@@ -104,6 +119,7 @@ class MachineState
     InterpFrame* _frame_stack_base = nullptr;
     uint32_t _frame_stack_size = 0;
     uint32_t _frame_stack_top = 0;
+    uint32_t _execution_depth = 0;
 };
 
 struct MachineStateSavePoint
@@ -112,11 +128,13 @@ struct MachineStateSavePoint
     {
         _machine_state->set_eval_stack_top(_old_eval_stack_top);
         _machine_state->set_frame_stack_top(_old_frame_stack_top);
+        --_machine_state->_execution_depth;
     }
 
     explicit MachineStateSavePoint(MachineState& ms)
         : _machine_state(&ms), _old_eval_stack_top(ms.get_eval_stack_top()), _old_frame_stack_top(ms.get_frame_stack_top())
     {
+        ++ms._execution_depth;
     }
 
     MachineState* _machine_state;
@@ -0,0 +1,70 @@
+#include <algorithm>
+#include <cstdio>
+
+#include "opcode_profiler.h"
+#include "alloc/general_allocation.h"
+#include "utils/rt_vector.h"
+
+namespace leanclr::interp
+{
+constexpr size_t kOpCodeCount = static_cast<size_t>(ll::OpCodeEnum::__Count);
+
+static uint64_t* s_pair_counts = nullptr;
+static ll::OpCodeEnum s_prev_opcode = ll::OpCodeEnum::Illegal;
+
+void OpcodeProfiler::record(ll::OpCodeEnum opcode)
+{
+    if (!s_pair_counts)
+    {
+        s_pair_counts = alloc::GeneralAllocation::calloc_any<uint64_t>(kOpCodeCount * kOpCodeCount);
+        assert(s_pair_counts);
+    }
+    ++s_pair_counts[static_cast<size_t>(s_prev_opcode) * kOpCodeCount + static_cast<size_t>(opcode)];
+    s_prev_opcode = opcode;
+}
+
+void OpcodeProfiler::reset()
+{
+    if (s_pair_counts)
+    {
+        std::memset(s_pair_counts, 0, kOpCodeCount * kOpCodeCount * sizeof(uint64_t));
+    }
+    s_prev_opcode = ll::OpCodeEnum::Illegal;
+}
+
+RtResultVoid OpcodeProfiler::write_pair_histogram(const char* file_path)
+{
+#if LEANCLR_ENABLE_OPCODE_PAIR_PROFILE
+    std::FILE* file = std::fopen(file_path, "w");
+    if (!file)
+    {
+        RET_ERR(RtErr::FileNotFound);
+    }
+    utils::Vector<size_t> pairs;
+    if (s_pair_counts)
+    {
+        // Pairs starting with Illegal are method entries from native code, not real successions.
+        for (size_t i = kOpCodeCount; i < kOpCodeCount * kOpCodeCount; i++)
+        {
+            if (s_pair_counts[i] != 0)
+            {
+                pairs.push_back(i);
+            }
+        }
+    }
+    std::sort(pairs.begin(), pairs.end(), [](size_t a, size_t b) { return s_pair_counts[a] > s_pair_counts[b]; });
+    std::fprintf(file, "# Dynamic LL opcode pair histogram: <first opcode> <second opcode> <count>\n");
+    for (size_t pair : pairs)
+    {
+        const char* first = ll::OpCodes::get_opcode_name(static_cast<ll::OpCodeEnum>(pair / kOpCodeCount));
+        const char* second = ll::OpCodes::get_opcode_name(static_cast<ll::OpCodeEnum>(pair % kOpCodeCount));
+        std::fprintf(file, "%s %s %llu\n", first, second, static_cast<unsigned long long>(s_pair_counts[pair]));
+    }
+    std::fclose(file);
+    RET_VOID_OK();
+#else
+    (void)file_path;
+    RET_ERR(RtErr::NotSupported);
+#endif
+}
+} // namespace leanclr::interp
@@ -0,0 +1,18 @@
+#pragma once
+
+#include "rt_base.h"
+#include "ll_opcodes.h"
+
+namespace leanclr::interp
+{
+// Histogram of dynamically adjacent LL opcodes. The interpreter feeds it from every handler when built with
+// LEANCLR_ENABLE_OPCODE_PAIR_PROFILE; gen_low_level_opcodes.py picks superinstructions from the written file.
+class OpcodeProfiler
+{
+  public:
+    static void record(ll::OpCodeEnum opcode);
+    static void reset();
+    // Writes "<first> <second> <count>" lines, hottest pair first.
+    static RtResultVoid write_pair_histogram(const char* file_path);
+};
+} // namespace leanclr::interp
@@ -56,6 +56,8 @@ struct Variable
     size_t byte_size;
     size_t stack_object_size;
     size_t eval_stack_offset;
+    // exact runtime class of the referenced object when known at transform time, e.g. the result of newobj; such a reference is never null
+    metadata::RtClass* exact_klass;
 
     bool is_i32_or_native_int() const
     {
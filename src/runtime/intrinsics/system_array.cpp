@@ -2,6 +2,8 @@
 
 #include "interp/eval_stack_op.h"
 #include "vm/rt_array.h"
+#include "vm/class.h"
+#include "gc/garbage_collector.h"
 
 namespace leanclr::intrinsics
 {
@@ -36,6 +38,10 @@ RtResultVoid SystemArray::set_generic_value_impl(vm::RtArray* arr, int32_t index
     uint8_t* dest_ptr = reinterpret_cast<uint8_t*>(const_cast<uint64_t*>(&arr->first_data)) + ele_size * static_cast<size_t>(index);
     const uint8_t* src_ptr = static_cast<const uint8_t*>(value);
     std::memcpy(dest_ptr, src_ptr, ele_size);
+    if (vm::Class::get_has_references(arr->klass))
+    {
+        gc::GarbageCollector::write_barrier_range(dest_ptr, ele_size);
+    }
     RET_VOID_OK();
 }
 
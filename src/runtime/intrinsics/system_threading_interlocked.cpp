@@ -3,6 +3,7 @@
 #include "core/rt_err.h"
 #include "interp/eval_stack_op.h"
 #include "vm/object.h"
+#include "gc/garbage_collector.h"
 
 namespace leanclr::intrinsics
 {
@@ -21,7 +22,7 @@ RtResult<vm::RtObject*> SystemThreadingInterlocked::exchange_object(vm::RtObject
     }
 
     vm::RtObject* old = *location;
-    *location = value;
+    gc::GarbageCollector::write_barrier(location, value);
     RET_OK(old);
 }
 
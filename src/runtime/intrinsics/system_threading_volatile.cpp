@@ -1,5 +1,6 @@
 #include "system_threading_volatile.h"
 #include "interp/eval_stack_op.h"
+#include "gc/garbage_collector.h"
 
 namespace leanclr::intrinsics
 {
@@ -158,7 +159,7 @@ RtResultVoid SystemThreadingVolatile::write_f64(double* location, double value)
 
 RtResultVoid SystemThreadingVolatile::write_ref(vm::RtObject** location, vm::RtObject* value)
 {
-    *location = value;
+    gc::GarbageCollector::write_barrier(location, value);
     RET_VOID_OK();
 }
 
@@ -3,6 +3,7 @@
 #include "utils/mem_op.h"
 #include "vm/generic_class.h"
 #include "metadata/module_def.h"
+#include "alloc/metadata_allocation.h"
 
 namespace leanclr::metadata
 {
@@ -147,4 +148,94 @@ RtResult<SizeAndAlignment> Layout::compute_explicit_layout(RtModuleDef* mod, uti
     RET_OK(result);
 }
 
+static void set_reference_bits(uint8_t* bitmap, uint32_t slot_begin, const uint8_t* source_bitmap, uint32_t source_slot_count)
+{
+    for (uint32_t i = 0; i < source_slot_count; ++i)
+    {
+        if (source_bitmap[i / 8] & (1u << (i % 8)))
+        {
+            const uint32_t slot = slot_begin + i;
+            bitmap[slot / 8] |= static_cast<uint8_t>(1u << (slot % 8));
+        }
+    }
+}
+
+static uint32_t get_reference_slot_count(uint32_t size)
+{
+    return static_cast<uint32_t>((size + PTR_SIZE - 1) / PTR_SIZE);
+}
+
+static RtResult<RtClass*> get_value_class_with_references(const RtTypeSig* typeSig)
+{
+    DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(RtClass*, value_class, vm::Class::get_class_from_typesig(typeSig));
+    RET_ERR_ON_FAIL(vm::Class::initialize_fields(value_class));
+    RET_OK(value_class->reference_bitmap ? value_class : nullptr);
+}
+
+// Returns the class of a value type field that contains references, or null for fields that are references themselves or
+// contain none. `is_reference` is set for reference fields.
+static RtResult<RtClass*> get_reference_field_value_class(const RtTypeSig* typeSig, bool& is_reference)
+{
+    is_reference = false;
+    if (typeSig->by_ref)
+    {
+        RET_OK(static_cast<RtClass*>(nullptr));
+    }
+    switch (typeSig->ele_type)
+    {
+    case RtElementType::Object:
+    case RtElementType::String:
+    case RtElementType::Class:
+    case RtElementType::Array:
+    case RtElementType::SZArray:
+        is_reference = true;
+        RET_OK(static_cast<RtClass*>(nullptr));
+    case RtElementType::GenericInst:
+    {
+        DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(RtClass*, base_class, vm::GenericClass::get_base_class(typeSig->data.generic_class));
+        if (vm::Class::is_reference_type(base_class))
+        {
+            is_reference = true;
+            RET_OK(static_cast<RtClass*>(nullptr));
+        }
+        return get_value_class_with_references(typeSig);
+    }
+    case RtElementType::ValueType:
+        return get_value_class_with_references(typeSig);
+    default:
+        RET_OK(static_cast<RtClass*>(nullptr));
+    }
+}
+
+RtResult<const uint8_t*> Layout::compute_reference_bitmap(RtClass* klass, const utils::Vector<const RtFieldInfo*>& fields)
+{
+    const uint32_t slot_count = get_reference_slot_count(klass->instance_size_without_header);
+    uint8_t* bitmap = alloc::MetadataAllocation::calloc_any<uint8_t>((slot_count + 7) / 8);
+    if (klass->parent && klass->parent->reference_bitmap)
+    {
+        const uint32_t parent_slot_count = get_reference_slot_count(klass->parent->instance_size_without_header);
+        set_reference_bits(bitmap, 0, klass->parent->reference_bitmap, std::min(parent_slot_count, slot_count));
+    }
+    for (const RtFieldInfo* field : fields)
+    {
+        bool is_reference;
+        DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(RtClass*, value_class, get_reference_field_value_class(field->type_sig, is_reference));
+        // references are pointer aligned in every layout the runtime accepts, misplaced ones of explicit layouts are not traced
+        if ((!is_reference && !value_class) || field->offset % PTR_SIZE != 0)
+        {
+            continue;
+        }
+        const uint32_t slot = field->offset / static_cast<uint32_t>(PTR_SIZE);
+        if (is_reference)
+        {
+            bitmap[slot / 8] |= static_cast<uint8_t>(1u << (slot % 8));
+        }
+        else
+        {
+            set_reference_bits(bitmap, slot, value_class->reference_bitmap, get_reference_slot_count(value_class->instance_size_without_header));
+        }
+    }
+    RET_OK(static_cast<const uint8_t*>(bitmap));
+}
+
 } // namespace leanclr::metadata
@@ -18,5 +18,7 @@ class Layout
     static RtResult<SizeAndAlignment> get_field_size_and_alignment(RtTypeSig* typeSig);
     static RtResult<SizeAndAlignment> compute_layout(utils::Vector<const RtFieldInfo*>& fields, uint32_t parentSize, uint8_t parentAlignment, uint8_t packing);
     static RtResult<SizeAndAlignment> compute_explicit_layout(RtModuleDef* mod, utils::Vector<const RtFieldInfo*>& fields, uint8_t packing);
+    // Reference bitmap of a laid out class whose instance fields contain references, covering the fields of its parents too.
+    static RtResult<const uint8_t*> compute_reference_bitmap(RtClass* klass, const utils::Vector<const RtFieldInfo*>& fields);
 };
 } // namespace leanclr::metadata
@@ -145,6 +145,19 @@ RtResult<vm::RtString*> RtModuleDef::get_user_string(uint32_t index)
     RET_ERR(RtErr::BadImageFormat);
 }
 
+bool RtModuleDef::find_user_string_index(const vm::RtString* str, uint32_t& index) const
+{
+    for (const auto& pair : _userStringMap)
+    {
+        if (pair.second == str)
+        {
+            index = pair.first;
+            return true;
+        }
+    }
+    return false;
+}
+
 RtResultVoid RtModuleDef::load()
 {
     _id = allocate_image_id();
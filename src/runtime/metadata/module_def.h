@@ -210,6 +210,12 @@ class RtModuleDef
 
     RtResult<utils::BinaryReader> get_decoded_blob_reader(uint32_t index) const;
     RtResult<vm::RtString*> get_user_string(uint32_t index);
+    const utils::HashMap<uint32_t, vm::RtString*>& get_user_strings() const
+    {
+        return _userStringMap;
+    }
+    // Reverse lookup of get_user_string, scanning the strings loaded so far.
+    bool find_user_string_index(const vm::RtString* str, uint32_t& index) const;
 
     RtResultVoid load();
     RtResultVoid setup_assembly_name();
@@ -551,6 +551,9 @@ struct RtMethodInfo
     uint16_t total_arg_stack_object_size;
     uint16_t ret_stack_object_size;
     RtInvokerType invoker_type;
+    // tiered execution counters, only updated while interp_data is not optimized
+    uint32_t invocation_count;
+    uint32_t back_edge_count;
 };
 
 // Property information structure
@@ -666,13 +669,17 @@ struct RtClass
     const RtPropertyInfo* properties;
     const RtVirtualInvokeData* vtable;
     const RtInterfaceOffset* interface_vtable_offsets;
+    const RtInterfaceOffset* interface_offset_table; // open addressing hash table of interface_vtable_offsets, null for short lists
     uint8_t* static_fields_data;
+    // one bit per pointer-sized slot of the instance data, set for slots holding object references; null without references
+    const uint8_t* reference_bitmap;
     EncodedTokenId token;
     uint32_t instance_size_without_header;
     uint32_t static_size;
     uint32_t flags;
     uint32_t extra_flags;
     uint32_t init_flags;
+    uint32_t interface_offset_table_mask;
     uint16_t nested_class_count; // TODO, may be we can optimize out it
     uint16_t interface_count;
     uint16_t interface_vtable_offset_count;
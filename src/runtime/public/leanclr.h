@@ -101,6 +101,23 @@ extern "C"
     LEANCLR_API void leanclr_invoke_with_buffer(const LeanclrMethodInfo* method, const LeanclrStackObject* arg_buff, LeanclrStackObject* ret_buff,
                                                 LeanclrException** out_exception);
 
+    // Writes the LL opcode pair histogram consumed by gen_low_level_opcodes.py. Requires LEANCLR_ENABLE_OPCODE_PAIR_PROFILE.
+    LEANCLR_API int32_t leanclr_write_opcode_pair_profile(const char* file_path);
+
+    // Hands the IR caches of the methods transformed so far to the IR cache writer set in vm::Settings. Does nothing without a writer.
+    LEANCLR_API int32_t leanclr_save_ir_caches();
+
+    // Peak number of bytes the reusable scratch arena of method transformation held for a single method.
+    LEANCLR_API size_t leanclr_get_transform_arena_high_water_mark();
+
+    // Bytes and methods resident in the budgeted IR code cache, and the number of methods evicted from it so far.
+    LEANCLR_API void leanclr_get_ir_code_cache_stats(size_t* out_resident_bytes, size_t* out_resident_method_count, size_t* out_eviction_count);
+
+    // Spends about budget_us microseconds on garbage collection: advances the incremental collection in progress, or starts one
+    // once a full collection is due. Call it outside managed code, such as at the end of a frame, or from an internal call that the
+    // outermost managed code calls. Returns whether an incremental collection is left unfinished.
+    LEANCLR_API bool leanclr_gc_step(int64_t budget_us);
+
 #define LEANCLR_DECLARING_ALLOC_METHOD_ARGUMENT_BUFFER(arg_buff_name, offset, method)                                                             \
     LeanclrStackObject* arg_buff_name = (LeanclrStackObject*)alloca(leanclr_get_total_arg_stack_object_size(method) * LEANCLR_STACK_OBJECT_SIZE); \
     size_t offset = 0;
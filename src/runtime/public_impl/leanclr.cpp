@@ -11,6 +11,11 @@
 #include "vm/assembly.h"
 #include "vm/class.h"
 #include "metadata/module_def.h"
+#include "interp/opcode_profiler.h"
+#include "interp/ir_cache.h"
+#include "interp/interpreter.h"
+#include "interp/code_cache.h"
+#include "gc/garbage_collector.h"
 
 using namespace leanclr;
 
@@ -354,6 +359,43 @@ extern "C"
         }
     }
 
+    int32_t leanclr_write_opcode_pair_profile(const char* file_path)
+    {
+        auto ret = interp::OpcodeProfiler::write_pair_histogram(file_path);
+        if (ret.is_ok())
+            return 0;
+        else
+            return (int32_t)ret.unwrap_err();
+    }
+
+    int32_t leanclr_save_ir_caches()
+    {
+        auto ret = interp::IrCache::save();
+        if (ret.is_ok())
+            return 0;
+        else
+            return (int32_t)ret.unwrap_err();
+    }
+
+    size_t leanclr_get_transform_arena_high_water_mark()
+    {
+        return interp::Interpreter::get_transform_arena_high_water_mark();
+    }
+
+    void leanclr_get_ir_code_cache_stats(size_t* out_resident_bytes, size_t* out_resident_method_count, size_t* out_eviction_count)
+    {
+        interp::CodeCacheStats stats;
+        interp::CodeCache::get_stats(stats);
+        *out_resident_bytes = stats.resident_bytes;
+        *out_resident_method_count = stats.resident_method_count;
+        *out_eviction_count = stats.eviction_count;
+    }
+
+    bool leanclr_gc_step(int64_t budget_us)
+    {
+        return gc::GarbageCollector::step(budget_us);
+    }
+
 #ifdef __cplusplus
 }
 #endif
\ No newline at end of file
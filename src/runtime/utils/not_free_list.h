@@ -23,7 +23,7 @@ class NotFreeList
 
     NotFreeList(alloc::MemPool* pool, std::size_t capacity) : size_(0), pool_(pool)
     {
-        data_ = pool->calloc_any<V>(capacity);
+        data_ = pool->malloc_any_uninitialized<V>(capacity);
         capacity_ = capacity;
     }
 
@@ -32,7 +32,7 @@ class NotFreeList
         NotFreeList list(pool);
         if (capacity > 0)
         {
-            list.data_ = pool ? pool->calloc_any<V>(capacity) : nullptr;
+            list.data_ = pool ? pool->malloc_any_uninitialized<V>(capacity) : nullptr;
             list.capacity_ = capacity;
         }
         return list;
@@ -67,7 +67,7 @@ class NotFreeList
             return;
         }
         assert(pool_ != nullptr);
-        V* new_data = pool_ ? pool_->calloc_any<V>(new_capacity) : nullptr;
+        V* new_data = pool_ ? pool_->malloc_any_uninitialized<V>(new_capacity) : nullptr;
         if (data_ && new_data)
         {
             std::memcpy(new_data, data_, size_ * sizeof(V));
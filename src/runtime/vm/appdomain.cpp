@@ -4,6 +4,7 @@
 #include "object.h"
 #include "rt_string.h"
 #include "rt_thread.h"
+#include "gc/garbage_collector.h"
 #include "utils/hashmap.h"
 #include "utils/string_util.h"
 #include "metadata/module_def.h"
@@ -163,4 +164,20 @@ utils::Span<metadata::RtModuleDef*> AppDomain::get_modules()
 {
     return metadata::RtModuleDef::get_registered_modules();
 }
+
+void AppDomain::mark_roots()
+{
+    gc::GarbageCollector::mark_object(g_default_appdomain);
+    if (g_default_mono_domain != nullptr)
+    {
+        gc::GarbageCollector::mark_object(g_default_mono_domain->appdomain);
+        gc::GarbageCollector::mark_object(g_default_mono_domain->setup);
+        gc::GarbageCollector::mark_object(reinterpret_cast<RtObject*>(g_default_mono_domain->context));
+        gc::GarbageCollector::mark_object(g_default_mono_domain->ephemeron_tombstone);
+    }
+    for (const auto& pair : g_appdomain_private_data)
+    {
+        gc::GarbageCollector::mark_object(pair.second);
+    }
+}
 } // namespace leanclr::vm
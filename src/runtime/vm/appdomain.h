@@ -25,5 +25,8 @@ class AppDomain
     static int32_t get_appdomain_id();
 
     static utils::Span<metadata::RtModuleDef*> get_modules();
+
+    // Mark the default domain, its context and the domain data for the collector
+    static void mark_roots();
 };
 } // namespace leanclr::vm
@@ -139,6 +139,7 @@ RtResultVoid Class::init_corlib_classes(metadata::RtModuleDef* corlib)
     UNWRAP_OR_RET_ERR_ON_FAIL(t.cls_calendardata, get_class_must_exist(corlib, "System.Globalization.CalendarData"));
 
     UNWRAP_OR_RET_ERR_ON_FAIL(t.cls_stackframe, get_class_must_exist(corlib, "System.Diagnostics.StackFrame"));
+    UNWRAP_OR_RET_ERR_ON_FAIL(t.cls_stacktrace, get_class_must_exist(corlib, "System.Diagnostics.StackTrace"));
 
     RET_VOID_OK();
 }
@@ -1237,6 +1238,10 @@ RtResultVoid Class::setup_field_layout(metadata::RtClass* klass)
         klass->instance_size_without_header = std::max(klass->instance_size_without_header, (uint32_t)1);
     }
     klass->alignment = instanceSizeAndAlignment.alignment;
+    if (has_references)
+    {
+        UNWRAP_OR_RET_ERR_ON_FAIL(klass->reference_bitmap, metadata::Layout::compute_reference_bitmap(klass, instanceFields));
+    }
 
     DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(metadata::SizeAndAlignment, staticSizeAndAlignment, metadata::Layout::compute_layout(staticFields, 0, 1, 0));
     klass->static_size = staticSizeAndAlignment.size;
@@ -1637,10 +1642,76 @@ RtResultVoid Class::initialize_vtables(metadata::RtClass* klass)
         break;
     }
     }
+    setup_interface_offset_table(klass);
 
     RET_VOID_OK();
 }
 
+// Interface lists up to this length are searched linearly, which is as fast as hashing.
+static const size_t INTERFACE_OFFSET_TABLE_MIN_COUNT = 4;
+
+static size_t get_interface_offset_table_slot(const metadata::RtClass* interface_klass, size_t mask)
+{
+    // classes are allocated from memory pools with at least pointer alignment, so the low bits carry no information
+    size_t h = reinterpret_cast<size_t>(interface_klass) >> 3;
+    return (h ^ (h >> 9)) & mask;
+}
+
+void Class::setup_interface_offset_table(metadata::RtClass* klass)
+{
+    size_t count = klass->interface_vtable_offset_count;
+    if (count < INTERFACE_OFFSET_TABLE_MIN_COUNT)
+        return;
+
+    // keep the load factor at or below one half so probe sequences stay short
+    size_t table_size = 1;
+    while (table_size < count * 2)
+        table_size <<= 1;
+    size_t mask = table_size - 1;
+    metadata::RtInterfaceOffset* table = klass->image->get_mem_pool().calloc_any<metadata::RtInterfaceOffset>(table_size);
+    for (size_t i = 0; i < count; ++i)
+    {
+        const metadata::RtInterfaceOffset& offset = klass->interface_vtable_offsets[i];
+        size_t slot = get_interface_offset_table_slot(offset.interface, mask);
+        while (table[slot].interface)
+        {
+            // an interface may be listed more than once; the first entry wins, as with the linear search
+            if (table[slot].interface == offset.interface)
+                break;
+            slot = (slot + 1) & mask;
+        }
+        if (!table[slot].interface)
+            table[slot] = offset;
+    }
+    klass->interface_offset_table = table;
+    klass->interface_offset_table_mask = static_cast<uint32_t>(mask);
+}
+
+const metadata::RtInterfaceOffset* Class::find_interface_offset(metadata::RtClass* klass, metadata::RtClass* interface_klass)
+{
+    const metadata::RtInterfaceOffset* table = klass->interface_offset_table;
+    if (table)
+    {
+        size_t mask = klass->interface_offset_table_mask;
+        size_t slot = get_interface_offset_table_slot(interface_klass, mask);
+        while (table[slot].interface)
+        {
+            if (table[slot].interface == interface_klass)
+                return table + slot;
+            slot = (slot + 1) & mask;
+        }
+        return nullptr;
+    }
+
+    const metadata::RtInterfaceOffset* offsets = klass->interface_vtable_offsets;
+    for (size_t i = 0; i < klass->interface_vtable_offset_count; ++i)
+    {
+        if (offsets[i].interface == interface_klass)
+            return offsets + i;
+    }
+    return nullptr;
+}
+
 static void collect_virtual_methods(metadata::RtClass* klass, utils::Vector<const metadata::RtMethodInfo*>& virtualMethods)
 {
     if (klass->parent)
@@ -2250,6 +2321,11 @@ bool Class::is_assignable_from_class(metadata::RtClass* fromClass, metadata::RtC
 bool Class::is_assignable_from_interface(metadata::RtClass* fromClass, metadata::RtClass* toClass)
 {
     assert(has_initialized_part(fromClass, metadata::RtClassInitPart::SuperTypes));
+    // the hashed interface offsets cover the interfaces of the whole class chain
+    if (fromClass->interface_offset_table)
+    {
+        return find_interface_offset(fromClass, toClass) != nullptr;
+    }
     metadata::RtClass* currentClass = fromClass;
     while (currentClass != nullptr)
     {
@@ -110,6 +110,7 @@ struct CorLibTypes
     metadata::RtClass* cls_calendardata;
 
     metadata::RtClass* cls_stackframe;
+    metadata::RtClass* cls_stacktrace;
 };
 
 class Class
@@ -131,6 +132,8 @@ class Class
     static RtResultVoid initialize_properties(metadata::RtClass* klass);
     static RtResultVoid initialize_events(metadata::RtClass* klass);
     static RtResultVoid initialize_vtables(metadata::RtClass* klass);
+    static void setup_interface_offset_table(metadata::RtClass* klass);
+    static const metadata::RtInterfaceOffset* find_interface_offset(metadata::RtClass* klass, metadata::RtClass* interface_klass);
 
     static bool has_initialized_part(metadata::RtClass* klass, metadata::RtClassInitPart parts);
     static void set_initialized_part(metadata::RtClass* klass, metadata::RtClassInitPart parts);
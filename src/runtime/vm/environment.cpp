@@ -3,6 +3,7 @@
 #include "class.h"
 #include "rt_array.h"
 #include "rt_array.h"
+#include "gc/garbage_collector.h"
 #include "utils/hashmap.h"
 #include "utils/string_util.h"
 #include "utils/string_builder.h"
@@ -193,4 +194,12 @@ int32_t Environment::get_page_size()
     return 4096;
 }
 
+void Environment::mark_roots()
+{
+    gc::GarbageCollector::mark_object(g_cmdline_args);
+    for (const auto& pair : s_environment_variables_map)
+    {
+        gc::GarbageCollector::mark_object(pair.second);
+    }
+}
 } // namespace leanclr::vm
@@ -47,5 +47,8 @@ class Environment
 
     static int32_t get_processor_count();
     static int32_t get_page_size();
+
+    // Mark the command line arguments and environment variables for the collector
+    static void mark_roots();
 };
 } // namespace leanclr::vm
@@ -13,6 +13,7 @@
 #include "metadata/module_def.h"
 #include "metadata/generic_metadata.h"
 #include "metadata/metadata_const.h"
+#include "gc/garbage_collector.h"
 
 namespace leanclr::vm
 {
@@ -160,6 +161,7 @@ RtResultVoid Field::set_instance_value(const metadata::RtFieldInfo* field, void*
 
     uint8_t* target = static_cast<uint8_t*>(obj) + field->offset;
     std::memcpy(target, value, size);
+    gc::GarbageCollector::write_barrier_range(target, size);
 
     RET_VOID_OK();
 }
@@ -283,11 +285,12 @@ RtResultVoid Field::set_value_object(const metadata::RtFieldInfo* field, RtObjec
         uint8_t* value_data_ptr = reinterpret_cast<uint8_t*>(value) + vm::RT_OBJECT_HEADER_SIZE;
         DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(size_t, size, get_field_size(field));
         std::memcpy(fieldDataPtr, value_data_ptr, size);
+        gc::GarbageCollector::write_barrier_range(fieldDataPtr, size);
     }
     else
     {
         // Reference type: direct assignment
-        *reinterpret_cast<void**>(fieldDataPtr) = value;
+        gc::GarbageCollector::write_barrier(reinterpret_cast<RtObject**>(fieldDataPtr), value);
     }
 
     RET_VOID_OK();
@@ -1,5 +1,7 @@
 #include "gc.h"
 #include "appdomain.h"
+#include "gc/garbage_collector.h"
+#include "interp/machine_state.h"
 
 namespace leanclr::vm
 {
@@ -16,18 +18,19 @@ void GC::register_ephemeron_array(vm::RtObject* arr)
 
 int32_t GC::get_collection_count(int32_t generation)
 {
-    (void)generation;
-    return 0;
+    return gc::GarbageCollector::get_collection_count(generation);
 }
 
 int32_t GC::get_max_generation()
 {
-    return 0;
+    return gc::GarbageCollector::MAX_GENERATION;
 }
 
 void GC::internal_collect(int32_t generation)
 {
-    (void)generation;
+    // called from a nested execution, the collection waits for the next safepoint
+    gc::GarbageCollector::request_collection(generation);
+    interp::MachineState::get_global_machine_state().poll_gc_safepoint();
 }
 
 void GC::record_pressure(int64_t bytes)
@@ -37,13 +40,12 @@ void GC::record_pressure(int64_t bytes)
 
 int64_t GC::get_allocated_bytes_for_current_thread()
 {
-    return 0;
+    return static_cast<int64_t>(gc::GarbageCollector::get_total_allocated_bytes());
 }
 
 int32_t GC::get_generation(vm::RtObject* obj)
 {
-    (void)obj;
-    return 0;
+    return gc::GarbageCollector::get_generation(obj);
 }
 
 void GC::wait_for_pending_finalizers()
@@ -62,8 +64,11 @@ void GC::reregister_for_finalize(vm::RtObject* obj)
 
 int64_t GC::get_total_memory(bool force_full_collection)
 {
-    (void)force_full_collection;
-    return 0;
+    if (force_full_collection)
+    {
+        internal_collect(get_max_generation());
+    }
+    return static_cast<int64_t>(gc::GarbageCollector::get_heap_size());
 }
 
 } // namespace leanclr::vm
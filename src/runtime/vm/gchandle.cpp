@@ -4,6 +4,8 @@
 #include "class.h"
 #include "metadata/metadata_cache.h"
 #include "alloc/general_allocation.h"
+#include "gc/garbage_collector.h"
+#include "utils/rt_vector.h"
 
 namespace leanclr::vm
 {
@@ -25,6 +27,8 @@ struct HandleInfo
 
 // Head of the freed handle list
 static HandleInfo* s_freed_handle_head = nullptr;
+// Every handle ever allocated, freed ones included, for the collector
+static utils::Vector<HandleInfo*> s_handles;
 
 // Allocate a new handle or reuse a freed one
 static HandleInfo* alloc_handle()
@@ -33,6 +37,7 @@ static HandleInfo* alloc_handle()
     {
         // Allocate a new handle
         HandleInfo* h = alloc::GeneralAllocation::malloc_any_zeroed<HandleInfo>();
+        s_handles.push_back(h);
         return h;
     }
     else
@@ -51,8 +56,7 @@ static void free_handle_impl(HandleInfo* handle)
     {
         return;
     }
-    assert(handle->obj != nullptr);
-    // Reset handle and add to freed list
+    // Reset handle and add to freed list, the target of a weak handle may already have been collected
     handle->obj = nullptr;
     handle->type_ = GCHandleType::Normal;
     handle->next = s_freed_handle_head;
@@ -158,4 +162,32 @@ bool GCHandle::is_type_pinned(metadata::RtClass* klass)
     return Class::is_string_class(klass) || Class::is_blittable(klass);
 }
 
+static bool is_weak(GCHandleType type_)
+{
+    return type_ == GCHandleType::Weak || type_ == GCHandleType::WeakTrackResurrection;
+}
+
+void GCHandle::mark_roots()
+{
+    for (HandleInfo* h : s_handles)
+    {
+        if (!is_weak(h->type_))
+        {
+            gc::GarbageCollector::mark_object(h->obj);
+        }
+    }
+}
+
+void GCHandle::clear_collected_weak_targets()
+{
+    // without finalizers there is nothing to resurrect, so both weak kinds lose their targets at once
+    for (HandleInfo* h : s_handles)
+    {
+        if (is_weak(h->type_) && h->obj != nullptr && !gc::GarbageCollector::is_marked(h->obj))
+        {
+            h->obj = nullptr;
+        }
+    }
+}
+
 } // namespace leanclr::vm
@@ -13,5 +13,10 @@ class GCHandle
     static void* get_target_handle(RtObject* obj, void* handle, int32_t handle_type);
     static void* get_addr_of_pinned_object(void* handle);
     static bool is_type_pinned(metadata::RtClass* klass);
+
+    // Mark the targets of normal and pinned handles for the collector
+    static void mark_roots();
+    // Clear weak handles whose targets the running collection found unreachable
+    static void clear_collected_weak_targets();
 };
 } // namespace leanclr::vm
@@ -18,6 +18,8 @@
 #include "metadata/metadata_compare.h"
 #include "metadata/module_def.h"
 #include "interp/interp_defs.h"
+#include "utils/hash_util.h"
+#include "utils/hashmap.h"
 
 namespace leanclr::vm
 {
@@ -25,6 +27,35 @@ using namespace leanclr::metadata;
 using namespace leanclr::core;
 using namespace leanclr::utils;
 
+namespace
+{
+struct GenericVirtualMethodKey
+{
+    const RtMethodInfo* virtual_method;
+    RtClass* klass;
+};
+
+struct GenericVirtualMethodKeyHash
+{
+    size_t operator()(const GenericVirtualMethodKey& key) const noexcept
+    {
+        size_t h = std::hash<const void*>()(key.virtual_method);
+        return HashUtil::combine_hash(h, std::hash<RtClass*>()(key.klass));
+    }
+};
+
+struct GenericVirtualMethodKeyEqual
+{
+    bool operator()(const GenericVirtualMethodKey& a, const GenericVirtualMethodKey& b) const noexcept
+    {
+        return a.virtual_method == b.virtual_method && a.klass == b.klass;
+    }
+};
+} // namespace
+
+// Overrides of generic virtual method instantiations resolved per receiver class
+static HashMap<GenericVirtualMethodKey, const RtMethodInfo*, GenericVirtualMethodKeyHash, GenericVirtualMethodKeyEqual> s_generic_virtual_method_impl_map;
+
 // Helper: compare method signatures (optionally including name)
 static bool is_method_signature_equal(const RtMethodInfo* a, const RtMethodInfo* b, bool compareName, bool compareGenericParamByIndex)
 {
@@ -79,17 +110,11 @@ const RtMethodInfo* Method::get_vtable_method(RtClass* klass, size_t method_inde
 
 RtResult<const RtVirtualInvokeData*> Method::get_interface_method_invoke_data(RtClass* klass, RtClass* interface_klass, size_t slot)
 {
-    const RtInterfaceOffset* offsets = klass->interface_vtable_offsets;
-    for (size_t i = 0; i < klass->interface_vtable_offset_count; ++i)
-    {
-        const RtInterfaceOffset& off = offsets[i];
-        if (off.interface == interface_klass)
-        {
-            size_t vtable_index = static_cast<size_t>(off.offset) + slot;
-            RET_OK(klass->vtable + vtable_index);
-        }
-    }
-    RET_ERR(RtErr::MethodAccess);
+    const RtInterfaceOffset* off = Class::find_interface_offset(klass, interface_klass);
+    if (!off)
+        RET_ERR(RtErr::MethodAccess);
+    size_t vtable_index = static_cast<size_t>(off->offset) + slot;
+    RET_OK(klass->vtable + vtable_index);
 }
 
 RtResult<const RtMethodInfo*> Method::get_virtual_method_impl(RtObject* obj, const RtMethodInfo* virtual_method)
@@ -119,19 +144,29 @@ RtResult<const RtMethodInfo*> Method::get_virtual_method_impl_on_klass(RtClass*
     }
     if (actual_method->generic_container)
     {
+        const GenericVirtualMethodKey key{virtual_method, klass};
+        auto it = s_generic_virtual_method_impl_map.find(key);
+        if (it != s_generic_virtual_method_impl_map.end())
+        {
+            RET_OK(it->second);
+        }
+
         const metadata::RtGenericInst* method_inst = virtual_method->generic_method->generic_context.method_inst;
         const metadata::RtGenericMethod* actual_generic_method = actual_method->generic_method;
+        const RtMethodInfo* inflated_method;
         if (actual_generic_method)
         {
             const metadata::RtGenericInst* class_inst = actual_generic_method->generic_context.class_inst;
             DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(const metadata::RtMethodInfo*, method_def_base,
                                                     get_method_by_method_def_gid(actual_generic_method->base_method_gid));
-            return GenericMethod::get_method(method_def_base, class_inst, method_inst);
+            UNWRAP_OR_RET_ERR_ON_FAIL(inflated_method, GenericMethod::get_method(method_def_base, class_inst, method_inst));
         }
         else
         {
-            return GenericMethod::get_method(actual_method, nullptr, method_inst);
+            UNWRAP_OR_RET_ERR_ON_FAIL(inflated_method, GenericMethod::get_method(actual_method, nullptr, method_inst));
         }
+        s_generic_virtual_method_impl_map.insert({key, inflated_method});
+        RET_OK(inflated_method);
     }
 
     RET_OK(actual_method);
@@ -17,6 +17,7 @@
 #include "rt_string.h"
 #include "rt_exception.h"
 #include "alloc/general_allocation.h"
+#include "gc/garbage_collector.h"
 #include "metadata/metadata_cache.h"
 #include "metadata/metadata_compare.h"
 #include "metadata/metadata_hash.h"
@@ -479,4 +480,39 @@ RtResult<RtObject*> Reflection::invoke_method(const metadata::RtMethodInfo* meth
     return Runtime::invoke_array_arguments_with_run_cctor(method, obj, params);
 }
 
+void Reflection::mark_roots()
+{
+    for (const auto& pair : s_class_reflection_type_map)
+    {
+        gc::GarbageCollector::mark_object(reinterpret_cast<RtObject*>(pair.second));
+    }
+    for (const auto& pair : s_method_reflection_map)
+    {
+        gc::GarbageCollector::mark_object(reinterpret_cast<RtObject*>(pair.second));
+    }
+    for (const auto& pair : s_method_params_map)
+    {
+        gc::GarbageCollector::mark_object(reinterpret_cast<RtObject*>(pair.second));
+    }
+    for (const auto& pair : s_field_reflection_map)
+    {
+        gc::GarbageCollector::mark_object(reinterpret_cast<RtObject*>(pair.second));
+    }
+    for (const auto& pair : s_property_reflection_map)
+    {
+        gc::GarbageCollector::mark_object(reinterpret_cast<RtObject*>(pair.second));
+    }
+    for (const auto& pair : s_event_reflection_map)
+    {
+        gc::GarbageCollector::mark_object(reinterpret_cast<RtObject*>(pair.second));
+    }
+    for (const auto& pair : s_assembly_reflection_map)
+    {
+        gc::GarbageCollector::mark_object(reinterpret_cast<RtObject*>(pair.second));
+    }
+    for (const auto& pair : s_module_reflection_map)
+    {
+        gc::GarbageCollector::mark_object(reinterpret_cast<RtObject*>(pair.second));
+    }
+}
 } // namespace leanclr::vm
@@ -18,5 +18,7 @@ class Reflection
     static RtResult<metadata::RtMonoAssemblyName*> get_assembly_name_object(metadata::RtAssembly* ass);
     static RtResult<RtReflectionModule*> get_module_reflection_object(metadata::RtModuleDef* mod);
     static RtResult<RtObject*> invoke_method(const metadata::RtMethodInfo* method, RtObject* obj, RtArray* params, RtObject** out_ex);
+    // Mark the cached reflection objects for the collector
+    static void mark_roots();
 };
 } // namespace leanclr::vm
@@ -404,6 +404,10 @@ RtResultVoid Array::szarray_set_invoker(metadata::RtManagedMethodPointer method_
 
     uint8_t* data_ptr = reinterpret_cast<uint8_t*>(const_cast<uint64_t*>(&arr->first_data)) + element_size * index;
     std::memcpy(data_ptr, value_ptr, element_size);
+    if (Class::get_has_references(arr->klass))
+    {
+        gc::GarbageCollector::write_barrier_range(data_ptr, element_size);
+    }
 
     RET_VOID_OK();
 }
@@ -492,6 +496,10 @@ RtResultVoid Array::mdarray_set_invoker(metadata::RtManagedMethodPointer method_
 
     uint8_t* data_ptr = reinterpret_cast<uint8_t*>(const_cast<uint64_t*>(&arr->first_data)) + element_size * index;
     std::memcpy(data_ptr, value_ptr, element_size);
+    if (Class::get_has_references(arr->klass))
+    {
+        gc::GarbageCollector::write_barrier_range(data_ptr, element_size);
+    }
 
     RET_VOID_OK();
 }
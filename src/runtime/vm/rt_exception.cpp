@@ -129,7 +129,7 @@ void Exception::raise_internal_runtime_error_as_exception(RtErr err, const char*
 
 static void prepare_exception_info(RtException* ex, interp::InterpFrame* frame, const void* ip)
 {
-    auto ret = StackTrace::setup_trace_ips(ex);
+    auto ret = StackTrace::setup_trace_ips(ex, frame, ip);
     if (ret.is_err())
     {
         // Failed to setup stack trace, ignore for now
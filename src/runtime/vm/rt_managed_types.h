@@ -15,7 +15,12 @@ struct ArrayBounds
 struct RtObject
 {
     metadata::RtClass* klass;
+#if !LEANCLR_COMPACT_OBJECT_HEADER
     void* __sync_block;
+#elif LEANCLR_ARCH_32BIT
+    // managed layouts start after the header, which keeps their 8-byte fields aligned like those of the native mirror types
+    uint32_t __padding;
+#endif
 };
 
 struct RtMarshalByRefObject : public RtObject
@@ -45,6 +45,14 @@ static utils::HashSet<RtString*, RtStringHash, RtStringEqual> g_internTable;
 
 // Removed key builder; Hash/Eq operate directly on RtString contents
 
+void String::mark_roots()
+{
+    for (RtString* str : g_internTable)
+    {
+        gc::GarbageCollector::mark_object(str);
+    }
+}
+
 static RtResultVoid init_empty_string(metadata::RtClass* stringClass)
 {
     assert(g_emptyString_ptr == nullptr);
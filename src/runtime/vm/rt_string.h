@@ -66,5 +66,7 @@ class String
     static RtString* fast_allocate_string(int32_t length); // Declaration retained
     static RtString* intern_string(RtString* s);
     static bool is_interned_string(RtString* s);
+    // Mark the interned strings for the collector
+    static void mark_roots();
 };
 } // namespace leanclr::vm
@@ -3,6 +3,7 @@
 #include "class.h"
 #include "rt_managed_types.h"
 #include "alloc/general_allocation.h"
+#include "gc/garbage_collector.h"
 
 namespace leanclr::vm
 {
@@ -36,7 +37,7 @@ void Thread::setup_internal_thread(RtThread* thread)
     internal_thread_obj->handle = nullptr;
     internal_thread_obj->thread_id = 1;
     internal_thread_obj->managed_id = 1;
-    thread->internal_thread = internal_thread_obj;
+    gc::GarbageCollector::write_barrier(reinterpret_cast<RtObject**>(&thread->internal_thread), internal_thread_obj);
 }
 
 RtThread* Thread::attach_current_thread(RtAppDomain* app_domain)
@@ -69,7 +70,7 @@ RtResultVoid Thread::construct_internal_thread(RtThread* thread)
     internal_thread_obj->thread_id = 1;
     internal_thread_obj->managed_id = 1;
     internal_thread_obj->state = RtThreadState::Unstarted;
-    thread->internal_thread = internal_thread_obj;
+    gc::GarbageCollector::write_barrier(reinterpret_cast<RtObject**>(&thread->internal_thread), internal_thread_obj);
 
     RET_VOID_OK();
 }
@@ -146,4 +147,8 @@ void Thread::set_priority_native(RtThread* thread, int32_t priority)
     g_priority = priority;
 }
 
+void Thread::mark_roots()
+{
+    gc::GarbageCollector::mark_object(g_current_thread);
+}
 } // namespace leanclr::vm
@@ -56,6 +56,9 @@ class Thread
 
     // Set thread priority
     static void set_priority_native(RtThread* thread, int32_t priority);
+
+    // Mark the current thread for the collector
+    static void mark_roots();
 };
 
 } // namespace leanclr::vm
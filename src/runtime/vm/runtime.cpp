@@ -23,6 +23,7 @@
 #include "alloc/general_allocation.h"
 #include "gc/garbage_collector.h"
 #include "interp/machine_state.h"
+#include "interp/interpreter.h"
 #include "utils/rt_vector.h"
 
 namespace leanclr::vm
@@ -368,6 +369,7 @@ RtResultVoid Runtime::initialize()
 
     metadata::MetadataCache::initialize();
     interp::MachineState::initialize();
+    interp::Interpreter::initialize();
     gc::GarbageCollector::initialize();
 
     RET_ERR_ON_FAIL(Assembly::load_corlib());
@@ -385,6 +387,7 @@ RtResultVoid Runtime::initialize()
     const char** argv;
     Settings::get_command_line_arguments(argc, argv);
     RET_ERR_ON_FAIL(Environment::init_cmdline_args(argv, argc));
+    gc::GarbageCollector::enable_collections();
     RET_VOID_OK();
 }
 
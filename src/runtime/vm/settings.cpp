@@ -17,6 +17,13 @@ static DebuggerLogFunc g_debugger_log_function = default_debugger_log_function;
 
 static ReportUnhandledExceptionFunc g_report_unhandled_exception_function = nullptr;
 
+static IrCacheLoaderFunc g_ir_cache_loader = nullptr;
+static IrCacheWriterFunc g_ir_cache_writer = nullptr;
+static size_t g_ir_code_cache_budget = 0;
+static size_t g_gc_collection_threshold = 8 * 1024 * 1024;
+static size_t g_gc_nursery_size = 1024 * 1024;
+static bool g_gc_incremental_marking = false;
+
 static utils::StringBuilder g_debugger_log_buffer;
 
 static void default_debugger_log_function(int32_t level, const uint16_t* category, size_t category_len, const uint16_t* message, size_t message_len)
@@ -80,6 +87,66 @@ ReportUnhandledExceptionFunc Settings::get_report_unhandled_exception_function()
     return g_report_unhandled_exception_function;
 }
 
+void Settings::set_ir_cache_loader(IrCacheLoaderFunc loader)
+{
+    g_ir_cache_loader = loader;
+}
+
+IrCacheLoaderFunc Settings::get_ir_cache_loader()
+{
+    return g_ir_cache_loader;
+}
+
+void Settings::set_ir_cache_writer(IrCacheWriterFunc writer)
+{
+    g_ir_cache_writer = writer;
+}
+
+IrCacheWriterFunc Settings::get_ir_cache_writer()
+{
+    return g_ir_cache_writer;
+}
+
+void Settings::set_ir_code_cache_budget(size_t budget)
+{
+    g_ir_code_cache_budget = budget;
+}
+
+size_t Settings::get_ir_code_cache_budget()
+{
+    return g_ir_code_cache_budget;
+}
+
+void Settings::set_gc_collection_threshold(size_t bytes)
+{
+    g_gc_collection_threshold = bytes;
+}
+
+size_t Settings::get_gc_collection_threshold()
+{
+    return g_gc_collection_threshold;
+}
+
+void Settings::set_gc_nursery_size(size_t bytes)
+{
+    g_gc_nursery_size = bytes;
+}
+
+size_t Settings::get_gc_nursery_size()
+{
+    return g_gc_nursery_size;
+}
+
+void Settings::set_gc_incremental_marking(bool enabled)
+{
+    g_gc_incremental_marking = enabled;
+}
+
+bool Settings::get_gc_incremental_marking()
+{
+    return g_gc_incremental_marking;
+}
+
 void Settings::set_command_line_arguments(int32_t argc, const char** argv)
 {
     g_cmd_argc = argc;
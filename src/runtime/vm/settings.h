@@ -11,6 +11,10 @@ typedef RtResult<utils::Span<byte>> (*AssemblyLoaderFunc)(const char* assembly_n
 typedef void (*InternalFunctionInitializer)();
 typedef void (*DebuggerLogFunc)(int32_t level, const uint16_t* category, size_t category_len, const uint16_t* message, size_t message_len);
 typedef void (*ReportUnhandledExceptionFunc)(RtException* exception);
+// Returns the IR cache previously written for the assembly, or an empty span. The data must stay valid and unchanged until shutdown,
+// so hosts typically map the file read-only.
+typedef utils::ConstByteSpan (*IrCacheLoaderFunc)(const char* assembly_name);
+typedef void (*IrCacheWriterFunc)(const char* assembly_name, const byte* data, size_t size);
 
 class Settings
 {
@@ -34,5 +38,26 @@ class Settings
 
     static void set_report_unhandled_exception_function(ReportUnhandledExceptionFunc func);
     static ReportUnhandledExceptionFunc get_report_unhandled_exception_function();
+
+    static void set_ir_cache_loader(IrCacheLoaderFunc loader);
+    static IrCacheLoaderFunc get_ir_cache_loader();
+    // Setting a writer records every transformed method until interp::IrCache::save() hands the caches to it.
+    static void set_ir_cache_writer(IrCacheWriterFunc writer);
+    static IrCacheWriterFunc get_ir_cache_writer();
+    // Bytes of transformed IR kept resident before cold methods are evicted, 0 for no limit. Set it before the first method runs.
+    static void set_ir_code_cache_budget(size_t budget);
+    static size_t get_ir_code_cache_budget();
+    // Bytes allocated after a collection that request the next one, 0 to collect only on GC.Collect. Collections run when the
+    // outermost interpreter execution enters a method, so hosts must hold the objects they keep across calls in GC handles.
+    static void set_gc_collection_threshold(size_t bytes);
+    static size_t get_gc_collection_threshold();
+    // Bytes allocated after a collection that make the next one a minor collection of the objects allocated since, 0 to make
+    // every collection a full one. Full collections still run once the heap grew by the collection threshold.
+    static void set_gc_nursery_size(size_t bytes);
+    static size_t get_gc_nursery_size();
+    // Make the full collections requested by allocation mark incrementally in the steps of leanclr_gc_step() instead of
+    // stopping the world. They still finish at the next safepoint once another collection threshold of bytes was allocated.
+    static void set_gc_incremental_marking(bool enabled);
+    static bool get_gc_incremental_marking();
 };
 } // namespace leanclr::vm
@@ -5,6 +5,7 @@
 #include "reflection.h"
 #include "object.h"
 #include "method.h"
+#include "gc/garbage_collector.h"
 #include "interp/interp_defs.h"
 #include "interp/machine_state.h"
 #include "metadata/module_def.h"
@@ -14,16 +15,15 @@ namespace leanclr::vm
 
 static bool is_frame_should_be_counted_to_stacktrace(const interp::InterpFrame* frame)
 {
-    const metadata::RtMethodInfo* method = frame->method;
-    if (!method->parent->image->is_corlib())
-    {
-        return true;
-    }
-    const char* klass_name = method->parent->name;
-    return !(strcmp(klass_name, "StackFrame") == 0 || strcmp(klass_name, "StackTrace") == 0);
+    const metadata::RtClass* klass = frame->method->parent;
+    const CorLibTypes& corlib_types = Class::get_corlib_types();
+    return klass != corlib_types.cls_stackframe && klass != corlib_types.cls_stacktrace;
 }
 
-RtResultVoid StackTrace::setup_trace_ips(RtException* ex)
+// each frame of trace_ips is a method followed by an IR offset
+constexpr int32_t TRACE_IP_SLOTS_PER_FRAME = 2;
+
+RtResultVoid StackTrace::setup_trace_ips(RtException* ex, const interp::InterpFrame* throw_frame, const void* throw_ip)
 {
     if (ex->trace_ips)
     {
@@ -32,28 +32,32 @@ RtResultVoid StackTrace::setup_trace_ips(RtException* ex)
     auto& ms = interp::MachineState::get_global_machine_state();
     auto frames = ms.get_active_frames();
 
-    utils::Vector<const interp::InterpFrame*> trace_frames;
+    size_t trace_frame_count = 0;
     for (size_t i = 0; i < frames.size(); ++i)
     {
-        const interp::InterpFrame* frame = &frames[i];
-        if (is_frame_should_be_counted_to_stacktrace(frame))
+        if (is_frame_should_be_counted_to_stacktrace(&frames[i]))
         {
-            trace_frames.push_back(frame);
+            ++trace_frame_count;
         }
     }
-    metadata::RtClass* cls_stackframe = Class::get_corlib_types().cls_stackframe;
-    DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(RtArray*, trace_ips, Array::new_array_from_ele_klass(cls_stackframe, static_cast<int32_t>(trace_frames.size())));
-    for (size_t i = 0, frame_count = trace_frames.size(); i < frame_count; ++i)
+    metadata::RtClass* cls_intptr = Class::get_corlib_types().cls_intptr;
+    DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(
+        RtArray*, trace_ips, Array::new_array_from_ele_klass(cls_intptr, static_cast<int32_t>(trace_frame_count) * TRACE_IP_SLOTS_PER_FRAME));
+    int32_t slot = 0;
+    for (size_t i = frames.size(); i > 0; --i)
     {
-        DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(RtObject*, stackframe_obj, Object::new_object(cls_stackframe));
-        RtStackFrame* stackframe = static_cast<RtStackFrame*>(stackframe_obj);
-
-        const interp::InterpFrame* frame = trace_frames[i];
-        UNWRAP_OR_RET_ERR_ON_FAIL(stackframe->method, Reflection::get_method_reflection_object(frame->method, frame->method->parent));
-        stackframe->method_index = Method::get_method_index_in_class(frame->method);
-        Array::set_array_data_at<RtObject*>(trace_ips, frame_count - 1 - i, stackframe_obj);
+        const interp::InterpFrame* frame = &frames[i - 1];
+        if (!is_frame_should_be_counted_to_stacktrace(frame))
+        {
+            continue;
+        }
+        // callers saved their ip at the call, the throwing frame has not
+        const uint8_t* ip = static_cast<const uint8_t*>(frame == throw_frame && throw_ip ? throw_ip : frame->ip);
+        const intptr_t ir_offset = ip ? static_cast<intptr_t>(ip - frame->imi->codes) : 0;
+        Array::set_array_data_at<intptr_t>(trace_ips, slot++, reinterpret_cast<intptr_t>(frame->method));
+        Array::set_array_data_at<intptr_t>(trace_ips, slot++, ir_offset);
     }
-    ex->trace_ips = trace_ips;
+    gc::GarbageCollector::write_barrier(reinterpret_cast<RtObject**>(&ex->trace_ips), trace_ips);
 
     RET_VOID_OK();
 }
@@ -92,7 +96,7 @@ RtResult<RtArray*> StackTrace::get_stack_trace(RtException* ex, int32_t skip_fra
         return Array::new_empty_szarray_by_ele_klass(cls_stackframe);
     }
 
-    int32_t stack_count = Array::get_array_length(ex->trace_ips);
+    int32_t stack_count = Array::get_array_length(ex->trace_ips) / TRACE_IP_SLOTS_PER_FRAME;
     assert(skip_frames >= 0);
     if (skip_frames >= stack_count)
     {
@@ -102,8 +106,17 @@ RtResult<RtArray*> StackTrace::get_stack_trace(RtException* ex, int32_t skip_fra
     DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(RtArray*, result_array, Array::new_array_from_ele_klass(cls_stackframe, stack_count - skip_frames));
     for (int32_t i = skip_frames; i < stack_count; ++i)
     {
-        RtObject* frame_obj = Array::get_array_data_at<RtObject*>(ex->trace_ips, i);
-        Array::set_array_data_at<RtObject*>(result_array, i - skip_frames, frame_obj);
+        const metadata::RtMethodInfo* method =
+            reinterpret_cast<const metadata::RtMethodInfo*>(Array::get_array_data_at<intptr_t>(ex->trace_ips, i * TRACE_IP_SLOTS_PER_FRAME));
+
+        DECLARING_AND_UNWRAP_OR_RET_ERR_ON_FAIL(RtObject*, stackframe_obj, Object::new_object(cls_stackframe));
+        RtStackFrame* stackframe = static_cast<RtStackFrame*>(stackframe_obj);
+        UNWRAP_OR_RET_ERR_ON_FAIL(stackframe->method, Reflection::get_method_reflection_object(method, method->parent));
+        stackframe->method_index = Method::get_method_index_in_class(method);
+        // the recorded IR offset is no native code offset and changes when the method tiers up, so like get_frame_info
+        // the frame reports none
+        stackframe->native_offset = -1;
+        Array::set_array_data_at<RtObject*>(result_array, i - skip_frames, stackframe_obj);
     }
 
     RET_OK(result_array);
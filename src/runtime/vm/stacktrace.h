@@ -2,13 +2,19 @@
 
 #include "rt_managed_types.h"
 
+namespace leanclr::interp
+{
+struct InterpFrame;
+}
+
 namespace leanclr::vm
 {
 class StackTrace
 {
   public:
-    // Stack trace related functions can be declared here
-    static RtResultVoid setup_trace_ips(RtException* ex);
+    // Records the interpreter frames of a thrown exception in trace_ips as native int pairs of method and IR offset, innermost
+    // frame first. The StackFrame objects are only created when the trace is read.
+    static RtResultVoid setup_trace_ips(RtException* ex, const interp::InterpFrame* throw_frame, const void* throw_ip);
 
     static RtResult<bool> get_frame_info(int32_t skip, bool need_file_info, RtReflectionMethod** method, int32_t* il_offset, int32_t* native_offset,
                                          RtString** file_name, int32_t* line_number, int32_t* column_number);
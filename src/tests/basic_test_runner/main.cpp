@@ -19,6 +19,10 @@
 #include "vm/object.h"
 #include "vm/customattribute.h"
 #include "interp/interpreter.h"
+#include "interp/eval_stack_op.h"
+#include "vm/internal_calls.h"
+#include "gc/garbage_collector.h"
+#include "public/leanclr.h"
 
 #ifdef _WIN32
 #include <windows.h>
@@ -310,6 +314,28 @@ RtResultVoid run_tests(metadata::RtModuleDef* mod)
     RET_VOID_OK();
 }
 
+// Tests.GarbageCollection.TC_gc_step marks the heap incrementally through this internal call, rewiring the object graph
+// between the steps.
+static RtResultVoid gc_step_invoker(metadata::RtManagedMethodPointer methodPtr, const metadata::RtMethodInfo* method,
+                                    const interp::RtStackObject* params, interp::RtStackObject* ret)
+{
+    (void)methodPtr;
+    (void)method;
+    auto budget_us = interp::EvalStackOp::get_param<int64_t>(params, 0);
+    auto start_full_collection = interp::EvalStackOp::get_param<bool>(params, 1);
+    if (start_full_collection)
+    {
+        gc::GarbageCollector::request_collection(gc::GarbageCollector::MAX_GENERATION);
+    }
+    interp::EvalStackOp::set_return(ret, static_cast<int32_t>(leanclr_gc_step(budget_us)));
+    RET_VOID_OK();
+}
+
+static void register_test_internal_calls()
+{
+    vm::InternalCalls::register_internal_call("Tests.GarbageCollection.TC_gc_step::Step(System.Int64,System.Boolean)", nullptr, gc_step_invoker);
+}
+
 int main()
 {
 #ifdef _WIN32
@@ -332,6 +358,7 @@ int main()
         std::cout << "Failed to initialize runtime, error: " << static_cast<int>(result.unwrap_err()) << std::endl;
         return -1;
     }
+    register_test_internal_calls();
 
     bool is_run_all = true;
     bool is_run_bootstrap_tests = is_run_all || false;
@@ -0,0 +1,266 @@
+using test;
+using System;
+using System.Collections.Generic;
+using System.Linq;
+using System.Runtime.CompilerServices;
+using System.Text;
+using System.Threading.Tasks;
+
+namespace Tests.GarbageCollection
+{
+    /// <summary>
+    /// 完整回收时, 只能通过局部变量, 字段, 数组元素, 结构体拷贝或静态变量引用的对象都必须存活.
+    /// 被错误回收的对象内存会在清扫时清零, 之后的分配会复用它, 所以每次回收后都先分配一批垃圾再检查内容
+    /// </summary>
+    internal class TC_gc_collect : GeneralTestCaseBase
+    {
+        class Node
+        {
+            public int value;
+            public Node next;
+            public object payload;
+        }
+
+        struct Pair
+        {
+            public Node node;
+            public string name;
+            public int value;
+        }
+
+        class PairHolder
+        {
+            public Pair pair;
+            public Pair[] pairs;
+        }
+
+        private static Node s_list;
+        private static Pair s_pair;
+
+        private static Node MakeList(int count)
+        {
+            Node head = null;
+            for (int i = count - 1; i >= 0; i--)
+            {
+                head = new Node { value = i, next = head, payload = "n" + i };
+            }
+            return head;
+        }
+
+        private static void CheckList(Node head, int count)
+        {
+            Node n = head;
+            for (int i = 0; i < count; i++)
+            {
+                Assert.NotNull(n);
+                Assert.Equal(i, n.value);
+                Assert.Equal("n" + i, (string)n.payload);
+                n = n.next;
+            }
+            Assert.Null(n);
+        }
+
+        private static Pair MakePair(int value)
+        {
+            return new Pair { node = MakeList(value), name = "pair" + value, value = value };
+        }
+
+        private static void CheckPair(Pair p, int value)
+        {
+            Assert.Equal(value, p.value);
+            Assert.Equal("pair" + value, p.name);
+            CheckList(p.node, value);
+        }
+
+        // 分配各种大小的垃圾, 复用清扫释放的内存
+        private static void Churn()
+        {
+            for (int i = 0; i < 2000; i++)
+            {
+                var garbage = new Node { value = -1, payload = new int[i % 64] };
+                garbage.next = garbage;
+            }
+        }
+
+        private static void FullCollect()
+        {
+            GC.Collect();
+            Churn();
+        }
+
+        [UnitTest]
+        public void locals_survive()
+        {
+            Node list = MakeList(1000);
+            string s = "local" + list.value;
+            FullCollect();
+            CheckList(list, 1000);
+            Assert.Equal("local0", s);
+        }
+
+        [UnitTest]
+        public void fields_survive()
+        {
+            var holder = new Node { payload = new Node { payload = MakeList(100) } };
+            FullCollect();
+            CheckList((Node)((Node)holder.payload).payload, 100);
+        }
+
+        [UnitTest]
+        public void arrays_survive()
+        {
+            var objects = new object[] { MakeList(10), "string" + 1, 42, new int[] { 1, 2, 3 }, null, new Node[] { MakeList(5) } };
+            FullCollect();
+            CheckList((Node)objects[0], 10);
+            Assert.Equal("string1", (string)objects[1]);
+            Assert.Equal(42, (int)objects[2]);
+            Assert.Equal(3, ((int[])objects[3])[2]);
+            Assert.Null(objects[4]);
+            CheckList(((Node[])objects[5])[0], 5);
+
+            var nodes = new Node[300];
+            for (int i = 0; i < nodes.Length; i++)
+            {
+                nodes[i] = MakeList(i % 7);
+            }
+            FullCollect();
+            for (int i = 0; i < nodes.Length; i++)
+            {
+                CheckList(nodes[i], i % 7);
+            }
+        }
+
+        [UnitTest]
+        public void struct_copies_survive()
+        {
+            Pair p = MakePair(20);
+            Pair copy = p;
+            p = default;
+            object boxed = MakePair(21);
+            var holder = new PairHolder { pair = MakePair(22), pairs = new Pair[] { MakePair(23), MakePair(24) } };
+            Pair fromArray = holder.pairs[1];
+            holder.pairs[1] = default;
+            FullCollect();
+            Assert.Null(p.node);
+            CheckPair(copy, 20);
+            CheckPair((Pair)boxed, 21);
+            CheckPair(holder.pair, 22);
+            CheckPair(holder.pairs[0], 23);
+            CheckPair(fromArray, 24);
+        }
+
+        [UnitTest]
+        public void statics_survive()
+        {
+            s_list = MakeList(50);
+            s_pair = MakePair(30);
+            FullCollect();
+            CheckList(s_list, 50);
+            CheckPair(s_pair, 30);
+            s_list = null;
+            s_pair = default;
+        }
+
+        [UnitTest]
+        public void cycles()
+        {
+            Node ring = MakeList(100);
+            Node last = ring;
+            while (last.next != null)
+            {
+                last = last.next;
+            }
+            last.next = ring;
+            for (int i = 0; i < 10; i++)
+            {
+                Node garbageRing = MakeList(100);
+                garbageRing.next.next = garbageRing;
+            }
+            FullCollect();
+            Node n = ring;
+            for (int i = 0; i < 250; i++)
+            {
+                Assert.Equal(i % 100, n.value);
+                n = n.next;
+            }
+        }
+
+        [UnitTest]
+        public void deep_graph()
+        {
+            // 很长的链表不能让标记栈溢出
+            Node list = MakeList(100000);
+            FullCollect();
+            CheckList(list, 100000);
+        }
+
+        [UnitTest]
+        public void collection_count()
+        {
+            int before = GC.CollectionCount(0);
+            int beforeFull = GC.CollectionCount(GC.MaxGeneration);
+            GC.Collect();
+            Assert.IsTrue(GC.CollectionCount(0) > before);
+            Assert.IsTrue(GC.CollectionCount(GC.MaxGeneration) > beforeFull);
+        }
+
+        // 在较深的调用中分配, 返回后它的引用只留在当前栈顶之上, 不会被当作根
+        [MethodImpl(MethodImplOptions.NoInlining)]
+        private static WeakReference CreateWeak(int depth)
+        {
+            if (depth > 0)
+            {
+                return CreateWeak(depth - 1);
+            }
+            return new WeakReference(new Node { value = 7 });
+        }
+
+        [UnitTest]
+        public void unreachable_objects_collected()
+        {
+            var weaks = new WeakReference[16];
+            for (int i = 0; i < weaks.Length; i++)
+            {
+                weaks[i] = CreateWeak(8);
+            }
+            var live = new Node { value = 8 };
+            var liveWeak = new WeakReference(live);
+            FullCollect();
+            for (int i = 0; i < weaks.Length; i++)
+            {
+                Assert.IsFalse(weaks[i].IsAlive);
+            }
+            Assert.IsTrue(liveWeak.IsAlive);
+            Assert.Equal(8, ((Node)liveWeak.Target).value);
+            Assert.Equal(8, live.value);
+        }
+
+        [UnitTest]
+        public void stress()
+        {
+            var kept = new Node[64];
+            var keptLengths = new int[kept.Length];
+            for (int round = 0; round < 200; round++)
+            {
+                kept[round % kept.Length] = MakeList(round % 17);
+                keptLengths[round % kept.Length] = round % 17;
+                for (int i = 0; i < 200; i++)
+                {
+                    var garbage = new object[i % 9];
+                    if (garbage.Length > 0)
+                    {
+                        garbage[0] = new Node();
+                    }
+                }
+                if (round % 10 == 0)
+                {
+                    GC.Collect();
+                }
+            }
+            for (int i = 0; i < kept.Length; i++)
+            {
+                CheckList(kept[i], keptLengths[i]);
+            }
+        }
+    }
+}
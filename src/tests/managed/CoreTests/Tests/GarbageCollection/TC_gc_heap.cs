@@ -0,0 +1,256 @@
+using test;
+using System;
+using System.Collections.Generic;
+using System.Linq;
+using System.Runtime.CompilerServices;
+using System.Text;
+using System.Threading.Tasks;
+
+namespace Tests.GarbageCollection
+{
+    /// <summary>
+    /// 按大小分级的对象堆. 覆盖各个大小级别和大对象空间, 检查存活对象内容不变, 复用的内存重新分配时已清零
+    /// </summary>
+    internal class TC_gc_heap : GeneralTestCaseBase
+    {
+        class Small
+        {
+            public int a;
+            public object r;
+        }
+
+        class Medium
+        {
+            public long a, b, c, d, e, f, g, h;
+            public object r1, r2, r3, r4;
+        }
+
+        private static byte[][] s_large;
+
+        private static byte Pattern(int length, int i)
+        {
+            return (byte)(length * 31 + i * 7 + 1);
+        }
+
+        private static byte[] MakeBytes(int length)
+        {
+            var bytes = new byte[length];
+            for (int i = 0; i < length; i++)
+            {
+                bytes[i] = Pattern(length, i);
+            }
+            return bytes;
+        }
+
+        private static void CheckBytes(byte[] bytes, int length)
+        {
+            Assert.Equal(length, bytes.Length);
+            for (int i = 0; i < length; i++)
+            {
+                if (bytes[i] != Pattern(length, i))
+                {
+                    Assert.Fail("byte " + i + " of a " + length + " byte array changed");
+                }
+            }
+        }
+
+        [UnitTest]
+        public void all_size_classes()
+        {
+            // 长度跨过最大的小对象, 进入大对象空间
+            const int maxLength = 3000;
+            var kept = new byte[maxLength][];
+            for (int length = 0; length < maxLength; length++)
+            {
+                var bytes = MakeBytes(length);
+                if (length % 2 == 0)
+                {
+                    kept[length] = bytes;
+                }
+            }
+            GC.Collect();
+            for (int length = 0; length < maxLength; length++)
+            {
+                var fresh = new byte[length];
+                for (int i = 0; i < length; i++)
+                {
+                    if (fresh[i] != 0)
+                    {
+                        Assert.Fail("reused memory of a " + length + " byte array is not zeroed");
+                    }
+                }
+            }
+            for (int length = 0; length < maxLength; length += 2)
+            {
+                CheckBytes(kept[length], length);
+            }
+        }
+
+        [UnitTest]
+        public void reused_objects_zeroed()
+        {
+            for (int round = 0; round < 4; round++)
+            {
+                for (int i = 0; i < 5000; i++)
+                {
+                    new Small { a = i + 1, r = "x" };
+                    new Medium { a = 1, h = 8, r1 = "a", r4 = "d" };
+                }
+                GC.Collect();
+                for (int i = 0; i < 5000; i++)
+                {
+                    var s = new Small();
+                    Assert.Equal(0, s.a);
+                    Assert.Null(s.r);
+                    var m = new Medium();
+                    Assert.Equal(0L, m.a);
+                    Assert.Equal(0L, m.h);
+                    Assert.Null(m.r1);
+                    Assert.Null(m.r4);
+                }
+            }
+        }
+
+        [UnitTest]
+        public void mixed_sizes_survive()
+        {
+            var objects = new object[4000];
+            for (int i = 0; i < objects.Length; i++)
+            {
+                switch (i % 5)
+                {
+                case 0:
+                    objects[i] = new Small { a = i, r = objects };
+                    break;
+                case 1:
+                    objects[i] = new Medium { a = i, h = -i, r1 = objects, r4 = "m" + i };
+                    break;
+                case 2:
+                    objects[i] = new string('s', i % 700);
+                    break;
+                case 3:
+                    objects[i] = new int[i % 1000];
+                    break;
+                default:
+                    objects[i] = new object[i % 300];
+                    break;
+                }
+                // 中间混入立刻死亡的对象
+                new Medium();
+            }
+            for (int round = 0; round < 3; round++)
+            {
+                GC.Collect();
+                for (int i = 0; i < objects.Length; i++)
+                {
+                    switch (i % 5)
+                    {
+                    case 0:
+                        Assert.Equal(i, ((Small)objects[i]).a);
+                        Assert.IsTrue(((Small)objects[i]).r == objects);
+                        break;
+                    case 1:
+                        Assert.Equal((long)i, ((Medium)objects[i]).a);
+                        Assert.Equal((long)-i, ((Medium)objects[i]).h);
+                        Assert.Equal("m" + i, (string)((Medium)objects[i]).r4);
+                        break;
+                    case 2:
+                        Assert.Equal(i % 700, ((string)objects[i]).Length);
+                        break;
+                    case 3:
+                        Assert.Equal(i % 1000, ((int[])objects[i]).Length);
+                        break;
+                    default:
+                        Assert.Equal(i % 300, ((object[])objects[i]).Length);
+                        break;
+                    }
+                }
+            }
+        }
+
+        [UnitTest]
+        public void large_objects()
+        {
+            var bytes = MakeBytes(100000);
+            var refs = new object[20000];
+            for (int i = 0; i < refs.Length; i++)
+            {
+                refs[i] = new Small { a = i };
+            }
+            for (int i = 0; i < 20; i++)
+            {
+                var garbage = new byte[50000 + i];
+                garbage[0] = 1;
+            }
+            GC.Collect();
+            CheckBytes(bytes, 100000);
+            for (int i = 0; i < refs.Length; i++)
+            {
+                Assert.Equal(i, ((Small)refs[i]).a);
+            }
+            var fresh = new byte[50010];
+            for (int i = 0; i < fresh.Length; i++)
+            {
+                if (fresh[i] != 0)
+                {
+                    Assert.Fail("reused large object memory is not zeroed");
+                }
+            }
+        }
+
+        [MethodImpl(MethodImplOptions.NoInlining)]
+        private static void AllocateLarge()
+        {
+            s_large = new byte[64][];
+            for (int i = 0; i < s_large.Length; i++)
+            {
+                s_large[i] = new byte[64 * 1024];
+            }
+        }
+
+        [UnitTest]
+        public void freed_memory_returns()
+        {
+            AllocateLarge();
+            long withLarge = GC.GetTotalMemory(true);
+            s_large = null;
+            long withoutLarge = GC.GetTotalMemory(true);
+            Assert.IsTrue(withLarge - withoutLarge >= 64L * 64 * 1024);
+        }
+
+        [UnitTest]
+        public void stress()
+        {
+            var kept = new object[256];
+            var keptSizes = new int[kept.Length];
+            int seed = 12345;
+            for (int i = 0; i < 100000; i++)
+            {
+                seed = seed * 1103515245 + 12345;
+                int size = (seed >> 8) & 0x7FF;
+                object o = (i & 1) == 0 ? (object)new byte[size] : new object[size / 8];
+                if ((seed & 0xF) == 0)
+                {
+                    kept[(seed >> 4) & 0xFF] = o;
+                    keptSizes[(seed >> 4) & 0xFF] = size;
+                }
+            }
+            GC.Collect();
+            for (int i = 0; i < kept.Length; i++)
+            {
+                if (kept[i] is byte[] bytes)
+                {
+                    Assert.Equal(keptSizes[i], bytes.Length);
+                }
+                else if (kept[i] is object[] objects)
+                {
+                    Assert.Equal(keptSizes[i] / 8, objects.Length);
+                }
+                else
+                {
+                    Assert.Null(kept[i]);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,149 @@
+using test;
+using System;
+using System.Collections.Generic;
+using System.Linq;
+using System.Runtime.CompilerServices;
+using System.Text;
+using System.Threading.Tasks;
+
+namespace Tests.GarbageCollection
+{
+    /// <summary>
+    /// 增量标记. Step由basic_test_runner注册为内部调用, 转发到leanclr_gc_step, 每两步之间改写对象图.
+    /// 年轻对象和尚未扫描的引用被写进可能已经扫描过的老对象, 写屏障必须让它们重新变灰
+    /// </summary>
+    internal class TC_gc_step : GeneralTestCaseBase
+    {
+        class Tag
+        {
+            public int id;
+        }
+
+        class Node
+        {
+            public int value;
+            public Node next;
+            public object payload;
+            public Node young;
+        }
+
+        private const int NodeCount = 4096;
+        private const int ChainLength = 4;
+
+        private Node[] _nodes;
+        private int[] _payloadIds;
+        private int[] _youngValues;
+        private Node _stash;
+        private int _stashIndex;
+
+        // start为true时先请求一次完整回收. 返回增量回收是否还没有结束
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern bool Step(long budgetUs, bool start);
+
+        private void Setup()
+        {
+            _nodes = new Node[NodeCount];
+            _payloadIds = new int[NodeCount];
+            _youngValues = new int[NodeCount];
+            for (int i = 0; i < NodeCount; i++)
+            {
+                Node head = null;
+                for (int k = ChainLength - 1; k >= 0; k--)
+                {
+                    head = new Node { value = i * 10 + k, next = head };
+                }
+                head.payload = new Tag { id = i };
+                _payloadIds[i] = i;
+                _nodes[i] = head;
+            }
+            _stash = null;
+            _stashIndex = -1;
+        }
+
+        [MethodImpl(MethodImplOptions.NoInlining)]
+        private void Mutate(int round)
+        {
+            // 交换两个老对象的引用, 中间只留在其中一个对象里
+            int a = round * 37 % NodeCount;
+            int b = NodeCount - 1 - a;
+            object pa = _nodes[a].payload;
+            _nodes[a].payload = null;
+            _nodes[a].payload = _nodes[b].payload;
+            _nodes[b].payload = pa;
+            int id = _payloadIds[a];
+            _payloadIds[a] = _payloadIds[b];
+            _payloadIds[b] = id;
+
+            // 标记期间分配的对象写进老对象
+            int c = round * 101 % NodeCount;
+            _nodes[c].young = new Node { value = round + 1, payload = new Tag { id = -round } };
+            _youngValues[c] = round + 1;
+
+            // 链表的尾部暂存在字段里, 下一轮挂回原处
+            if (_stashIndex >= 0)
+            {
+                _nodes[_stashIndex].next = _stash;
+            }
+            _stashIndex = round * 53 % NodeCount;
+            _stash = _nodes[_stashIndex].next;
+            _nodes[_stashIndex].next = null;
+        }
+
+        private void Verify()
+        {
+            if (_stashIndex >= 0)
+            {
+                _nodes[_stashIndex].next = _stash;
+                _stash = null;
+                _stashIndex = -1;
+            }
+            // 复用清扫释放的内存, 被错误回收的对象会被覆盖
+            for (int i = 0; i < 20000; i++)
+            {
+                new Node { value = -1, payload = new Tag { id = -1 } };
+            }
+
+            for (int i = 0; i < NodeCount; i++)
+            {
+                Node n = _nodes[i];
+                for (int k = 0; k < ChainLength; k++)
+                {
+                    Assert.NotNull(n);
+                    Assert.Equal(i * 10 + k, n.value);
+                    n = n.next;
+                }
+                var tag = _nodes[i].payload as Tag;
+                Assert.NotNull(tag);
+                Assert.Equal(_payloadIds[i], tag.id);
+                Node young = _nodes[i].young;
+                if (_youngValues[i] == 0)
+                {
+                    Assert.Null(young);
+                }
+                else
+                {
+                    Assert.NotNull(young);
+                    Assert.Equal(_youngValues[i], young.value);
+                    Assert.Equal(1 - _youngValues[i], ((Tag)young.payload).id);
+                }
+            }
+        }
+
+        [UnitTest]
+        public void mutate_while_marking()
+        {
+            Setup();
+            int fullCollections = GC.CollectionCount(GC.MaxGeneration);
+            int round = 0;
+            // 预算为0时每一步追踪的对象最少
+            for (bool marking = Step(0, true); marking; marking = Step(0, false))
+            {
+                Mutate(round++);
+            }
+            Assert.IsTrue(round > 0);
+            Assert.IsTrue(GC.CollectionCount(GC.MaxGeneration) > fullCollections);
+            Verify();
+            _nodes = null;
+        }
+    }
+}
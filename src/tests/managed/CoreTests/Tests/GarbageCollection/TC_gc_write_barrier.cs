@@ -0,0 +1,408 @@
+using test;
+using System;
+using System.Collections.Generic;
+using System.Linq;
+using System.Runtime.CompilerServices;
+using System.Text;
+using System.Threading;
+using System.Threading.Tasks;
+
+namespace Tests.GarbageCollection
+{
+    /// <summary>
+    /// 分代回收的写屏障. 年轻对象只通过老对象引用时, 次级回收必须通过记忆集找到它们.
+    /// 年轻对象都在NoInlining的辅助函数里分配并写入, 返回后求值栈上不再有它们的引用
+    /// </summary>
+    internal class TC_gc_write_barrier : GeneralTestCaseBase
+    {
+        class Node
+        {
+            public int value;
+            public Node next;
+        }
+
+        struct Pair
+        {
+            public Node node;
+            public string name;
+        }
+
+        interface INodeSetter
+        {
+            void Set(Node node);
+
+            Node Get();
+        }
+
+        struct NodeBox : INodeSetter
+        {
+            public Node node;
+
+            public void Set(Node n)
+            {
+                node = n;
+            }
+
+            public Node Get()
+            {
+                return node;
+            }
+        }
+
+        class Holder
+        {
+            public Node node;
+            public Pair pair;
+            public Node[] nodes = new Node[8];
+            public object[] objects = new object[8];
+            public Pair[] pairs = new Pair[8];
+            public List<Node> list = new List<Node>();
+            public Dictionary<int, Node> map = new Dictionary<int, Node>();
+            public INodeSetter boxed = new NodeBox();
+        }
+
+        private static Node MakeNode(int value)
+        {
+            return new Node { value = value, next = new Node { value = value + 1 } };
+        }
+
+        private static void CheckNode(Node node, int value)
+        {
+            Assert.NotNull(node);
+            Assert.Equal(value, node.value);
+            Assert.Equal(value + 1, node.next.value);
+        }
+
+        private static Pair MakePair(int value)
+        {
+            return new Pair { node = MakeNode(value), name = "p" + value };
+        }
+
+        private static void CheckPair(Pair pair, int value)
+        {
+            CheckNode(pair.node, value);
+            Assert.Equal("p" + value, pair.name);
+        }
+
+        // 分配并丢弃年轻对象, 复用次级回收释放的内存
+        private static void Churn()
+        {
+            for (int i = 0; i < 2000; i++)
+            {
+                new Node { value = -1 }.next = new Node { value = -2 };
+            }
+        }
+
+        private static void MinorCollect()
+        {
+            GC.Collect(0);
+            Churn();
+        }
+
+        private static Holder MakeOldHolder()
+        {
+            var holder = new Holder();
+            GC.Collect();
+            Assert.Equal(GC.MaxGeneration, GC.GetGeneration(holder));
+            Assert.Equal(GC.MaxGeneration, GC.GetGeneration(holder.nodes));
+            return holder;
+        }
+
+        [MethodImpl(MethodImplOptions.NoInlining)]
+        private static void StoreField(Holder h, int v)
+        {
+            h.node = MakeNode(v);
+        }
+
+        [MethodImpl(MethodImplOptions.NoInlining)]
+        private static void StoreElement(Holder h, int v)
+        {
+            h.nodes[v % h.nodes.Length] = MakeNode(v);
+            h.objects[v % h.objects.Length] = MakeNode(v);
+        }
+
+        [MethodImpl(MethodImplOptions.NoInlining)]
+        private static void StoreByRef(ref Node location, int v)
+        {
+            location = MakeNode(v);
+        }
+
+        [MethodImpl(MethodImplOptions.NoInlining)]
+        private static void StoreStruct(Holder h, int v)
+        {
+            h.pair = MakePair(v);
+            // 最后一个元素留给StoreStructByRef
+            h.pairs[v % (h.pairs.Length - 1)] = MakePair(v + 1000);
+        }
+
+        [MethodImpl(MethodImplOptions.NoInlining)]
+        private static void StoreStructByRef(ref Pair location, int v)
+        {
+            location = MakePair(v);
+        }
+
+        [MethodImpl(MethodImplOptions.NoInlining)]
+        private static void StoreFieldOfStructField(Holder h, int v)
+        {
+            h.pair.node = MakeNode(v);
+        }
+
+        [MethodImpl(MethodImplOptions.NoInlining)]
+        private static void StoreArrayCopy(Holder h, int v)
+        {
+            var young = new Node[h.nodes.Length];
+            for (int i = 0; i < young.Length; i++)
+            {
+                young[i] = MakeNode(v + i);
+            }
+            Array.Copy(young, 0, h.nodes, 0, young.Length);
+            var youngPairs = new Pair[h.pairs.Length];
+            for (int i = 0; i < youngPairs.Length; i++)
+            {
+                youngPairs[i] = MakePair(v + i);
+            }
+            Array.Copy(youngPairs, h.pairs, youngPairs.Length);
+            h.objects.SetValue(MakeNode(v), 0);
+        }
+
+        [MethodImpl(MethodImplOptions.NoInlining)]
+        private static void StoreInterlocked(Holder h, int v)
+        {
+            Interlocked.Exchange(ref h.node, MakeNode(v));
+            Interlocked.CompareExchange(ref h.nodes[0], MakeNode(v + 1), h.nodes[0]);
+            Volatile.Write(ref h.nodes[1], MakeNode(v + 2));
+        }
+
+        [MethodImpl(MethodImplOptions.NoInlining)]
+        private static void StoreCollections(Holder h, int v)
+        {
+            h.list.Add(MakeNode(v));
+            h.map[v] = MakeNode(v);
+        }
+
+        [MethodImpl(MethodImplOptions.NoInlining)]
+        private static void StoreBoxed(Holder h, int v)
+        {
+            // 通过接口调用装箱结构体的方法, this指向老对象内部
+            h.boxed.Set(MakeNode(v));
+        }
+
+        [UnitTest]
+        public void minor_collection_runs()
+        {
+            var holder = MakeOldHolder();
+            int minor = GC.CollectionCount(0);
+            int full = GC.CollectionCount(GC.MaxGeneration);
+            StoreField(holder, 1);
+            GC.Collect(0);
+            Assert.Equal(minor + 1, GC.CollectionCount(0));
+            Assert.Equal(full, GC.CollectionCount(GC.MaxGeneration));
+            CheckNode(holder.node, 1);
+            Assert.Equal(GC.MaxGeneration, GC.GetGeneration(holder.node));
+        }
+
+        [UnitTest]
+        public void field_store()
+        {
+            var holder = MakeOldHolder();
+            for (int round = 0; round < 10; round++)
+            {
+                StoreField(holder, round);
+                StoreFieldOfStructField(holder, round + 100);
+                MinorCollect();
+                CheckNode(holder.node, round);
+                CheckNode(holder.pair.node, round + 100);
+            }
+        }
+
+        [UnitTest]
+        public void array_element_store()
+        {
+            var holder = MakeOldHolder();
+            for (int round = 0; round < holder.nodes.Length; round++)
+            {
+                StoreElement(holder, round);
+                MinorCollect();
+                for (int i = 0; i <= round; i++)
+                {
+                    CheckNode(holder.nodes[i], i);
+                    CheckNode((Node)holder.objects[i], i);
+                }
+            }
+        }
+
+        [UnitTest]
+        public void ref_store()
+        {
+            var holder = MakeOldHolder();
+            for (int round = 0; round < 10; round++)
+            {
+                StoreByRef(ref holder.node, round);
+                StoreByRef(ref holder.nodes[3], round + 1);
+                StoreByRef(ref holder.pairs[2].node, round + 2);
+                MinorCollect();
+                CheckNode(holder.node, round);
+                CheckNode(holder.nodes[3], round + 1);
+                CheckNode(holder.pairs[2].node, round + 2);
+            }
+        }
+
+        [UnitTest]
+        public void struct_store()
+        {
+            var holder = MakeOldHolder();
+            for (int round = 0; round < 10; round++)
+            {
+                StoreStruct(holder, round);
+                StoreStructByRef(ref holder.pairs[7], round + 2000);
+                MinorCollect();
+                CheckPair(holder.pair, round);
+                CheckPair(holder.pairs[round % (holder.pairs.Length - 1)], round + 1000);
+                CheckPair(holder.pairs[7], round + 2000);
+            }
+        }
+
+        [UnitTest]
+        public void array_copy()
+        {
+            var holder = MakeOldHolder();
+            for (int round = 0; round < 5; round++)
+            {
+                StoreArrayCopy(holder, round * 10);
+                MinorCollect();
+                for (int i = 0; i < holder.nodes.Length; i++)
+                {
+                    CheckNode(holder.nodes[i], round * 10 + i);
+                    CheckPair(holder.pairs[i], round * 10 + i);
+                }
+                CheckNode((Node)holder.objects[0], round * 10);
+            }
+        }
+
+        [UnitTest]
+        public void interlocked_store()
+        {
+            var holder = MakeOldHolder();
+            holder.nodes[0] = MakeNode(-10);
+            for (int round = 0; round < 10; round++)
+            {
+                StoreInterlocked(holder, round);
+                MinorCollect();
+                CheckNode(holder.node, round);
+                CheckNode(holder.nodes[0], round + 1);
+                CheckNode(holder.nodes[1], round + 2);
+            }
+        }
+
+        [UnitTest]
+        public void collections()
+        {
+            var holder = MakeOldHolder();
+            for (int round = 0; round < 100; round++)
+            {
+                StoreCollections(holder, round);
+                if (round % 7 == 0)
+                {
+                    MinorCollect();
+                }
+            }
+            MinorCollect();
+            Assert.Equal(100, holder.list.Count);
+            Assert.Equal(100, holder.map.Count);
+            for (int i = 0; i < 100; i++)
+            {
+                CheckNode(holder.list[i], i);
+                CheckNode(holder.map[i], i);
+            }
+        }
+
+        [UnitTest]
+        public void boxed_struct_store()
+        {
+            var holder = MakeOldHolder();
+            for (int round = 0; round < 10; round++)
+            {
+                StoreBoxed(holder, round);
+                MinorCollect();
+                CheckNode(holder.boxed.Get(), round);
+            }
+        }
+
+        [MethodImpl(MethodImplOptions.NoInlining)]
+        private static WeakReference CreateYoungWeak(int depth)
+        {
+            if (depth > 0)
+            {
+                return CreateYoungWeak(depth - 1);
+            }
+            return new WeakReference(MakeNode(depth));
+        }
+
+        [UnitTest]
+        public void young_garbage_collected()
+        {
+            var holder = MakeOldHolder();
+            StoreField(holder, 5);
+            var weaks = new WeakReference[16];
+            for (int i = 0; i < weaks.Length; i++)
+            {
+                weaks[i] = CreateYoungWeak(8);
+            }
+            GC.Collect(0);
+            for (int i = 0; i < weaks.Length; i++)
+            {
+                Assert.IsFalse(weaks[i].IsAlive);
+            }
+            CheckNode(holder.node, 5);
+        }
+
+        [UnitTest]
+        public void promoted_then_overwritten()
+        {
+            // 晋升后的对象再引用新的年轻对象, 它自己也要进入记忆集
+            var holder = MakeOldHolder();
+            StoreField(holder, 1);
+            MinorCollect();
+            Node promoted = holder.node;
+            Assert.Equal(GC.MaxGeneration, GC.GetGeneration(promoted));
+            for (int round = 0; round < 10; round++)
+            {
+                StoreByRef(ref promoted.next.next, round + 50);
+                MinorCollect();
+                CheckNode(holder.node, 1);
+                CheckNode(holder.node.next.next, round + 50);
+            }
+        }
+
+        [UnitTest]
+        public void stress()
+        {
+            var olds = new Node[512];
+            for (int i = 0; i < olds.Length; i++)
+            {
+                olds[i] = new Node { value = i };
+            }
+            GC.Collect();
+            for (int round = 0; round < 200; round++)
+            {
+                for (int i = 0; i < olds.Length; i += 3)
+                {
+                    StoreByRef(ref olds[(i + round) % olds.Length].next, round);
+                }
+                if (round % 5 == 0)
+                {
+                    GC.Collect(0);
+                }
+            }
+            GC.Collect(0);
+            for (int i = 0; i < olds.Length; i++)
+            {
+                Assert.Equal(i, olds[i].value);
+                if (olds[i].next != null)
+                {
+                    Assert.Equal(olds[i].next.value + 1, olds[i].next.next.value);
+                }
+            }
+        }
+    }
+}
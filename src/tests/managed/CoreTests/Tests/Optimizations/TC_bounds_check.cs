@@ -0,0 +1,265 @@
+using test;
+using System;
+using System.Collections.Generic;
+using System.Linq;
+using System.Text;
+using System.Threading.Tasks;
+
+namespace Tests.Optimizations
+{
+    /// <summary>
+    /// 计数循环中的数组越界检查消除. 只有下标确定落在数组范围内时才能去掉检查, 其余情况必须照常抛出异常
+    /// </summary>
+    internal class TC_bounds_check : GeneralTestCaseBase
+    {
+        private static int Sum(int[] a)
+        {
+            int s = 0;
+            for (int i = 0; i < a.Length; i++)
+            {
+                s += a[i];
+            }
+            return s;
+        }
+
+        private static void Fill(double[] a, double v)
+        {
+            for (int i = 0; i < a.Length; i++)
+            {
+                a[i] = v * i;
+            }
+        }
+
+        private static int SumFrom(int[] a, int start)
+        {
+            int s = 0;
+            for (int i = start; i < a.Length; i++)
+            {
+                s += a[i];
+            }
+            return s;
+        }
+
+        private static int SumPairs(int[] a)
+        {
+            int s = 0;
+            for (int i = 0; i < a.Length; i++)
+            {
+                s += a[i];
+                i++;
+                s += a[i];
+            }
+            return s;
+        }
+
+        private static int SumResetNegative(int[] a, int limit)
+        {
+            int s = 0;
+            for (int i = 0; i < a.Length; i++)
+            {
+                s += a[i];
+                if (s > limit)
+                {
+                    i = -3;
+                    limit = int.MaxValue;
+                }
+            }
+            return s;
+        }
+
+        private static int SumPrevious(int[] a)
+        {
+            int s = 0;
+            for (int i = 0; i < a.Length; i++)
+            {
+                s += a[i - 1];
+            }
+            return s;
+        }
+
+        private static int SumUpTo(int[] a, int n)
+        {
+            int s = 0;
+            for (int i = 0; i < n; i++)
+            {
+                s += a[i];
+            }
+            return s;
+        }
+
+        private static int SumInclusive(int[] a)
+        {
+            int s = 0;
+            for (int i = 0; i <= a.Length; i++)
+            {
+                s += a[i];
+            }
+            return s;
+        }
+
+        private static int SumOther(int[] a, int[] b)
+        {
+            int s = 0;
+            for (int i = 0; i < a.Length; i++)
+            {
+                s += b[i];
+            }
+            return s;
+        }
+
+        private static int SumReassigned(int[] a, int[] b)
+        {
+            int s = 0;
+            for (int i = 0; i < a.Length; i++)
+            {
+                s += a[i];
+                a = b;
+                s += a[i];
+            }
+            return s;
+        }
+
+        private static void Touch(ref int v)
+        {
+            v += 10;
+        }
+
+        private static int SumIndexByRef(int[] a)
+        {
+            int s = 0;
+            for (int i = 0; i < a.Length; i++)
+            {
+                Touch(ref i);
+                s += a[i];
+            }
+            return s;
+        }
+
+        private static int[] MakeArray(int n)
+        {
+            var a = new int[n];
+            for (int i = 0; i < n; i++)
+            {
+                a[i] = i + 1;
+            }
+            return a;
+        }
+
+        private static void AssertThrowsIndexOutOfRange(Func<int> func)
+        {
+            bool thrown = false;
+            try
+            {
+                func();
+            }
+            catch (IndexOutOfRangeException)
+            {
+                thrown = true;
+            }
+            Assert.IsTrue(thrown);
+        }
+
+        [UnitTest]
+        public void counted_loop()
+        {
+            var a = MakeArray(10);
+            var d = new double[8];
+            TierUp.Run(i =>
+            {
+                Assert.Equal(55, Sum(a));
+                Assert.Equal(0, Sum(new int[0]));
+                Fill(d, i);
+                Assert.Equal(7.0 * i, d[7]);
+            });
+        }
+
+        [UnitTest]
+        public void null_array()
+        {
+            bool thrown = false;
+            try
+            {
+                Sum(null);
+            }
+            catch (NullReferenceException)
+            {
+                thrown = true;
+            }
+            Assert.IsTrue(thrown);
+        }
+
+        [UnitTest]
+        public void negative_start_index()
+        {
+            var a = MakeArray(4);
+            TierUp.Run(i =>
+            {
+                Assert.Equal(3 + 4, SumFrom(a, 2));
+                AssertThrowsIndexOutOfRange(() => SumFrom(a, -1));
+            });
+        }
+
+        [UnitTest]
+        public void index_modified_in_loop()
+        {
+            var even = MakeArray(4);
+            var odd = MakeArray(5);
+            TierUp.Run(i =>
+            {
+                Assert.Equal(10, SumPairs(even));
+                AssertThrowsIndexOutOfRange(() => SumPairs(odd));
+                Assert.Equal(10, SumResetNegative(even, 100));
+                AssertThrowsIndexOutOfRange(() => SumResetNegative(even, 2));
+                AssertThrowsIndexOutOfRange(() => SumIndexByRef(even));
+            });
+        }
+
+        [UnitTest]
+        public void index_below_zero()
+        {
+            var a = MakeArray(4);
+            TierUp.Run(i =>
+            {
+                AssertThrowsIndexOutOfRange(() => SumPrevious(a));
+                Assert.Equal(0, SumPrevious(new int[0]));
+            });
+        }
+
+        [UnitTest]
+        public void bound_beyond_length()
+        {
+            var a = MakeArray(4);
+            TierUp.Run(i =>
+            {
+                Assert.Equal(6, SumUpTo(a, 3));
+                AssertThrowsIndexOutOfRange(() => SumUpTo(a, 5));
+                AssertThrowsIndexOutOfRange(() => SumInclusive(a));
+            });
+        }
+
+        [UnitTest]
+        public void different_arrays()
+        {
+            var a = MakeArray(4);
+            var shorter = MakeArray(3);
+            TierUp.Run(i =>
+            {
+                Assert.Equal(6, SumOther(shorter, a));
+                AssertThrowsIndexOutOfRange(() => SumOther(a, shorter));
+            });
+        }
+
+        [UnitTest]
+        public void array_reassigned_in_loop()
+        {
+            var a = MakeArray(4);
+            var shorter = MakeArray(3);
+            TierUp.Run(i =>
+            {
+                // a[0] + shorter[0] + shorter[1] + shorter[1] + shorter[2] + shorter[2]
+                Assert.Equal(1 + 1 + 2 + 2 + 3 + 3, SumReassigned(a, shorter));
+                AssertThrowsIndexOutOfRange(() => SumReassigned(a, new int[0]));
+            });
+        }
+    }
+}
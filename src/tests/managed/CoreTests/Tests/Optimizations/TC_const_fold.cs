@@ -0,0 +1,348 @@
+using test;
+using System;
+using System.Collections.Generic;
+using System.Linq;
+using System.Text;
+using System.Threading.Tasks;
+
+namespace Tests.Optimizations
+{
+    /// <summary>
+    /// 常量折叠与分支裁剪. 操作数都从局部变量读取, 避免被C#编译器提前折叠
+    /// </summary>
+    internal class TC_const_fold : GeneralTestCaseBase
+    {
+        private static int DivByZero()
+        {
+            int a = 10;
+            int b = 0;
+            return a / b;
+        }
+
+        private static int RemByZero()
+        {
+            int a = 10;
+            int b = 0;
+            return a % b;
+        }
+
+        private static int DivMinByMinusOne()
+        {
+            int a = int.MinValue;
+            int b = -1;
+            return a / b;
+        }
+
+        private static long DivMinByMinusOneI8()
+        {
+            long a = long.MinValue;
+            long b = -1;
+            return a / b;
+        }
+
+        private static uint DivUnByZero()
+        {
+            uint a = 10;
+            uint b = 0;
+            return a / b;
+        }
+
+        private static int CheckedAddOverflow()
+        {
+            int a = int.MaxValue;
+            int b = 1;
+            return checked(a + b);
+        }
+
+        private static int CheckedConvOverflow()
+        {
+            long a = 1L << 40;
+            return checked((int)a);
+        }
+
+        private static int ShiftLeft(bool c)
+        {
+            int a = 1;
+            int n = 33;
+            // 移位数只取低5位, 33与1等价
+            return c ? a << n : a << 1;
+        }
+
+        private static long ShiftLeftI8()
+        {
+            long a = 1;
+            int n = 65;
+            return a << n;
+        }
+
+        private static int ShiftRightNegative()
+        {
+            int a = -16;
+            int n = 2;
+            return a >> n;
+        }
+
+        private static uint ShiftRightUnsigned()
+        {
+            uint a = 0x80000000u;
+            int n = 31;
+            return a >> n;
+        }
+
+        private static int WrapAround()
+        {
+            int a = int.MaxValue;
+            int b = 1;
+            return a + b;
+        }
+
+        private static int Negate()
+        {
+            int a = int.MinValue;
+            return -a;
+        }
+
+        private static int CompareNaN()
+        {
+            double a = double.NaN;
+            double b = 1.0;
+            int r = 0;
+            if (a < b)
+                r |= 1;
+            if (a >= b)
+                r |= 2;
+            if (!(a < b))
+                r |= 4;
+            if (a == a)
+                r |= 8;
+            if (a != a)
+                r |= 16;
+            return r;
+        }
+
+        private static bool CompareUnsigned()
+        {
+            uint a = 0xFFFFFFFFu;
+            uint b = 1;
+            return a > b;
+        }
+
+        private static bool CompareUnsignedI8()
+        {
+            ulong a = 0x8000000000000000ul;
+            ulong b = 1;
+            return a > b;
+        }
+
+        private static int ConvNarrow()
+        {
+            int a = 0x1FF80;
+            return (sbyte)a + (byte)a + (short)a + (ushort)a;
+        }
+
+        private static long ConvUnsignedWiden()
+        {
+            uint a = 0xFFFFFFFFu;
+            return (long)a;
+        }
+
+        private static double ConvToDouble()
+        {
+            uint a = 0xFFFFFFFFu;
+            return a;
+        }
+
+        private static float FloatRem()
+        {
+            float a = 7.5f;
+            float b = 2f;
+            return a % b;
+        }
+
+        private static double FloatDivByZero()
+        {
+            double a = 1.0;
+            double b = 0.0;
+            return a / b;
+        }
+
+        private static int ConstantModifiedInOtherBlock(bool c)
+        {
+            int a = 1;
+            if (c)
+            {
+                a = 2;
+            }
+            return a * 10;
+        }
+
+        private static int ConstantModifiedInLoop(int n)
+        {
+            int a = 1;
+            int s = 0;
+            for (int i = 0; i < n; i++)
+            {
+                s += a;
+                a = 3;
+            }
+            return s;
+        }
+
+        private static int BranchOnConstant(int x)
+        {
+            int a = 5;
+            int b = 3;
+            if (a > b)
+            {
+                return x + 1;
+            }
+            return x - 1;
+        }
+
+        private static int BranchOnConstantNotTaken(int x)
+        {
+            bool flag = false;
+            int r = x;
+            if (flag)
+            {
+                r = -x;
+            }
+            while (flag)
+            {
+                r++;
+            }
+            return r;
+        }
+
+        private static void AssertThrows<T>(Action action) where T : Exception
+        {
+            bool thrown = false;
+            try
+            {
+                action();
+            }
+            catch (T)
+            {
+                thrown = true;
+            }
+            Assert.IsTrue(thrown);
+        }
+
+        [UnitTest]
+        public void div_by_zero()
+        {
+            TierUp.Run(i =>
+            {
+                AssertThrows<DivideByZeroException>(() => DivByZero());
+                AssertThrows<DivideByZeroException>(() => RemByZero());
+                AssertThrows<DivideByZeroException>(() => DivUnByZero());
+            });
+        }
+
+        [UnitTest]
+        public void div_min_by_minus_one()
+        {
+            TierUp.Run(i =>
+            {
+                AssertThrows<OverflowException>(() => DivMinByMinusOne());
+                AssertThrows<OverflowException>(() => DivMinByMinusOneI8());
+            });
+        }
+
+        [UnitTest]
+        public void checked_overflow()
+        {
+            TierUp.Run(i =>
+            {
+                AssertThrows<OverflowException>(() => CheckedAddOverflow());
+                AssertThrows<OverflowException>(() => CheckedConvOverflow());
+            });
+        }
+
+        [UnitTest]
+        public void shift()
+        {
+            TierUp.Run(i =>
+            {
+                Assert.Equal(2, ShiftLeft(true));
+                Assert.Equal(2, ShiftLeft(false));
+                Assert.Equal(2L, ShiftLeftI8());
+                Assert.Equal(-4, ShiftRightNegative());
+                Assert.Equal(1, (int)ShiftRightUnsigned());
+            });
+        }
+
+        [UnitTest]
+        public void wrap_around()
+        {
+            TierUp.Run(i =>
+            {
+                Assert.Equal(int.MinValue, WrapAround());
+                Assert.Equal(int.MinValue, Negate());
+            });
+        }
+
+        [UnitTest]
+        public void compare_nan()
+        {
+            TierUp.Run(i =>
+            {
+                Assert.Equal(4 | 16, CompareNaN());
+            });
+        }
+
+        [UnitTest]
+        public void compare_unsigned()
+        {
+            TierUp.Run(i =>
+            {
+                Assert.IsTrue(CompareUnsigned());
+                Assert.IsTrue(CompareUnsignedI8());
+            });
+        }
+
+        [UnitTest]
+        public void conv()
+        {
+            TierUp.Run(i =>
+            {
+                Assert.Equal(-128 + 128 + -128 + 0xFF80, ConvNarrow());
+                Assert.Equal(4294967295L, ConvUnsignedWiden());
+                Assert.Equal(4294967295.0, ConvToDouble());
+            });
+        }
+
+        [UnitTest]
+        public void float_arith()
+        {
+            TierUp.Run(i =>
+            {
+                Assert.Equal(1.5f, FloatRem());
+                Assert.IsTrue(double.IsPositiveInfinity(FloatDivByZero()));
+            });
+        }
+
+        [UnitTest]
+        public void constant_modified_in_other_block()
+        {
+            TierUp.Run(i =>
+            {
+                Assert.Equal(20, ConstantModifiedInOtherBlock(true));
+                Assert.Equal(10, ConstantModifiedInOtherBlock(false));
+                Assert.Equal(0, ConstantModifiedInLoop(0));
+                Assert.Equal(1, ConstantModifiedInLoop(1));
+                Assert.Equal(1 + 3 * 4, ConstantModifiedInLoop(5));
+            });
+        }
+
+        [UnitTest]
+        public void branch_on_constant()
+        {
+            TierUp.Run(i =>
+            {
+                Assert.Equal(i + 1, BranchOnConstant(i));
+                Assert.Equal(i, BranchOnConstantNotTaken(i));
+            });
+        }
+    }
+}
@@ -0,0 +1,234 @@
+using test;
+using System;
+using System.Collections.Generic;
+using System.Linq;
+using System.Text;
+using System.Threading.Tasks;
+
+namespace Tests.Optimizations
+{
+    /// <summary>
+    /// newobj的结果类型确定, callvirt可以直接调用实现
+    /// </summary>
+    internal class TC_devirtualize : GeneralTestCaseBase
+    {
+        class Base
+        {
+            public virtual int M() => 1;
+        }
+
+        class A : Base
+        {
+            public override int M() => 2;
+        }
+
+        class B : Base
+        {
+            public override int M() => 3;
+        }
+
+        sealed class C : A
+        {
+            public override int M() => 4;
+        }
+
+        interface IShape
+        {
+            int Sides();
+        }
+
+        sealed class Square : IShape
+        {
+            public int Sides() => 4;
+        }
+
+        class Triangle : IShape
+        {
+            public virtual int Sides() => 3;
+        }
+
+        class Polygon : Triangle
+        {
+            public int n;
+
+            public sealed override int Sides() => n;
+
+            public int NonVirtual() => n * 2;
+        }
+
+        struct Counter
+        {
+            public int n;
+
+            public override int GetHashCode() => n + 1;
+        }
+
+        private static int CallInterfaceOnSealed(Square s)
+        {
+            return s.Sides();
+        }
+
+        private static int CallInterface(IShape s)
+        {
+            return s.Sides();
+        }
+
+        private static int CallFinalOverride(Polygon p)
+        {
+            return p.Sides() + p.NonVirtual();
+        }
+
+        private static int CallConstrained<T>(T v)
+        {
+            return v.GetHashCode();
+        }
+
+        private static int CallNew()
+        {
+            return new A().M();
+        }
+
+        private static int CallNewSealed()
+        {
+            Base b = new C();
+            return b.M();
+        }
+
+        private static int CallMerged(bool c)
+        {
+            return (c ? (Base)new A() : new B()).M();
+        }
+
+        private static int CallMergedSameClass(bool c, int x)
+        {
+            return new A().M() + (c ? x : -x);
+        }
+
+        private static int CallMergedWithNull(bool c)
+        {
+            return (c ? new A() : null).M();
+        }
+
+        private static int CallMergedWithNullFirst(bool c)
+        {
+            return (c ? null : new A()).M();
+        }
+
+        [UnitTest]
+        public void newobj_receiver()
+        {
+            TierUp.Run(i =>
+            {
+                Assert.Equal(2, CallNew());
+                Assert.Equal(4, CallNewSealed());
+            });
+        }
+
+        [UnitTest]
+        public void merge_different_classes()
+        {
+            TierUp.Run(i =>
+            {
+                Assert.Equal(2, CallMerged(true));
+                Assert.Equal(3, CallMerged(false));
+            });
+        }
+
+        [UnitTest]
+        public void merge_same_class()
+        {
+            TierUp.Run(i =>
+            {
+                Assert.Equal(2 + i, CallMergedSameClass(true, i));
+                Assert.Equal(2 - i, CallMergedSameClass(false, i));
+            });
+        }
+
+        [UnitTest]
+        public void merge_with_null()
+        {
+            TierUp.Run(i =>
+            {
+                Assert.Equal(2, CallMergedWithNull(true));
+                Assert.Equal(2, CallMergedWithNullFirst(false));
+            });
+            bool thrown = false;
+            try
+            {
+                CallMergedWithNull(false);
+            }
+            catch (NullReferenceException)
+            {
+                thrown = true;
+            }
+            Assert.IsTrue(thrown);
+
+            thrown = false;
+            try
+            {
+                CallMergedWithNullFirst(true);
+            }
+            catch (NullReferenceException)
+            {
+                thrown = true;
+            }
+            Assert.IsTrue(thrown);
+        }
+
+        [UnitTest]
+        public void sealed_class_and_final_method()
+        {
+            var square = new Square();
+            var polygon = new Polygon { n = 5 };
+            TierUp.Run(i =>
+            {
+                Assert.Equal(4, CallInterfaceOnSealed(square));
+                Assert.Equal(5 + 10, CallFinalOverride(polygon));
+            });
+            bool thrown = false;
+            try
+            {
+                CallFinalOverride(null);
+            }
+            catch (NullReferenceException)
+            {
+                thrown = true;
+            }
+            Assert.IsTrue(thrown);
+
+            thrown = false;
+            try
+            {
+                CallInterfaceOnSealed(null);
+            }
+            catch (NullReferenceException)
+            {
+                thrown = true;
+            }
+            Assert.IsTrue(thrown);
+        }
+
+        [UnitTest]
+        public void interface_receiver_not_exact()
+        {
+            IShape[] shapes = { new Square(), new Triangle(), new Polygon { n = 6 } };
+            TierUp.Run(i =>
+            {
+                Assert.Equal(4, CallInterface(shapes[0]));
+                Assert.Equal(3, CallInterface(shapes[1]));
+                Assert.Equal(6, CallInterface(shapes[2]));
+            });
+        }
+
+        [UnitTest]
+        public void constrained_value_type()
+        {
+            TierUp.Run(i =>
+            {
+                Assert.Equal(i + 1, CallConstrained(new Counter { n = i }));
+                Assert.Equal(i.GetHashCode(), CallConstrained(i));
+                Assert.Equal("x".GetHashCode(), CallConstrained("x"));
+            });
+        }
+    }
+}
@@ -0,0 +1,261 @@
+using test;
+using System;
+using System.Collections.Generic;
+using System.Linq;
+using System.Text;
+using System.Threading.Tasks;
+
+namespace Tests.Optimizations
+{
+    /// <summary>
+    /// 局部变量与参数的拷贝转发. 拷贝之后源变量被重新赋值或通过地址修改时, 读到的必须仍是拷贝时的值
+    /// </summary>
+    internal class TC_forward_locals : GeneralTestCaseBase
+    {
+        struct Point
+        {
+            public int x;
+            public int y;
+        }
+
+        private static int Swap(int a, int b)
+        {
+            int t = a;
+            a = b;
+            b = t;
+            return a * 100 + b;
+        }
+
+        private static int StoreBetweenCopyAndUse(int a)
+        {
+            // ldarg a; ldc 5; dup; starg a; add, 第一个操作数在starg之前读取
+            return a + (a = 5);
+        }
+
+        private static int StoreLocalBetweenCopyAndUse(int a)
+        {
+            int x = a;
+            int y = x + (x = a * 2) + x;
+            return y;
+        }
+
+        private static void Modify(ref int v)
+        {
+            v = 100;
+        }
+
+        private static int AddressTakenByRef(int a)
+        {
+            int x = a;
+            return x + Modify2(ref x) + x;
+        }
+
+        private static int Modify2(ref int v)
+        {
+            Modify(ref v);
+            return 0;
+        }
+
+        private static int AddressTakenByRefLocal(int a)
+        {
+            int x = a;
+            ref int r = ref x;
+            int y = x;
+            r = 7;
+            return y * 10 + x;
+        }
+
+        private static unsafe int AddressTakenByPointer(int a)
+        {
+            int x = a;
+            int* p = &x;
+            int y = x;
+            *p = 9;
+            return y * 10 + x;
+        }
+
+        private static int StructCopy(int a)
+        {
+            Point p1 = new Point { x = a, y = a + 1 };
+            Point p2 = p1;
+            p1.x = -1;
+            return p2.x * 10 + p1.x;
+        }
+
+        private static int Thrower(int v)
+        {
+            if (v >= 0)
+            {
+                throw new InvalidOperationException();
+            }
+            return v;
+        }
+
+        private static int ObservedInCatch(int a)
+        {
+            int x = a;
+            try
+            {
+                x = a + 1;
+                x = Thrower(x);
+                x = -100;
+            }
+            catch (InvalidOperationException)
+            {
+                return x;
+            }
+            return x;
+        }
+
+        private static int ObservedInFinally(int a)
+        {
+            int x = a;
+            int r = 0;
+            try
+            {
+                try
+                {
+                    x = a * 2;
+                    Thrower(x);
+                    x = -100;
+                }
+                finally
+                {
+                    r = x;
+                }
+            }
+            catch (InvalidOperationException)
+            {
+            }
+            return r;
+        }
+
+        private static int ObservedAfterLeave(int a)
+        {
+            int x = a;
+            try
+            {
+                x = a + 3;
+            }
+            finally
+            {
+                x = x * 2;
+            }
+            return x;
+        }
+
+        private static int FoldedStore(int a, int b)
+        {
+            int c = a + b;
+            int d = c * c;
+            c = d - a;
+            return c;
+        }
+
+        private static int CopyOfComputedLocal(int x, int y)
+        {
+            // stloc c被合并进add之后, ldloc c; stloc d不能再把add的结果改写到d
+            int c = x + y;
+            int d = c;
+            return c * 10 + d;
+        }
+
+        private static int CopyChain(int a)
+        {
+            int b = a;
+            int c = b;
+            return b * 100 + c * 10 + a;
+        }
+
+        private static int StoreToArgInLoop(int a, int n)
+        {
+            int s = 0;
+            for (int i = 0; i < n; i++)
+            {
+                int old = a;
+                a = a + 1;
+                s += old;
+            }
+            return s * 1000 + a;
+        }
+
+        [UnitTest]
+        public void swap()
+        {
+            TierUp.Run(i =>
+            {
+                Assert.Equal(2 * 100 + i, Swap(i, 2));
+            });
+        }
+
+        [UnitTest]
+        public void store_between_copy_and_use()
+        {
+            TierUp.Run(i =>
+            {
+                Assert.Equal(i + 5, StoreBetweenCopyAndUse(i));
+                Assert.Equal(i + i * 2 + i * 2, StoreLocalBetweenCopyAndUse(i));
+            });
+        }
+
+        [UnitTest]
+        public void address_taken()
+        {
+            TierUp.Run(i =>
+            {
+                Assert.Equal(i + 100, AddressTakenByRef(i));
+                Assert.Equal(i * 10 + 7, AddressTakenByRefLocal(i));
+                Assert.Equal(i * 10 + 9, AddressTakenByPointer(i));
+            });
+        }
+
+        [UnitTest]
+        public void struct_copy()
+        {
+            TierUp.Run(i =>
+            {
+                Assert.Equal(i * 10 - 1, StructCopy(i));
+            });
+        }
+
+        [UnitTest]
+        public void observed_in_handler()
+        {
+            TierUp.Run(i =>
+            {
+                Assert.Equal(i + 1, ObservedInCatch(i));
+                Assert.Equal(i * 2, ObservedInFinally(i));
+                Assert.Equal((i + 3) * 2, ObservedAfterLeave(i));
+            });
+        }
+
+        [UnitTest]
+        public void folded_store()
+        {
+            TierUp.Run(i =>
+            {
+                Assert.Equal((i + 3) * (i + 3) - i, FoldedStore(i, 3));
+            });
+        }
+
+        [UnitTest]
+        public void copy_of_folded_store()
+        {
+            TierUp.Run(i =>
+            {
+                Assert.Equal((i + 3) * 11, CopyOfComputedLocal(i, 3));
+                Assert.Equal(i * 111, CopyChain(i));
+            });
+        }
+
+        [UnitTest]
+        public void store_to_arg_in_loop()
+        {
+            TierUp.Run(i =>
+            {
+                // s = a + (a+1) + ... + (a+n-1)
+                Assert.Equal((4 * i + 6) * 1000 + i + 4, StoreToArgInLoop(i, 4));
+            });
+        }
+    }
+}
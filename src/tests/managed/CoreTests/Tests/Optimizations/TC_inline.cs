@@ -0,0 +1,262 @@
+using test;
+using System;
+using System.Collections.Generic;
+using System.Linq;
+using System.Text;
+using System.Threading.Tasks;
+
+namespace Tests.Optimizations
+{
+    /// <summary>
+    /// 方法升级到优化版本后, 不超过LEANCLR_INLINE_MAX_IL_SIZE字节的直线被调函数被内联, 有分支的被调函数保持普通调用
+    /// </summary>
+    internal class TC_inline : GeneralTestCaseBase
+    {
+        struct Vec3
+        {
+            public float x;
+            public float y;
+            public float z;
+        }
+
+        struct Holder
+        {
+            public Vec3 p;
+            public int n;
+
+            public Vec3 P => p;
+
+            public int N => n;
+
+            public int Add(int a, int b)
+            {
+                int c = a + b;
+                return c + n;
+            }
+        }
+
+        class Box
+        {
+            public int value;
+
+            public int Value => value;
+        }
+
+        class Settable
+        {
+            private int _value;
+
+            public int Value
+            {
+                get => _value;
+                set => _value = value;
+            }
+        }
+
+        private static int Max(int a, int b)
+        {
+            return a > b ? a : b;
+        }
+
+        private static int Checked(int a)
+        {
+            if (a < 0)
+            {
+                throw new ArgumentOutOfRangeException(nameof(a));
+            }
+            return a;
+        }
+
+        // 有分支的被调函数(Math.Max/Min这种菱形结构)不内联, 调用必须照常执行两个分支
+        private static int Min(int a, int b)
+        {
+            if (a < b)
+            {
+                return a;
+            }
+            return b;
+        }
+
+        private static int Clamp(int v, int lo, int hi)
+        {
+            return v < lo ? lo : v > hi ? hi : v;
+        }
+
+        private static int AbsDiff(int a, int b)
+        {
+            int d = a - b;
+            return d >= 0 ? d : -d;
+        }
+
+        // 直线的被调函数内联进来, 其中的菱形调用仍然是普通调用
+        private static int MinPlusOne(int a, int b)
+        {
+            return Min(a, b) + 1;
+        }
+
+        private static int Factorial(int n)
+        {
+            return n <= 1 ? 1 : n * Factorial(n - 1);
+        }
+
+        private static int MaxOfThree(int a, int b, int c)
+        {
+            return Max(Max(a, b), c);
+        }
+
+        private static int SetThenGet(Settable s, int v)
+        {
+            s.Value = v;
+            return s.Value + 1;
+        }
+
+        private static int CallThrowingCallee(int a)
+        {
+            return Checked(a) + 1;
+        }
+
+        private static float GetWideProperty(float z)
+        {
+            Holder h = default;
+            h.p.z = z;
+            return h.P.z;
+        }
+
+        private static int GetNarrowProperty(int n)
+        {
+            Holder h = default;
+            h.n = n;
+            return h.N;
+        }
+
+        private static int CallWithLocals(int n, int a)
+        {
+            Holder h = default;
+            h.n = n;
+            return h.Add(a, a + 1);
+        }
+
+        private static int GetClassProperty(Box b)
+        {
+            return b.Value;
+        }
+
+        [UnitTest]
+        public void struct_property_wider_than_this()
+        {
+            TierUp.Run(i =>
+            {
+                Assert.Equal((float)i, GetWideProperty(i));
+            });
+        }
+
+        [UnitTest]
+        public void struct_property()
+        {
+            TierUp.Run(i =>
+            {
+                Assert.Equal(i, GetNarrowProperty(i));
+            });
+        }
+
+        [UnitTest]
+        public void callee_with_locals()
+        {
+            TierUp.Run(i =>
+            {
+                Assert.Equal(i + 2 * i + 1 + 3, CallWithLocals(3, i));
+            });
+        }
+
+        [UnitTest]
+        public void class_property_null_this()
+        {
+            var b = new Box { value = 5 };
+            TierUp.Run(i =>
+            {
+                Assert.Equal(5, GetClassProperty(b));
+            });
+            bool thrown = false;
+            try
+            {
+                GetClassProperty(null);
+            }
+            catch (NullReferenceException)
+            {
+                thrown = true;
+            }
+            Assert.IsTrue(thrown);
+        }
+
+        [UnitTest]
+        public void static_helper()
+        {
+            TierUp.Run(i =>
+            {
+                Assert.Equal(i, MaxOfThree(i, -i, i - 1));
+                Assert.Equal(10, MaxOfThree(i - 100, 10, -5));
+            });
+        }
+
+        [UnitTest]
+        public void diamond_callee()
+        {
+            TierUp.Run(i =>
+            {
+                Assert.Equal(i, Max(i, -i));
+                Assert.Equal(i + 1, Max(i, i + 1));
+                Assert.Equal(-i, Min(i, -i));
+                Assert.Equal(i, Min(i, i + 1));
+                Assert.Equal(0, Clamp(i - 100, 0, 10));
+                Assert.Equal(10, Clamp(i + 100, 0, 10));
+                Assert.Equal(i % 10, Clamp(i % 10, 0, 10));
+                Assert.Equal(i, AbsDiff(i, 0));
+                Assert.Equal(i, AbsDiff(0, i));
+                Assert.Equal(Math.Max(i, 7), Max(i, 7));
+                Assert.Equal(Math.Min(i, 7), Min(i, 7));
+                Assert.Equal(-i + 1, MinPlusOne(i, -i));
+                Assert.Equal(i + 1, MinPlusOne(i, i + 5));
+            });
+        }
+
+        [UnitTest]
+        public void property_setter()
+        {
+            var s = new Settable();
+            TierUp.Run(i =>
+            {
+                Assert.Equal(i + 1, SetThenGet(s, i));
+                Assert.Equal(i, s.Value);
+            });
+        }
+
+        [UnitTest]
+        public void throwing_callee()
+        {
+            TierUp.Run(i =>
+            {
+                Assert.Equal(i + 1, CallThrowingCallee(i));
+            });
+            bool thrown = false;
+            try
+            {
+                CallThrowingCallee(-1);
+            }
+            catch (ArgumentOutOfRangeException)
+            {
+                thrown = true;
+            }
+            Assert.IsTrue(thrown);
+        }
+
+        [UnitTest]
+        public void recursive_callee()
+        {
+            TierUp.Run(i =>
+            {
+                Assert.Equal(120, Factorial(5));
+                Assert.Equal(1, Factorial(-i));
+            });
+        }
+    }
+}
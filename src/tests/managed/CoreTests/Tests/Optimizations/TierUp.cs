@@ -0,0 +1,24 @@
+using System;
+
+namespace Tests.Optimizations
+{
+    /// <summary>
+    /// 方法被调用LEANCLR_TIER_UP_INVOCATION_THRESHOLD次后才用优化版本执行, 优化相关的用例都通过Run反复调用被测函数
+    /// </summary>
+    internal static class TierUp
+    {
+        // 与build_config.h中的LEANCLR_TIER_UP_INVOCATION_THRESHOLD保持一致
+        public const int InvocationThreshold = 16;
+
+        // 前一半调用升级被测函数, 后一半都运行优化版本
+        public const int IterationCount = InvocationThreshold * 2;
+
+        public static void Run(Action<int> iteration)
+        {
+            for (int i = 0; i < IterationCount; i++)
+            {
+                iteration(i);
+            }
+        }
+    }
+}